@@ -19,6 +19,10 @@
 #include <algorithm>
 #include <fstream>
 
+// Boost's regex engine gives up after this many steps, which can be changed while running (see RegexComplexity.h)
+namespace NppPythonScript { long regexStepLimit(); }
+#define BOOST_REGEX_MAX_STATE_COUNT NppPythonScript::regexStepLimit()
+
 #include <boost/regex.hpp>
 #include <boost/python.hpp>
 
@@ -0,0 +1,49 @@
+#ifndef BENCHMARKTIMER_20140420_H
+#define BENCHMARKTIMER_20140420_H
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+/** Measures elapsed time for the benchmark tests, with the performance counter (or the monotonic clock off Windows).
+ *  The benchmarks are DISABLED_ tests, so they only run with --gtest_also_run_disabled_tests.
+ */
+class BenchmarkTimer
+{
+public:
+#ifdef _WIN32
+    BenchmarkTimer()
+	{
+        ::QueryPerformanceFrequency(&m_frequency);
+        ::QueryPerformanceCounter(&m_start);
+	}
+
+    double elapsedMilliseconds() const
+	{
+        LARGE_INTEGER now;
+        ::QueryPerformanceCounter(&now);
+        return static_cast<double>(now.QuadPart - m_start.QuadPart) * 1000.0 / static_cast<double>(m_frequency.QuadPart);
+	}
+
+private:
+    LARGE_INTEGER m_frequency;
+    LARGE_INTEGER m_start;
+#else
+    BenchmarkTimer()
+	{
+        clock_gettime(CLOCK_MONOTONIC, &m_start);
+	}
+
+    double elapsedMilliseconds() const
+	{
+        timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<double>(now.tv_sec - m_start.tv_sec) * 1000.0 + static_cast<double>(now.tv_nsec - m_start.tv_nsec) / 1000000.0;
+	}
+
+private:
+    timespec m_start;
+#endif
+};
+
+#endif // BENCHMARKTIMER_20140420_H
@@ -0,0 +1,272 @@
+#include "stdafx.h"
+
+
+#include <memory>
+#include <queue>
+#include <vector>
+#include <gtest/gtest.h>
+#include "BoundedQueue.h"
+#include "BenchmarkTimer.h"
+#include "TestThread.h"
+
+namespace NppPythonScript
+{
+
+typedef BoundedQueue<long> LongQueue;
+
+TEST(BoundedQueueTest, PopsInTheOrderPushed) {
+    LongQueue queue(8);
+    ASSERT_TRUE(queue.isEmpty());
+    ASSERT_EQ(LongQueue::PUSHED_TO_EMPTY, queue.push(1, QUEUE_BLOCK));
+    ASSERT_EQ(LongQueue::PUSHED, queue.push(2, QUEUE_BLOCK));
+    ASSERT_EQ(LongQueue::PUSHED, queue.push(3, QUEUE_BLOCK));
+    ASSERT_FALSE(queue.isEmpty());
+
+    long item = 0;
+    ASSERT_TRUE(queue.pop(item));
+    ASSERT_EQ(1, item);
+    ASSERT_TRUE(queue.pop(item));
+    ASSERT_EQ(2, item);
+    ASSERT_TRUE(queue.pop(item));
+    ASSERT_EQ(3, item);
+    ASSERT_FALSE(queue.pop(item));
+    ASSERT_TRUE(queue.isEmpty());
+
+    // Only the push after the queue is emptied needs to wake the consumer again
+    ASSERT_EQ(LongQueue::PUSHED_TO_EMPTY, queue.push(4, QUEUE_BLOCK));
+}
+
+TEST(BoundedQueueTest, CapacityIsRoundedUpToAPowerOfTwo) {
+    LongQueue queue(5);
+    ASSERT_EQ(8, queue.getStats().capacity);
+}
+
+TEST(BoundedQueueTest, BlockingPushReportsFullQueue) {
+    LongQueue queue(4);
+    for (long item = 0; item < 4; ++item)
+	{
+        ASSERT_NE(LongQueue::QUEUE_FULL, queue.push(item, QUEUE_BLOCK));
+	}
+    ASSERT_EQ(LongQueue::QUEUE_FULL, queue.push(4, QUEUE_BLOCK));
+
+    long item = 0;
+    ASSERT_TRUE(queue.pop(item));
+    ASSERT_EQ(0, item);
+    ASSERT_EQ(LongQueue::PUSHED, queue.push(4, QUEUE_BLOCK));
+    ASSERT_EQ(5, queue.getStats().pushed);
+}
+
+TEST(BoundedQueueTest, DropOldestMakesRoomForTheNewItem) {
+    LongQueue queue(4);
+    for (long item = 0; item < 6; ++item)
+	{
+        queue.push(item, QUEUE_DROP_OLDEST);
+	}
+    QueueStats stats = queue.getStats();
+    ASSERT_EQ(6, stats.pushed);
+    ASSERT_EQ(2, stats.droppedOldest);
+    ASSERT_EQ(0, stats.droppedNewest);
+
+    long item = 0;
+    for (long expected = 2; expected < 6; ++expected)
+	{
+        ASSERT_TRUE(queue.pop(item));
+        ASSERT_EQ(expected, item);
+	}
+    ASSERT_TRUE(queue.isEmpty());
+}
+
+TEST(BoundedQueueTest, DropNewestKeepsTheQueuedItems) {
+    LongQueue queue(4);
+    for (long item = 0; item < 4; ++item)
+	{
+        queue.push(item, QUEUE_DROP_NEWEST);
+	}
+    ASSERT_EQ(LongQueue::DROPPED, queue.push(4, QUEUE_DROP_NEWEST));
+    QueueStats stats = queue.getStats();
+    ASSERT_EQ(4, stats.pushed);
+    ASSERT_EQ(1, stats.droppedNewest);
+
+    long item = 0;
+    for (long expected = 0; expected < 4; ++expected)
+	{
+        ASSERT_TRUE(queue.pop(item));
+        ASSERT_EQ(expected, item);
+	}
+    ASSERT_FALSE(queue.pop(item));
+}
+
+TEST(BoundedQueueTest, PoppedItemsAreReleased) {
+    BoundedQueue<std::shared_ptr<int> > queue(4);
+    std::shared_ptr<int> item(new int(1));
+    queue.push(item, QUEUE_BLOCK);
+    ASSERT_EQ(2, item.use_count());
+
+    std::shared_ptr<int> popped;
+    ASSERT_TRUE(queue.pop(popped));
+    popped.reset();
+    ASSERT_EQ(1, item.use_count());
+}
+
+
+const long PRODUCER_COUNT = 4;
+
+struct ProducerState
+{
+    LongQueue *queue;
+    QueueOverflow overflow;
+    long producer;
+    long itemCount;
+};
+
+/** Pushes producer * itemCount + 0, 1, 2... so the consumer can check the order of each producer's items
+ */
+void producerThread(void *param)
+{
+    ProducerState *state = static_cast<ProducerState*>(param);
+    for (long index = 0; index < state->itemCount; ++index)
+	{
+        while (LongQueue::QUEUE_FULL == state->queue->push(state->producer * state->itemCount + index, state->overflow))
+		{
+            yieldThread();
+		}
+	}
+}
+
+/** Runs PRODUCER_COUNT producers into the queue, and pops on this thread until they have all finished and the queue is empty.
+ *  Returns the number of items popped, and fails if any producer's items came out of order.
+ */
+long runProducers(LongQueue& queue, QueueOverflow overflow, long itemCount)
+{
+    ProducerState states[PRODUCER_COUNT];
+    TestThread threads[PRODUCER_COUNT];
+    for (long producer = 0; producer < PRODUCER_COUNT; ++producer)
+	{
+        ProducerState state = { &queue, overflow, producer, itemCount };
+        states[producer] = state;
+        threads[producer].start(producerThread, &states[producer]);
+	}
+
+    std::vector<long> lastItem(PRODUCER_COUNT, -1);
+    long popped = 0;
+    bool inOrder = true;
+    while (queue.getStats().pushed + queue.getStats().droppedNewest < PRODUCER_COUNT * itemCount || !queue.isEmpty())
+	{
+        long item;
+        if (!queue.pop(item))
+		{
+            yieldThread();
+            continue;
+		}
+        ++popped;
+        const long producer = item / itemCount;
+        inOrder = inOrder && (item % itemCount > lastItem[producer]);
+        lastItem[producer] = item % itemCount;
+	}
+
+    for (long producer = 0; producer < PRODUCER_COUNT; ++producer)
+	{
+        threads[producer].join();
+	}
+    EXPECT_TRUE(inOrder);
+    return popped;
+}
+
+TEST(BoundedQueueTest, ManyProducersLoseNothingWhenBlocking) {
+    LongQueue queue(64);
+    const long itemCount = 200000;
+    ASSERT_EQ(PRODUCER_COUNT * itemCount, runProducers(queue, QUEUE_BLOCK, itemCount));
+    ASSERT_EQ(PRODUCER_COUNT * itemCount, queue.getStats().pushed);
+}
+
+TEST(BoundedQueueTest, ManyProducersCountEveryDroppedItem) {
+    LongQueue oldestQueue(64);
+    const long itemCount = 200000;
+    long popped = runProducers(oldestQueue, QUEUE_DROP_OLDEST, itemCount);
+    QueueStats stats = oldestQueue.getStats();
+    ASSERT_EQ(PRODUCER_COUNT * itemCount, stats.pushed);
+    ASSERT_EQ(stats.pushed, popped + stats.droppedOldest);
+
+    LongQueue newestQueue(64);
+    popped = runProducers(newestQueue, QUEUE_DROP_NEWEST, itemCount);
+    stats = newestQueue.getStats();
+    ASSERT_EQ(PRODUCER_COUNT * itemCount, stats.pushed + stats.droppedNewest);
+    ASSERT_EQ(stats.pushed, popped);
+}
+
+
+/** The queue PyProducerConsumer had before, without the event
+ */
+class LockedQueue
+{
+public:
+    void push(long item)
+	{
+        m_lock.lock();
+        m_queue.push(item);
+        m_lock.unlock();
+	}
+
+    bool pop(long& item)
+	{
+        m_lock.lock();
+        bool popped = !m_queue.empty();
+        if (popped)
+		{
+            item = m_queue.front();
+            m_queue.pop();
+		}
+        m_lock.unlock();
+        return popped;
+	}
+
+private:
+    TestMutex m_lock;
+    std::queue<long> m_queue;
+};
+
+void lockedProducerThread(void *param)
+{
+    LockedQueue *queue = static_cast<LockedQueue*>(param);
+    for (long index = 0; index < 1000000; ++index)
+	{
+        queue->push(index);
+	}
+}
+
+TEST(BoundedQueueTest, DISABLED_BenchmarkAgainstLockedQueue) {
+    const long itemCount = 1000000;
+
+    LongQueue queue(4096);
+    BenchmarkTimer boundedTimer;
+    long boundedPopped = runProducers(queue, QUEUE_BLOCK, itemCount);
+    double boundedTime = boundedTimer.elapsedMilliseconds();
+
+    LockedQueue lockedQueue;
+    BenchmarkTimer lockedTimer;
+    TestThread threads[PRODUCER_COUNT];
+    for (long producer = 0; producer < PRODUCER_COUNT; ++producer)
+	{
+        threads[producer].start(lockedProducerThread, &lockedQueue);
+	}
+    long lockedPopped = 0;
+    while (lockedPopped < PRODUCER_COUNT * itemCount)
+	{
+        long item;
+        if (lockedQueue.pop(item))
+		{
+            ++lockedPopped;
+		}
+	}
+    for (long producer = 0; producer < PRODUCER_COUNT; ++producer)
+	{
+        threads[producer].join();
+	}
+    double lockedTime = lockedTimer.elapsedMilliseconds();
+
+    ASSERT_EQ(boundedPopped, lockedPopped);
+    printf("%ld producers, %ld items each: BoundedQueue %.1fms, locked std::queue %.1fms\n",
+           PRODUCER_COUNT, itemCount, boundedTime, lockedTime);
+}
+
+}
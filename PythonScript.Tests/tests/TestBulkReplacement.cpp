@@ -0,0 +1,73 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "BulkReplacement.h"
+#include "ReplacementBatch.h"
+
+namespace NppPythonScript
+{
+
+/** Applies the replacements one at a time, in the same way as ReplacementContainer::runReplacementsPerMatch()
+ */
+static std::string replacePerMatch(const std::string& text, const ReplacementBatch& replacements)
+{
+    std::string result(text);
+    int offset = 0;
+    for (ReplacementBatch::const_iterator it = replacements.begin(); it != replacements.end(); ++it)
+	{
+        result.replace(offset + it->start, it->end - it->start, replacements.getReplacement(*it), it->length);
+        offset = offset + (it->length - (it->end - it->start));
+	}
+    return result;
+}
+
+static std::string replaceBulk(const std::string& text, const ReplacementBatch& replacements)
+{
+    BulkReplacement bulkReplacement(text.c_str(), replacements);
+    std::string result(text);
+    result.replace(bulkReplacement.spanStart(), bulkReplacement.spanEnd() - bulkReplacement.spanStart(), bulkReplacement.replacedText(), bulkReplacement.replacedLength());
+    return result;
+}
+
+TEST(BulkReplacementTest, SpanCoversFirstToLastReplacement) {
+    std::string text("aaa bbb ccc bbb ddd");
+    ReplacementBatch replacements;
+    replacements.add(4, 7, "X", 1);
+    replacements.add(12, 15, "YYYYY", 5);
+
+    BulkReplacement bulkReplacement(text.c_str(), replacements);
+    ASSERT_EQ(4, bulkReplacement.spanStart());
+    ASSERT_EQ(15, bulkReplacement.spanEnd());
+    ASSERT_EQ(std::string("X ccc YYYYY"), std::string(bulkReplacement.replacedText(), bulkReplacement.replacedLength()));
+}
+
+TEST(BulkReplacementTest, SameAsPerMatch) {
+    std::string text;
+    for (int i = 0; i < 200; ++i)
+	{
+        text += "line with a match in it\r\n";
+	}
+
+    // Shorter, longer, empty and same length replacements, with adjacent matches
+    ReplacementBatch replacements;
+    const char *replacementTexts[] = { "", "M", "MATCH", "MATCHED TEXT" };
+    for (int i = 0; i < 200; ++i)
+	{
+        int lineStart = i * 25;
+        replacements.add(lineStart + 12, lineStart + 17, replacementTexts[i % 4], static_cast<int>(strlen(replacementTexts[i % 4])));
+        replacements.add(lineStart + 17, lineStart + 20, "@", 1);
+	}
+
+    ASSERT_EQ(replacePerMatch(text, replacements), replaceBulk(text, replacements));
+}
+
+TEST(BulkReplacementTest, EmptyListIsEmptySpan) {
+    ReplacementBatch replacements;
+    BulkReplacement bulkReplacement("abc", replacements);
+    ASSERT_EQ(0, bulkReplacement.spanStart());
+    ASSERT_EQ(0, bulkReplacement.spanEnd());
+    ASSERT_EQ(0, bulkReplacement.replacedLength());
+}
+
+}
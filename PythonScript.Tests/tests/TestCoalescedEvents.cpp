@@ -0,0 +1,86 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "CoalescedEvents.h"
+#include "Scintilla.h"
+
+namespace NppPythonScript
+{
+
+TEST(CoalescedEventsTest, OneModificationIsItsOwnRange) {
+    CoalescedEvents events;
+    events.addModification(SC_MOD_INSERTTEXT | SC_PERFORMED_USER, 10, 5, 1);
+    ASSERT_EQ(1, events.count());
+    ASSERT_EQ(10, events.start());
+    ASSERT_EQ(5, events.length());
+    ASSERT_EQ(1, events.linesAdded());
+    ASSERT_EQ(SC_MOD_INSERTTEXT | SC_PERFORMED_USER, events.modificationType());
+}
+
+TEST(CoalescedEventsTest, TypingExtendsTheRange) {
+    CoalescedEvents events;
+    for (int position = 10; position < 20; ++position)
+	{
+        events.addModification(SC_MOD_INSERTTEXT, position, 1, 0);
+	}
+    ASSERT_EQ(10, events.count());
+    ASSERT_EQ(10, events.start());
+    ASSERT_EQ(10, events.length());
+}
+
+TEST(CoalescedEventsTest, InsertBeforeTheRangeMovesIt) {
+    CoalescedEvents events;
+    events.addModification(SC_MOD_INSERTTEXT, 100, 10, 0);
+    events.addModification(SC_MOD_INSERTTEXT, 0, 5, 2);
+    // Both inserts, as the text is now: [0, 5) and [105, 115)
+    ASSERT_EQ(0, events.start());
+    ASSERT_EQ(115, events.length());
+    ASSERT_EQ(2, events.linesAdded());
+}
+
+TEST(CoalescedEventsTest, DeleteInsideTheRangeShrinksIt) {
+    CoalescedEvents events;
+    events.addModification(SC_MOD_INSERTTEXT, 10, 20, 0);
+    events.addModification(SC_MOD_DELETETEXT, 15, 5, -1);
+    ASSERT_EQ(10, events.start());
+    ASSERT_EQ(15, events.length());
+    ASSERT_EQ(-1, events.linesAdded());
+    ASSERT_EQ(SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT, events.modificationType());
+}
+
+TEST(CoalescedEventsTest, DeleteOverTheStartOfTheRange) {
+    CoalescedEvents events;
+    events.addModification(SC_MOD_INSERTTEXT, 10, 10, 0);
+    events.addModification(SC_MOD_DELETETEXT, 5, 10, 0);
+    // [10, 20) loses [10, 15) to the delete, and moves back to [5, 10)
+    ASSERT_EQ(5, events.start());
+    ASSERT_EQ(5, events.length());
+}
+
+TEST(CoalescedEventsTest, DeleteAfterTheRangeExtendsItToTheDeletion) {
+    CoalescedEvents events;
+    events.addModification(SC_MOD_INSERTTEXT, 10, 10, 0);
+    events.addModification(SC_MOD_DELETETEXT, 30, 10, 0);
+    ASSERT_EQ(10, events.start());
+    ASSERT_EQ(20, events.length());
+}
+
+TEST(CoalescedEventsTest, StyleChangesExtendTheRangeWithoutMovingIt) {
+    CoalescedEvents events;
+    events.addModification(SC_MOD_CHANGESTYLE, 50, 10, 0);
+    events.addModification(SC_MOD_CHANGEFOLD, 0, 0, 0);
+    ASSERT_EQ(50, events.start());
+    ASSERT_EQ(10, events.length());
+    ASSERT_EQ(2, events.count());
+}
+
+TEST(CoalescedEventsTest, OtherEventsAreOnlyCounted) {
+    CoalescedEvents events;
+    events.add();
+    events.add();
+    ASSERT_EQ(2, events.count());
+    ASSERT_FALSE(events.hasRange());
+}
+
+}
@@ -0,0 +1,176 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "LiteralSearcher.h"
+#include "Replacer.h"
+#include "ReplacementBatch.h"
+
+namespace NppPythonScript
+{
+
+typedef std::vector<std::pair<int, int> > SpanList;
+
+static bool collectSpan(const char * /* text */, Match *match, void *state)
+{
+    SpanList *spans = reinterpret_cast<SpanList*>(state);
+    GroupDetail fullMatch;
+    match->group(0, fullMatch);
+    spans->push_back(std::pair<int, int>(fullMatch.start(), fullMatch.end()));
+    return true;
+}
+
+/** Runs the search through the literal engine, and through the regex engine (by quoting the literal with \Q..\E)
+ *  and checks that both give the same matches.
+ */
+template <class CharTraitsT>
+static void assertSameAsRegex(const char *text, const char *literal, int startPosition = 0, int extraFlags = python_re_flag_normal)
+{
+    Replacer<CharTraitsT> replacer;
+    int textLength = static_cast<int>(strlen(text));
+
+    SpanList literalSpans;
+    replacer.search(text, textLength, startPosition, 0, literal, collectSpan, &literalSpans, static_cast<python_re_flags>(python_re_flag_literal | extraFlags));
+
+    SpanList regexSpans;
+    std::string quoted = std::string("\\Q") + literal + "\\E";
+    replacer.search(text, textLength, startPosition, 0, quoted.c_str(), collectSpan, &regexSpans, static_cast<python_re_flags>(python_re_flag_normal | extraFlags));
+
+    ASSERT_EQ(regexSpans, literalSpans);
+}
+
+/** Runs a replace through the literal engine, and through the regex engine, and checks the replacements are identical
+ */
+template <class CharTraitsT>
+static void assertReplaceSameAsRegex(const char *text, const char *literal, const char *replacement)
+{
+    Replacer<CharTraitsT> replacer;
+    int textLength = static_cast<int>(strlen(text));
+
+    ReplacementBatch literalEntries;
+    replacer.startReplace(text, textLength, 0, 0, literal, replacement, python_re_flag_literal, literalEntries);
+
+    ReplacementBatch regexEntries;
+    std::string quoted = std::string("\\Q") + literal + "\\E";
+    replacer.startReplace(text, textLength, 0, 0, quoted.c_str(), replacement, python_re_flag_normal, regexEntries);
+
+    ASSERT_EQ(regexEntries.size(), literalEntries.size());
+    ReplacementBatch::const_iterator regexIt = regexEntries.begin();
+    for (ReplacementBatch::const_iterator it = literalEntries.begin(); it != literalEntries.end(); ++it, ++regexIt)
+	{
+        ASSERT_EQ(regexIt->start, it->start);
+        ASSERT_EQ(regexIt->end, it->end);
+        ASSERT_STREQ(regexEntries.getReplacement(*regexIt), literalEntries.getReplacement(*it));
+	}
+}
+
+TEST(LiteralSearcherTest, FindsFirstOccurrence) {
+    LiteralSearcher searcher("abc", 3);
+    const char *text = "xxabxabcxxabc";
+    ASSERT_EQ(5, searcher.find(text, 0, 13));
+    ASSERT_EQ(10, searcher.find(text, 6, 13));
+    ASSERT_EQ(-1, searcher.find(text, 6, 12));
+}
+
+TEST(LiteralSearcherTest, AgreesWithStringFindAcrossBlocks) {
+    // Long enough to exercise the 16 byte blocks, the block boundaries and the scalar tail
+    std::string text;
+    for (int i = 0; i < 300; ++i)
+	{
+        text += static_cast<char>('a' + (i * 7) % 5);
+	}
+
+    const char *needles[] = { "a", "ab", "cad", "dbeca", "bdaceb", "eeeeeeeeeeeeeeeeeeeeeeee" };
+    for (size_t n = 0; n < sizeof(needles) / sizeof(needles[0]); ++n)
+	{
+        LiteralSearcher searcher(needles[n], static_cast<int>(strlen(needles[n])));
+        for (int start = 0; start < static_cast<int>(text.size()); start += 13)
+		{
+            size_t expected = text.find(needles[n], start);
+            int found = searcher.find(text.c_str(), start, static_cast<int>(text.size()));
+            ASSERT_EQ(expected == std::string::npos ? -1 : static_cast<int>(expected), found);
+		}
+	}
+}
+
+TEST(LiteralSearcherTest, SearchUtf8SameAsRegex) {
+    assertSameAsRegex<Utf8CharTraits>("abc123 def5432 gh98\r\n\xC3\xA4" "bc123 \xC3\xBC" "ef5432 \xC3\xB6h98 bc123bc123\r\n", "bc123");
+    assertSameAsRegex<Utf8CharTraits>("aaa\xC3\xB4" "bbbaaa\xC3\xBC" "bb aaa\xC3\xBC" "bb", "aaa\xC3\xBC");
+    assertSameAsRegex<Utf8CharTraits>("aaa\xF0\x9F\x82\xB7" "ZZZ" "bbbaaa\xF0\x9F\x82\xB8" "ZZZ", "\xF0\x9F\x82\xB8" "ZZZ");
+    assertSameAsRegex<Utf8CharTraits>("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", "aa");
+    assertSameAsRegex<Utf8CharTraits>("abc abc abc abc", "abc", 5);
+}
+
+TEST(LiteralSearcherTest, SearchAnsiSameAsRegex) {
+    assertSameAsRegex<AnsiCharTraits>("aaa\xF0\x9F" "ZZZ" "aaa\x9F\xB8" "ZZZ", "\x9F" "ZZZ");
+    assertSameAsRegex<AnsiCharTraits>("one two three two one two", "two");
+    assertSameAsRegex<AnsiCharTraits>("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", "aaa");
+}
+
+TEST(LiteralSearcherTest, ReplaceSameAsRegex) {
+    assertReplaceSameAsRegex<Utf8CharTraits>("abc123 \xC3\xA4" "bc123 bc123", "bc123", "X");
+    assertReplaceSameAsRegex<Utf8CharTraits>("abc123 \xC3\xA4" "bc123 bc123", "bc123", "[$0]");
+    assertReplaceSameAsRegex<Utf8CharTraits>("abc123 \xC3\xA4" "bc123 bc123", "bc123", "<$`>");
+    assertReplaceSameAsRegex<AnsiCharTraits>("one two three two", "two", "\\n2");
+}
+
+/** A literal that is not valid UTF-8 must not be matched in the middle of a valid character,
+ *  so it is left to the regex engine.
+ */
+TEST(LiteralSearcherTest, InvalidUtf8LiteralSameAsRegex) {
+    assertSameAsRegex<Utf8CharTraits>("\xC3\xA4 \xC3 x", "\xC3");
+}
+
+TEST(LiteralSearcherTest, IgnoreCaseAgreesWithLowercasedFind) {
+    // Long enough to exercise the 16 byte blocks and the scalar tail, with the letters in mixed case
+    std::string text;
+    for (int i = 0; i < 300; ++i)
+	{
+        char c = static_cast<char>('a' + (i * 7) % 5);
+        text += (i % 3) ? c : static_cast<char>(c - 0x20);
+	}
+    std::string lowered(text);
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+
+    const char *needles[] = { "A", "aB", "CAD", "dbEca", "bdaceb", "[", "ca[" };
+    for (size_t n = 0; n < sizeof(needles) / sizeof(needles[0]); ++n)
+	{
+        IgnoreCaseLiteralSearcher searcher(needles[n], static_cast<int>(strlen(needles[n])), LITERAL_ENCODING_UTF8);
+        std::string loweredNeedle(needles[n]);
+        std::transform(loweredNeedle.begin(), loweredNeedle.end(), loweredNeedle.begin(), ::tolower);
+        for (int start = 0; start < static_cast<int>(text.size()); start += 13)
+		{
+            size_t expected = lowered.find(loweredNeedle, start);
+            int matchEnd = -1;
+            int found = searcher.find(text.c_str(), start, static_cast<int>(text.size()), &matchEnd);
+            ASSERT_EQ(expected == std::string::npos ? -1 : static_cast<int>(expected), found);
+            if (found != -1)
+			{
+                ASSERT_EQ(found + static_cast<int>(loweredNeedle.size()), matchEnd);
+			}
+		}
+	}
+}
+
+TEST(LiteralSearcherTest, IgnoreCaseSameAsRegex) {
+    assertSameAsRegex<Utf8CharTraits>("Abc123 dEF5432 gh98\r\n\xC3\x84" "BC123 \xC3\xBC" "ef5432 \xC3\xB6h98 bC123Bc123\r\n", "bc123", 0, python_re_flag_ignorecase);
+    assertSameAsRegex<Utf8CharTraits>("aaa\xC3\x84" "bbbAAA\xC3\xA4" "bb aaa\xC3\x9C" "bb", "AAA\xC3\xA4", 0, python_re_flag_ignorecase);
+    assertSameAsRegex<Utf8CharTraits>("xx\xC3\x84\xC3\xA4xx \xC3\xA4\xC3\x84", "\xC3\x84\xC3\x84", 0, python_re_flag_ignorecase);
+    assertSameAsRegex<Utf8CharTraits>("\xC3 a \xC3\xA4 A", "a", 0, python_re_flag_ignorecase);
+    assertSameAsRegex<AnsiCharTraits>("one TWO three tWo one Two", "two", 0, python_re_flag_ignorecase);
+    assertSameAsRegex<AnsiCharTraits>("[a] [A] {a}", "[A]", 0, python_re_flag_ignorecase);
+}
+
+/** Characters can change length when folding, e.g. KELVIN SIGN (3 bytes) folds to 'k'
+ */
+TEST(LiteralSearcherTest, IgnoreCaseMatchLengthCanDiffer) {
+    const char *text = "ok \xE2\x84\xAA" "ey Key";
+    IgnoreCaseLiteralSearcher searcher("KEY", 3, LITERAL_ENCODING_UTF8);
+    int matchEnd = -1;
+    ASSERT_EQ(3, searcher.find(text, 0, static_cast<int>(strlen(text)), &matchEnd));
+    ASSERT_EQ(8, matchEnd);
+    ASSERT_EQ(9, searcher.find(text, matchEnd, static_cast<int>(strlen(text)), &matchEnd));
+    ASSERT_EQ(12, matchEnd);
+}
+
+}
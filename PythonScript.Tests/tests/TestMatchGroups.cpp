@@ -0,0 +1,102 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "Replacer.h"
+#include "BenchmarkTimer.h"
+
+namespace NppPythonScript
+{
+
+struct GroupState
+{
+    std::vector<GroupDetail> groups;
+    bool outOfRangeFound;
+    bool unknownNameFound;
+};
+
+static bool collectGroups(const char * /* text */, Match *match, void *state)
+{
+    GroupState *groupState = reinterpret_cast<GroupState*>(state);
+    GroupDetail groupDetail;
+    for (int groupNumber = 0; match->group(groupNumber, groupDetail); ++groupNumber)
+	{
+        groupState->groups.push_back(groupDetail);
+	}
+
+    groupState->outOfRangeFound = match->group(-1, groupDetail);
+
+    if (match->groupName("name", groupDetail))
+	{
+        groupState->groups.push_back(groupDetail);
+	}
+    groupState->unknownNameFound = match->groupName("unknown", groupDetail);
+    return false;
+}
+
+TEST(MatchGroupsTest, GroupsAreReturnedByValue) {
+    GroupState state;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.search("xx ac yy", 8, 0, 0, "(a)(b)?(?<name>c)", collectGroups, &state, python_re_flag_normal);
+
+    ASSERT_EQ(5, state.groups.size());
+    ASSERT_EQ(3, state.groups[0].start());
+    ASSERT_EQ(5, state.groups[0].end());
+    ASSERT_TRUE(state.groups[1].matched());
+    ASSERT_EQ(3, state.groups[1].start());
+    ASSERT_FALSE(state.groups[2].matched());
+    ASSERT_EQ(4, state.groups[3].start());
+    ASSERT_EQ(4, state.groups[4].start());
+    ASSERT_EQ(5, state.groups[4].end());
+    ASSERT_FALSE(state.outOfRangeFound);
+    ASSERT_FALSE(state.unknownNameFound);
+}
+
+TEST(MatchGroupsTest, LiteralMatchOnlyHasGroupZero) {
+    GroupState state;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.search("xx ac yy", 8, 0, 0, "ac", collectGroups, &state, python_re_flag_literal);
+
+    ASSERT_EQ(1, state.groups.size());
+    ASSERT_EQ(3, state.groups[0].start());
+    ASSERT_EQ(5, state.groups[0].end());
+    ASSERT_FALSE(state.unknownNameFound);
+}
+
+static bool lookupGroups(const char * /* text */, Match *match, void *state)
+{
+    int *total = reinterpret_cast<int*>(state);
+    GroupDetail groupDetail;
+    for (int repeat = 0; repeat < 10; ++repeat)
+	{
+        for (int groupNumber = 0; groupNumber < 4; ++groupNumber)
+		{
+            if (match->group(groupNumber, groupDetail) && groupDetail.matched())
+			{
+                *total += groupDetail.end() - groupDetail.start();
+			}
+		}
+	}
+    return true;
+}
+
+/** Times group lookups on a document with many matches - before groups were value types, each lookup allocated.
+ */
+TEST(MatchGroupsTest, DISABLED_BenchmarkGroupLookup) {
+    std::string text;
+    for (int i = 0; i < 100000; ++i)
+	{
+        text += "key=value; ";
+	}
+
+    Replacer<Utf8CharTraits> replacer;
+    int total = 0;
+    BenchmarkTimer timer;
+    replacer.search(text.c_str(), static_cast<int>(text.size()), 0, 0, "(\\w+)(=)(\\w+)", lookupGroups, &total, python_re_flag_normal);
+    double elapsed = timer.elapsedMilliseconds();
+
+    ASSERT_EQ(100000 * 10 * 18, total);
+    printf("4,000,000 group lookups over 100,000 matches: %.1fms\n", elapsed);
+}
+
+}
@@ -0,0 +1,128 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "MatchIterator.h"
+
+namespace NppPythonScript
+{
+
+/** A TextSnapshot that the test changes by hand
+ */
+class TestSnapshot : public TextSnapshot
+{
+public:
+    TestSnapshot() : changed(false) {}
+    virtual bool isUnchanged() { return !changed; }
+
+    bool changed;
+};
+
+static void describe(Match *match, std::ostringstream& description)
+{
+    for (int groupNo = 0; groupNo < match->groupCount(); ++groupNo)
+	{
+        GroupDetail groupDetail;
+        match->group(groupNo, groupDetail);
+        description << groupDetail.start() << "-" << groupDetail.end() << (groupDetail.matched() ? " " : "? ");
+	}
+
+    description << match->groupIndexFromName("name") << " ";
+
+    char *expanded;
+    int expandedLength;
+    match->expand("<$`|$&>", &expanded, &expandedLength);
+    description << std::string(expanded, expandedLength) << "\n";
+    delete [] expanded;
+}
+
+static bool describeMatch(const char * /* text */, Match *match, void *state)
+{
+    describe(match, *reinterpret_cast<std::ostringstream*>(state));
+    return true;
+}
+
+template <class CharTraitsT>
+static void assertSameAsReplacer(const std::string& text, const char *pattern, int startPosition = 0, int extraFlags = python_re_flag_normal)
+{
+    const int textLength = static_cast<int>(text.size());
+    const python_re_flags flags = static_cast<python_re_flags>(extraFlags);
+
+    std::ostringstream expected;
+    Replacer<CharTraitsT> replacer;
+    replacer.search(text.c_str(), textLength, startPosition, 0, pattern, describeMatch, &expected, flags);
+
+    std::ostringstream actual;
+    RegexMatchIterator<CharTraitsT> iterator(text.c_str(), textLength, startPosition, pattern, flags, boost::shared_ptr<TextSnapshot>(new TestSnapshot()));
+    for (boost::shared_ptr<Match> match = iterator.next(); match; match = iterator.next())
+	{
+        describe(match.get(), actual);
+	}
+
+    ASSERT_EQ(expected.str(), actual.str()) << pattern;
+    ASSERT_EQ(replacer.getStats().matches, iterator.getStats().matches) << pattern;
+
+    // Stays finished
+    ASSERT_FALSE(iterator.next());
+}
+
+TEST(MatchIteratorTest, SameMatchesAsReplacer) {
+    const std::string text = "ERROR 12 first\r\nkey=value ERROR 345\r\n\r\nx=1 y=22\n\xC3\xA4\xC3\xB6 error 6";
+    const char *patterns[] = { "ERROR (\\d+)", "^(\\w+)=(\\w*)", "(?<name>[a-z])=(\\d+)", "x*", "^", "$", "\\b", "(a)|(b)|(ERROR)",
+                               "value ERROR", "\\s+ERROR \\d+", "\xC3\xB6|\\d" };
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); ++i)
+	{
+        assertSameAsReplacer<Utf8CharTraits>(text, patterns[i]);
+        assertSameAsReplacer<AnsiCharTraits>(text, patterns[i]);
+	}
+
+    assertSameAsReplacer<Utf8CharTraits>(text, "ERROR \\d+", 10);
+    assertSameAsReplacer<Utf8CharTraits>(text, "error \\d+", 0, python_re_flag_ignorecase);
+    assertSameAsReplacer<Utf8CharTraits>(text, "^x.*", 0, python_re_flag_dotall | python_re_flag_wholedoc);
+}
+
+TEST(MatchIteratorTest, MatchesOutliveTheIterator) {
+    const std::string text = "a1 b22 c333";
+    std::vector<boost::shared_ptr<Match> > matches;
+	{
+        RegexMatchIterator<Utf8CharTraits> iterator(text.c_str(), static_cast<int>(text.size()), 0, "([a-z])(\\d+)", python_re_flag_normal,
+                                                    boost::shared_ptr<TextSnapshot>(new TestSnapshot()));
+        for (boost::shared_ptr<Match> match = iterator.next(); match; match = iterator.next())
+		{
+            matches.push_back(match);
+		}
+	}
+
+    ASSERT_EQ(3, matches.size());
+    const char *expected[] = { "1", "22", "333" };
+    for (size_t i = 0; i < matches.size(); ++i)
+	{
+        GroupDetail digits;
+        ASSERT_TRUE(matches[i]->group(2, digits));
+        ASSERT_EQ(expected[i], matches[i]->getTextForGroup(digits));
+	}
+}
+
+TEST(MatchIteratorTest, ThrowsWhenTheTextChanges) {
+    const std::string text = "a1 b22 c333";
+    boost::shared_ptr<TestSnapshot> snapshot(new TestSnapshot());
+    RegexMatchIterator<Utf8CharTraits> iterator(text.c_str(), static_cast<int>(text.size()), 0, "[a-z](\\d+)", python_re_flag_normal, snapshot);
+
+    boost::shared_ptr<Match> first = iterator.next();
+    ASSERT_TRUE(first);
+
+    snapshot->changed = true;
+    ASSERT_THROW(iterator.next(), TextChangedException);
+
+    // The positions are still there, but not the text
+    GroupDetail group;
+    ASSERT_TRUE(first->group(1, group));
+    ASSERT_EQ(1, group.start());
+    ASSERT_THROW(first->getTextForGroup(group), TextChangedException);
+
+    char *expanded;
+    int expandedLength;
+    ASSERT_THROW(first->expand("$1", &expanded, &expandedLength), TextChangedException);
+}
+
+}
@@ -0,0 +1,361 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "Replacer.h"
+#include "MultiLiteralSearcher.h"
+#include "BenchmarkTimer.h"
+
+namespace NppPythonScript
+{
+
+static void describe(Match *match, std::ostringstream& description)
+{
+    GroupDetail fullMatch;
+    match->group(0, fullMatch);
+
+    char *expanded;
+    int expandedLength;
+    match->expand("<$`|$&>", &expanded, &expandedLength);
+    description << fullMatch.start() << "-" << fullMatch.end() << " " << std::string(expanded, expandedLength) << "\n";
+    delete [] expanded;
+}
+
+static bool describeMatch(const char * /* text */, Match *match, void *state)
+{
+    describe(match, *reinterpret_cast<std::ostringstream*>(state));
+    return true;
+}
+
+static bool describeKeywordMatch(const char * /* text */, int keyword, Match *match, void *state)
+{
+    std::vector<std::string> *descriptions = reinterpret_cast<std::vector<std::string> *>(state);
+    std::ostringstream description;
+    describe(match, description);
+    (*descriptions)[keyword] += description.str();
+    return true;
+}
+
+/** Checks that searchMany() finds the same matches for each keyword as a plain search() for it
+ */
+template <class CharTraitsT>
+static void assertSameAsSearches(const std::string& text, const char **keywords, size_t keywordCount, int startPosition = 0, int extraFlags = 0)
+{
+    const int textLength = static_cast<int>(text.size());
+    std::vector<std::string> keywordList(keywords, keywords + keywordCount);
+
+    std::vector<std::string> actual(keywordCount);
+    Replacer<CharTraitsT> manyReplacer;
+    manyReplacer.searchMany(text.c_str(), textLength, startPosition, keywordList, describeKeywordMatch, &actual, static_cast<python_re_flags>(extraFlags));
+
+    long totalMatches = 0;
+    for (size_t keyword = 0; keyword < keywordCount; ++keyword)
+	{
+        std::ostringstream expected;
+        Replacer<CharTraitsT> replacer;
+        if ('\0' != keywords[keyword][0])
+		{
+            replacer.search(text.c_str(), textLength, startPosition, 0, keywords[keyword], describeMatch, &expected,
+                            static_cast<python_re_flags>(python_re_flag_literal | extraFlags));
+		}
+        totalMatches += replacer.getStats().matches;
+        ASSERT_EQ(expected.str(), actual[keyword]) << keywords[keyword];
+	}
+    ASSERT_EQ(totalMatches, manyReplacer.getStats().matches);
+}
+
+TEST(MultiLiteralSearcherTest, SameAsSeparateSearches) {
+    const std::string text = "ushers said his hers, she sells aaaa shells\r\nhe said \"hehe\"";
+    const char *keywords[] = { "he", "she", "his", "hers", "aa", "s", "shells\r\n", "x", "he", "" };
+    assertSameAsSearches<Utf8CharTraits>(text, keywords, sizeof(keywords) / sizeof(keywords[0]));
+    assertSameAsSearches<AnsiCharTraits>(text, keywords, sizeof(keywords) / sizeof(keywords[0]));
+    assertSameAsSearches<Utf8CharTraits>(text, keywords, sizeof(keywords) / sizeof(keywords[0]), 9);
+}
+
+TEST(MultiLiteralSearcherTest, IgnoringCase) {
+    const std::string text = "He SAID \"hEhE\" to HIS sister\r\n";
+    const char *keywords[] = { "he", "SHE", "his", "Said", "sister\r" };
+    assertSameAsSearches<Utf8CharTraits>(text, keywords, sizeof(keywords) / sizeof(keywords[0]), 0, python_re_flag_ignorecase);
+    assertSameAsSearches<AnsiCharTraits>(text, keywords, sizeof(keywords) / sizeof(keywords[0]), 0, python_re_flag_ignorecase);
+}
+
+TEST(MultiLiteralSearcherTest, Utf8IgnoringCase) {
+    // KELVIN SIGN folds to k, so matches can be a different length to the keyword
+    const std::string text = "\xC3\x84pfel \xE2\x84\xAAilo kilo \xC3\xA4PFEL \xC3\x9C" "ber";
+    const char *keywords[] = { "\xC3\xA4pfel", "KILO", "\xC3\xBC" "BER", "k", "\xC3\xA4" };
+    assertSameAsSearches<Utf8CharTraits>(text, keywords, sizeof(keywords) / sizeof(keywords[0]), 0, python_re_flag_ignorecase);
+    assertSameAsSearches<Utf8CharTraits>(text, keywords, sizeof(keywords) / sizeof(keywords[0]));
+}
+
+static bool recordOccurrence(int keyword, int start, int end, void *state)
+{
+    std::ostringstream *description = reinterpret_cast<std::ostringstream*>(state);
+    *description << keyword << ":" << start << "-" << end << " ";
+    return true;
+}
+
+static bool stopAfterThird(int /* keyword */, int /* start */, int /* end */, void *state)
+{
+    return ++*reinterpret_cast<int*>(state) < 3;
+}
+
+TEST(MultiLiteralSearcherTest, ReportsInOrderOfEnd) {
+    std::vector<std::string> keywords;
+    keywords.push_back("he");
+    keywords.push_back("she");
+    keywords.push_back("hers");
+    keywords.push_back("e");
+    MultiLiteralSearcher searcher(keywords, false, LITERAL_ENCODING_UTF8);
+
+    const char *text = "ushers";
+    std::ostringstream description;
+    searcher.findAll(text, 0, static_cast<int>(strlen(text)), recordOccurrence, &description);
+    ASSERT_EQ("1:1-4 0:2-4 3:3-4 2:2-6 ", description.str());
+
+    int count = 0;
+    searcher.findAll("eeeee", 0, 5, stopAfterThird, &count);
+    ASSERT_EQ(3, count);
+}
+
+TEST(MultiLiteralSearcherTest, StaysWithinTheRange) {
+    std::vector<std::string> keywords;
+    keywords.push_back("abc");
+    MultiLiteralSearcher searcher(keywords, false, LITERAL_ENCODING_ANSI);
+
+    std::ostringstream description;
+    searcher.findAll("abcabcabc", 1, 8, recordOccurrence, &description);
+    ASSERT_EQ("0:3-6 ", description.str());
+}
+
+TEST(MultiLiteralSearcherTest, CachesByKeywords) {
+    std::vector<std::string> keywords;
+    keywords.push_back("one");
+    keywords.push_back("two");
+
+    boost::shared_ptr<const MultiLiteralSearcher> first = MultiLiteralSearcher::get(keywords, false, LITERAL_ENCODING_UTF8);
+    ASSERT_EQ(first, MultiLiteralSearcher::get(keywords, false, LITERAL_ENCODING_UTF8));
+    ASSERT_NE(first, MultiLiteralSearcher::get(keywords, true, LITERAL_ENCODING_UTF8));
+    ASSERT_NE(first, MultiLiteralSearcher::get(keywords, false, LITERAL_ENCODING_ANSI));
+
+    keywords.push_back("three");
+    ASSERT_NE(first, MultiLiteralSearcher::get(keywords, false, LITERAL_ENCODING_UTF8));
+}
+
+static void findLeftmostLongest(const char *text, const char **keywords, size_t keywordCount, std::ostringstream& description)
+{
+    MultiLiteralSearcher searcher(std::vector<std::string>(keywords, keywords + keywordCount), false, LITERAL_ENCODING_ANSI);
+    searcher.findLeftmostLongest(text, 0, static_cast<int>(strlen(text)), recordOccurrence, &description);
+}
+
+TEST(MultiLiteralSearcherTest, LeftmostLongest) {
+    const char *keywords[] = { "he", "she", "hers", "e" };
+    std::ostringstream description;
+    findLeftmostLongest("ushers", keywords, sizeof(keywords) / sizeof(keywords[0]), description);
+    ASSERT_EQ("1:1-4 ", description.str());
+}
+
+TEST(MultiLiteralSearcherTest, LeftmostLongestAfterOverlaps) {
+    // The "aa" at 1 overlaps the "ba", so the next one starts at 2
+    const char *keywords[] = { "ba", "aa" };
+    std::ostringstream description;
+    findLeftmostLongest("baaa", keywords, sizeof(keywords) / sizeof(keywords[0]), description);
+    ASSERT_EQ("0:0-2 1:2-4 ", description.str());
+
+    // "abcd" could still start at 0 when "c" is found, so both are held back until it can't
+    const char *partialKeywords[] = { "abcd", "ab", "c", "ab" };
+    std::ostringstream partialDescription;
+    findLeftmostLongest("abcab", partialKeywords, sizeof(partialKeywords) / sizeof(partialKeywords[0]), partialDescription);
+    ASSERT_EQ("1:0-2 2:2-3 1:3-5 ", partialDescription.str());
+}
+
+/** Leftmost-longest, by trying every keyword at every position
+ */
+static std::string bruteForceLeftmostLongest(const std::string& text, const std::vector<std::string>& keywords)
+{
+    std::ostringstream description;
+    size_t position = 0;
+    while (position < text.size())
+	{
+        int best = -1;
+        for (size_t keyword = 0; keyword < keywords.size(); ++keyword)
+		{
+            if (!keywords[keyword].empty() && 0 == text.compare(position, keywords[keyword].size(), keywords[keyword])
+                && (-1 == best || keywords[keyword].size() > keywords[best].size()))
+			{
+                best = static_cast<int>(keyword);
+			}
+		}
+
+        if (-1 == best)
+		{
+            ++position;
+		}
+        else
+		{
+            description << best << ":" << position << "-" << position + keywords[best].size() << " ";
+            position += keywords[best].size();
+		}
+	}
+    return description.str();
+}
+
+TEST(MultiLiteralSearcherTest, LeftmostLongestSameAsBruteForce) {
+    unsigned int seed = 12345;
+    for (int round = 0; round < 200; ++round)
+	{
+        // Few letters, so there are lots of overlaps
+        std::string text;
+        std::vector<std::string> keywords(1 + round % 7);
+        for (int i = 0; i < 60; ++i)
+		{
+            seed = seed * 1103515245 + 12345;
+            text += static_cast<char>('a' + (seed >> 16) % 3);
+		}
+        for (size_t keyword = 0; keyword < keywords.size(); ++keyword)
+		{
+            seed = seed * 1103515245 + 12345;
+            const size_t start = (seed >> 16) % 50;
+            seed = seed * 1103515245 + 12345;
+            keywords[keyword] = text.substr(start, 1 + (seed >> 16) % 5);
+		}
+
+        MultiLiteralSearcher searcher(keywords, false, LITERAL_ENCODING_ANSI);
+        std::ostringstream description;
+        searcher.findLeftmostLongest(text.c_str(), 0, static_cast<int>(text.size()), recordOccurrence, &description);
+        ASSERT_EQ(bruteForceLeftmostLongest(text, keywords), description.str()) << text;
+	}
+}
+
+static std::string applyReplacements(const std::string& text, const ReplacementBatch& batch)
+{
+    std::string result;
+    int position = 0;
+    for (ReplacementBatch::const_iterator it = batch.begin(); it != batch.end(); ++it)
+	{
+        result.append(text, position, it->start - position);
+        result.append(batch.getReplacement(*it), it->length);
+        position = it->end;
+	}
+    result.append(text, position, std::string::npos);
+    return result;
+}
+
+TEST(MultiLiteralSearcherTest, ReplaceMany) {
+    const std::string text = "The cat sat on the mat, then the cats sat";
+    std::vector<std::string> keywords;
+    std::vector<std::string> replacements;
+    keywords.push_back("the");    replacements.push_back("a");
+    keywords.push_back("cat");    replacements.push_back("dog");
+    keywords.push_back("cats");   replacements.push_back("$1");
+    keywords.push_back("at");     replacements.push_back("");
+
+    ReplacementBatch batch;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.startReplaceMany(text.c_str(), static_cast<int>(text.size()), 0, keywords, replacements, python_re_flag_normal, batch);
+    ASSERT_EQ("The dog s on a m, an a $1 s", applyReplacements(text, batch));
+    ASSERT_EQ(8, replacer.getStats().matches);
+
+    batch.clear();
+    replacer.startReplaceMany(text.c_str(), static_cast<int>(text.size()), 4, keywords, replacements, python_re_flag_ignorecase, batch);
+    ASSERT_EQ("The dog s on a m, an a $1 s", applyReplacements(text, batch));
+
+    batch.clear();
+    replacer.startReplaceMany(text.c_str(), static_cast<int>(text.size()), 0, keywords, replacements, python_re_flag_ignorecase, batch);
+    ASSERT_EQ("a dog s on a m, an a $1 s", applyReplacements(text, batch));
+}
+
+static bool countMatches(const char * /* text */, Match * /* match */, void *state)
+{
+    ++*reinterpret_cast<long*>(state);
+    return true;
+}
+
+static bool countKeywordMatches(const char * /* text */, int /* keyword */, Match * /* match */, void *state)
+{
+    ++*reinterpret_cast<long*>(state);
+    return true;
+}
+
+TEST(MultiLiteralSearcherTest, DISABLED_BenchmarkKeywords) {
+    // About 16MB of words, searched for 500 of them
+    std::vector<std::string> keywords;
+    for (int keyword = 0; keyword < 500; ++keyword)
+	{
+        std::ostringstream word;
+        word << "token" << (keyword * 7919) % 100000;
+        keywords.push_back(word.str());
+	}
+
+    std::string text;
+    for (int word = 0; text.size() < 16 * 1024 * 1024; ++word)
+	{
+        std::ostringstream line;
+        line << "name" << word % 1000 << " = token" << (word * 31) % 100000 << "; // value " << word << "\r\n";
+        text += line.str();
+	}
+    const int textLength = static_cast<int>(text.size());
+
+    long separateMatches = 0;
+    BenchmarkTimer separateTimer;
+    for (std::vector<std::string>::const_iterator it = keywords.begin(); it != keywords.end(); ++it)
+	{
+        Replacer<Utf8CharTraits> replacer;
+        replacer.search(text.c_str(), textLength, 0, 0, it->c_str(), countMatches, &separateMatches, python_re_flag_literal);
+	}
+    double separateTime = separateTimer.elapsedMilliseconds();
+
+    long manyMatches = 0;
+    BenchmarkTimer manyTimer;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.searchMany(text.c_str(), textLength, 0, keywords, countKeywordMatches, &manyMatches, python_re_flag_normal);
+    double manyTime = manyTimer.elapsedMilliseconds();
+
+    ASSERT_EQ(separateMatches, manyMatches);
+    printf("%d bytes, %d keywords, %ld matches: separate searches %.1fms, searchMany %.1fms\n",
+           textLength, static_cast<int>(keywords.size()), manyMatches, separateTime, manyTime);
+}
+
+TEST(MultiLiteralSearcherTest, DISABLED_BenchmarkReplaceMany) {
+    // About 16MB of words, with 300 of them replaced
+    std::vector<std::string> keywords;
+    std::vector<std::string> replacements;
+    for (int keyword = 0; keyword < 300; ++keyword)
+	{
+        std::ostringstream word;
+        word << "token" << (keyword * 7919) % 100000 << ";";
+        keywords.push_back(word.str());
+        replacements.push_back("replaced;");
+	}
+
+    std::string text;
+    for (int word = 0; text.size() < 16 * 1024 * 1024; ++word)
+	{
+        std::ostringstream line;
+        line << "name" << word % 1000 << " = token" << (word * 31) % 100000 << "; // value " << word << "\r\n";
+        text += line.str();
+	}
+    const int textLength = static_cast<int>(text.size());
+
+    size_t separateReplacements = 0;
+    BenchmarkTimer separateTimer;
+    for (size_t keyword = 0; keyword < keywords.size(); ++keyword)
+	{
+        ReplacementBatch batch;
+        Replacer<Utf8CharTraits> replacer;
+        replacer.startReplace(text.c_str(), textLength, 0, 0, keywords[keyword].c_str(), replacements[keyword].c_str(), python_re_flag_literal, batch);
+        separateReplacements += batch.size();
+	}
+    double separateTime = separateTimer.elapsedMilliseconds();
+
+    BenchmarkTimer manyTimer;
+    ReplacementBatch batch;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.startReplaceMany(text.c_str(), textLength, 0, keywords, replacements, python_re_flag_normal, batch);
+    double manyTime = manyTimer.elapsedMilliseconds();
+
+    ASSERT_EQ(separateReplacements, batch.size());
+    printf("%d bytes, %d keywords, %d replacements: separate replaces %.1fms, replaceMany %.1fms\n",
+           textLength, static_cast<int>(keywords.size()), static_cast<int>(batch.size()), separateTime, manyTime);
+}
+
+}
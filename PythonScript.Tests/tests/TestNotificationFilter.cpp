@@ -0,0 +1,122 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "NotificationFilter.h"
+#include "Scintilla.h"
+
+namespace NppPythonScript
+{
+
+SCNotification makeFilterNotification(unsigned int code)
+{
+    SCNotification notifyCode;
+    memset(&notifyCode, 0, sizeof(notifyCode));
+    notifyCode.nmhdr.code = code;
+    return notifyCode;
+}
+
+TEST(NotificationFilterTest, EmptyFilterMatchesEverything) {
+    NotificationFilter filter;
+    ASSERT_TRUE(filter.isEmpty());
+    SCNotification notifyCode = makeFilterNotification(SCN_MODIFIED);
+    notifyCode.modificationType = SC_MOD_CHANGESTYLE;
+    ASSERT_FALSE(filter.needsLine(&notifyCode));
+    ASSERT_TRUE(filter.matches(&notifyCode, -1));
+}
+
+TEST(NotificationFilterTest, ModificationTypeMaskNeedsOneOfTheFlags) {
+    NotificationFilter filter;
+    filter.setModificationTypes(SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT);
+    ASSERT_FALSE(filter.isEmpty());
+
+    SCNotification notifyCode = makeFilterNotification(SCN_MODIFIED);
+    notifyCode.modificationType = SC_MOD_INSERTTEXT | SC_PERFORMED_USER;
+    ASSERT_TRUE(filter.matches(&notifyCode, -1));
+    notifyCode.modificationType = SC_MOD_CHANGESTYLE | SC_PERFORMED_USER;
+    ASSERT_FALSE(filter.matches(&notifyCode, -1));
+}
+
+TEST(NotificationFilterTest, PartsOnlyApplyToNotificationsWithTheField) {
+    NotificationFilter filter;
+    filter.setModificationTypes(SC_MOD_INSERTTEXT);
+    filter.setMinLength(5);
+    filter.setLines(10, 20);
+
+    SCNotification notifyCode = makeFilterNotification(SCN_CHARADDED);
+    notifyCode.ch = 'a';
+    ASSERT_FALSE(filter.needsLine(&notifyCode));
+    ASSERT_TRUE(filter.matches(&notifyCode, -1));
+
+    notifyCode = makeFilterNotification(SCN_CALLTIPCLICK);
+    notifyCode.position = 1;
+    ASSERT_FALSE(filter.needsLine(&notifyCode));
+    ASSERT_TRUE(filter.matches(&notifyCode, -1));
+}
+
+TEST(NotificationFilterTest, MinLengthCountsForModifiedAndNeedShown) {
+    NotificationFilter filter;
+    filter.setMinLength(3);
+
+    SCNotification notifyCode = makeFilterNotification(SCN_MODIFIED);
+    notifyCode.modificationType = SC_MOD_INSERTTEXT;
+    notifyCode.length = 2;
+    ASSERT_FALSE(filter.matches(&notifyCode, -1));
+    notifyCode.length = 3;
+    ASSERT_TRUE(filter.matches(&notifyCode, -1));
+
+    notifyCode = makeFilterNotification(SCN_NEEDSHOWN);
+    notifyCode.length = 1;
+    ASSERT_FALSE(filter.matches(&notifyCode, -1));
+}
+
+TEST(NotificationFilterTest, CharactersFilterCharAdded) {
+    NotificationFilter filter;
+    std::vector<int> characters;
+    characters.push_back('}');
+    characters.push_back('(');
+    characters.push_back(0x20ac);
+    filter.setCharacters(characters);
+
+    SCNotification notifyCode = makeFilterNotification(SCN_CHARADDED);
+    notifyCode.ch = '(';
+    ASSERT_TRUE(filter.matches(&notifyCode, -1));
+    notifyCode.ch = 0x20ac;
+    ASSERT_TRUE(filter.matches(&notifyCode, -1));
+    notifyCode.ch = 'x';
+    ASSERT_FALSE(filter.matches(&notifyCode, -1));
+}
+
+TEST(NotificationFilterTest, LinesNeedThePositionToBeInRange) {
+    NotificationFilter filter;
+    filter.setLines(10, 20);
+
+    SCNotification notifyCode = makeFilterNotification(SCN_MARGINCLICK);
+    notifyCode.position = 500;
+    ASSERT_TRUE(filter.needsLine(&notifyCode));
+    ASSERT_TRUE(filter.matches(&notifyCode, 10));
+    ASSERT_TRUE(filter.matches(&notifyCode, 20));
+    ASSERT_FALSE(filter.matches(&notifyCode, 9));
+    ASSERT_FALSE(filter.matches(&notifyCode, 21));
+
+    notifyCode.position = -1;
+    ASSERT_FALSE(filter.needsLine(&notifyCode));
+    ASSERT_FALSE(filter.matches(&notifyCode, -1));
+}
+
+TEST(NotificationFilterTest, LinesMatchAnInsertThatReachesTheRange) {
+    NotificationFilter filter;
+    filter.setLines(10, 20);
+
+    SCNotification notifyCode = makeFilterNotification(SCN_MODIFIED);
+    notifyCode.modificationType = SC_MOD_INSERTTEXT;
+    notifyCode.linesAdded = 3;
+    ASSERT_TRUE(filter.matches(&notifyCode, 7));
+    ASSERT_FALSE(filter.matches(&notifyCode, 6));
+
+    notifyCode.modificationType = SC_MOD_DELETETEXT;
+    notifyCode.linesAdded = -3;
+    ASSERT_FALSE(filter.matches(&notifyCode, 7));
+}
+
+}
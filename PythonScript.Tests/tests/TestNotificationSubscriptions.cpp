@@ -0,0 +1,78 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "NotificationSubscriptions.h"
+
+namespace NppPythonScript
+{
+
+typedef std::multimap<int, int> CallbackMap;
+
+TEST(NotificationSubscriptionsTest, NothingIsSubscribedAtFirst) {
+    NotificationSubscriptions subscriptions;
+    ASSERT_FALSE(subscriptions.isSubscribed(2001));
+    ASSERT_FALSE(subscriptions.isSubscribed(NotificationSubscriptions::FIRST_CODE));
+    ASSERT_FALSE(subscriptions.isSubscribed(0));
+    ASSERT_FALSE(subscriptions.isSubscribed(-100));
+}
+
+TEST(NotificationSubscriptionsTest, OnlyTheCodesInTheMapAreSubscribed) {
+    CallbackMap callbacks;
+    callbacks.insert(std::make_pair(2001, 1));
+    callbacks.insert(std::make_pair(2001, 2));
+    callbacks.insert(std::make_pair(2008, 3));
+    callbacks.insert(std::make_pair(2040, 4));
+    NotificationSubscriptions subscriptions;
+    subscriptions.update(callbacks.begin(), callbacks.end());
+
+    for (int code = NotificationSubscriptions::FIRST_CODE; code < NotificationSubscriptions::FIRST_CODE + NotificationSubscriptions::CODE_COUNT; ++code)
+	{
+        ASSERT_EQ(code == 2001 || code == 2008 || code == 2040, subscriptions.isSubscribed(code)) << "code " << code;
+	}
+    ASSERT_FALSE(subscriptions.isSubscribed(1000));
+}
+
+TEST(NotificationSubscriptionsTest, TheLastCodeInEachWordCanBeSubscribed) {
+    CallbackMap callbacks;
+    callbacks.insert(std::make_pair(NotificationSubscriptions::FIRST_CODE + 31, 1));
+    callbacks.insert(std::make_pair(NotificationSubscriptions::FIRST_CODE + 63, 2));
+    NotificationSubscriptions subscriptions;
+    subscriptions.update(callbacks.begin(), callbacks.end());
+
+    ASSERT_TRUE(subscriptions.isSubscribed(NotificationSubscriptions::FIRST_CODE + 31));
+    ASSERT_TRUE(subscriptions.isSubscribed(NotificationSubscriptions::FIRST_CODE + 63));
+    ASSERT_FALSE(subscriptions.isSubscribed(NotificationSubscriptions::FIRST_CODE + 30));
+    ASSERT_FALSE(subscriptions.isSubscribed(NotificationSubscriptions::FIRST_CODE + 32));
+}
+
+TEST(NotificationSubscriptionsTest, CodesOutsideTheBitmapAreAllSubscribedTogether) {
+    CallbackMap callbacks;
+    callbacks.insert(std::make_pair(5, 1));
+    NotificationSubscriptions subscriptions;
+    subscriptions.update(callbacks.begin(), callbacks.end());
+
+    // notify() finds that there are no callbacks for 6 from the map
+    ASSERT_TRUE(subscriptions.isSubscribed(5));
+    ASSERT_TRUE(subscriptions.isSubscribed(6));
+    ASSERT_TRUE(subscriptions.isSubscribed(NotificationSubscriptions::FIRST_CODE + NotificationSubscriptions::CODE_COUNT));
+    ASSERT_FALSE(subscriptions.isSubscribed(2001));
+}
+
+TEST(NotificationSubscriptionsTest, UpdateRemovesCodesNoLongerInTheMap) {
+    CallbackMap callbacks;
+    callbacks.insert(std::make_pair(2001, 1));
+    callbacks.insert(std::make_pair(5, 2));
+    NotificationSubscriptions subscriptions;
+    subscriptions.update(callbacks.begin(), callbacks.end());
+
+    callbacks.erase(5);
+    subscriptions.update(callbacks.begin(), callbacks.end());
+    ASSERT_TRUE(subscriptions.isSubscribed(2001));
+    ASSERT_FALSE(subscriptions.isSubscribed(5));
+
+    subscriptions.clear();
+    ASSERT_FALSE(subscriptions.isSubscribed(2001));
+}
+
+}
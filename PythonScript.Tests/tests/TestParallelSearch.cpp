@@ -0,0 +1,267 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "ParallelSearch.h"
+#include "BenchmarkTimer.h"
+
+namespace NppPythonScript
+{
+
+/** Records everything the Python callback could see of each match: the groups, a named group and the expanded prefix
+ */
+static bool describeMatch(const char * /* text */, Match *match, void *state)
+{
+    std::ostringstream *description = reinterpret_cast<std::ostringstream*>(state);
+    for (int groupNo = 0; groupNo < match->groupCount(); ++groupNo)
+	{
+        GroupDetail groupDetail;
+        match->group(groupNo, groupDetail);
+        *description << groupDetail.start() << "-" << groupDetail.end() << (groupDetail.matched() ? " " : "? ");
+	}
+
+    *description << match->groupIndexFromName("name") << " ";
+
+    char *expanded;
+    int expandedLength;
+    match->expand("<$`>", &expanded, &expandedLength);
+    *description << std::string(expanded, expandedLength) << "\n";
+    delete [] expanded;
+    return true;
+}
+
+static bool stopAfterSecondMatch(const char * /* text */, Match * /* match */, void *state)
+{
+    int *count = reinterpret_cast<int*>(state);
+    return ++*count < 2;
+}
+
+/** Searches in small chunks on a few threads, and checks the matches are the same as from a Replacer
+ */
+template <class CharTraitsT>
+static void assertSameAsReplacer(const std::string& text, const char *pattern, int startPosition = 0, int maxCount = 0, int extraFlags = python_re_flag_normal)
+{
+    ASSERT_TRUE(ParallelSearchBase::isLineLocal(pattern)) << pattern;
+
+    const int textLength = static_cast<int>(text.size());
+    const python_re_flags flags = static_cast<python_re_flags>(extraFlags);
+
+    std::ostringstream expected;
+    Replacer<CharTraitsT> replacer;
+    replacer.search(text.c_str(), textLength, startPosition, maxCount, pattern, describeMatch, &expected, flags);
+
+    for (int chunkSize = 1; chunkSize < 40; chunkSize += 7)
+	{
+        std::ostringstream actual;
+        ParallelSearch<CharTraitsT> parallelSearch(text.c_str(), textLength, startPosition, maxCount, pattern, flags);
+        ASSERT_TRUE(parallelSearch.run(3, chunkSize));
+        parallelSearch.reportMatches(describeMatch, &actual);
+
+        ASSERT_EQ(expected.str(), actual.str()) << pattern << " in chunks of " << chunkSize;
+        ASSERT_EQ(replacer.getStats().matches, parallelSearch.getStats().matches);
+        ASSERT_LT(1, parallelSearch.getStats().parallelChunks);
+	}
+}
+
+static std::string testText()
+{
+    return "first line\r\n"
+           "ERROR 1234 at the start\r\n"
+           "\r\n"
+           "  indented ERROR 99 and ERROR 5678\n"
+           "key=value\n"
+           "\n"
+           "\n"
+           "a\xC3\xA4\xC3\xB6 b\xC3\xBC wide \xE2\x82\xAC chars\r\n"
+           "x=1 y=22 z=333\r\n"
+           "last line without a newline";
+}
+
+TEST(ParallelSearchTest, LineLocalPatterns) {
+    const char *lineLocal[] = { "ERROR \\d{4}", "^(\\w+)=(\\w*)$", "[a-z]+", "[[:alpha:]_]+", "(?:ab|cd)e", "\\bfoo\\b", "(?<=x)y", "(?!a)b",
+                                "(?<name>\\w+) \\1", "a.*b", "[\\t ]+", "\\h+", "a\\.b\\(c\\)", "x*", "" };
+    for (size_t i = 0; i < sizeof(lineLocal) / sizeof(lineLocal[0]); ++i)
+	{
+        ASSERT_TRUE(ParallelSearchBase::isLineLocal(lineLocal[i])) << lineLocal[i];
+	}
+
+    const char *notLineLocal[] = { "a\\nb", "a\nb", "a\\sb", "\\W", "\\D", "\\v", "\\R", "[^x]", "[\\s]", "[[:space:]]", "[\\t-\\r]",
+                                   "[\\x00-z]", "\\x0a", "\\012", "(?s)a.b", "(?x)a # comment", "\\Aabc", "abc\\z", "abc\\Z", "\\`", "\\'",
+                                   "\\Gx", "\\Qa\\E", "(*SKIP)", "\\p{L}", "\\k<name>", "\\12", "a\\" };
+    for (size_t i = 0; i < sizeof(notLineLocal) / sizeof(notLineLocal[0]); ++i)
+	{
+        ASSERT_FALSE(ParallelSearchBase::isLineLocal(notLineLocal[i])) << notLineLocal[i];
+	}
+}
+
+TEST(ParallelSearchTest, CanSearchNeedsLineLocalPatternAndFlags) {
+    const int length = ParallelSearchBase::getThreshold();
+    if (ParallelSearchBase::processorCount() > 1)
+	{
+        ASSERT_TRUE(ParallelSearchBase::canSearch(length, "ERROR \\d+", python_re_flag_normal));
+	}
+    ASSERT_FALSE(ParallelSearchBase::canSearch(length - 1, "ERROR \\d+", python_re_flag_normal));
+    ASSERT_FALSE(ParallelSearchBase::canSearch(length, "ERROR\\s+\\d+", python_re_flag_normal));
+    ASSERT_FALSE(ParallelSearchBase::canSearch(length, "ERROR.\\d+", python_re_flag_dotall));
+    ASSERT_FALSE(ParallelSearchBase::canSearch(length, "^ERROR", python_re_flag_wholedoc));
+    ASSERT_FALSE(ParallelSearchBase::canSearch(length, "ERROR", python_re_flag_literal));
+    ASSERT_FALSE(ParallelSearchBase::canSearch(length, "ERROR", python_re_flag_lines));
+}
+
+/** Adds the start and end of each match to the std::vector<int> in state
+ */
+static bool collectMatchPositions(const char * /* text */, Match *match, void *state)
+{
+    std::vector<int> *positions = reinterpret_cast<std::vector<int>*>(state);
+    GroupDetail fullMatch;
+    match->group(0, fullMatch);
+    positions->push_back(fullMatch.start());
+    positions->push_back(fullMatch.end());
+    return true;
+}
+
+TEST(ParallelSearchTest, CanSearchLinesTogetherWithoutCarriageReturns) {
+    std::string text = testText();
+    ASSERT_FALSE(ParallelSearchBase::canSearchLinesTogether(text.c_str(), 0, static_cast<int>(text.size()), "^\\w+", python_re_flag_lines));
+
+    text.erase(std::remove(text.begin(), text.end(), '\r'), text.end());
+    const int textLength = static_cast<int>(text.size());
+    const python_re_flags lines = python_re_flag_lines;
+    ASSERT_FALSE(ParallelSearchBase::canSearchLinesTogether(text.c_str(), 0, textLength, "\\s+", lines));
+    ASSERT_FALSE(ParallelSearchBase::canSearchLinesTogether(text.c_str(), 0, textLength, "^\\w+", static_cast<python_re_flags>(lines | python_re_flag_includelineendings)));
+    ASSERT_FALSE(ParallelSearchBase::canSearchLinesTogether(text.c_str(), 0, textLength, "^\\w+", static_cast<python_re_flags>(lines | python_re_flag_dotall)));
+
+    // When it can, searching each line on its own finds the same matches
+    const char *patterns[] = { "^\\w+", "\\w+$", "x*", "^", "$", "\\b", "e(?=[ ])" };
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); ++i)
+	{
+        ASSERT_TRUE(ParallelSearchBase::canSearchLinesTogether(text.c_str(), 0, textLength, patterns[i], lines)) << patterns[i];
+
+        std::vector<int> together;
+        std::vector<int> eachLine;
+        Replacer<Utf8CharTraits> replacer;
+        replacer.search(text.c_str(), textLength, 0, 0, patterns[i], collectMatchPositions, &together, python_re_flag_normal);
+        replacer.search(text.c_str(), textLength, 0, 0, patterns[i], collectMatchPositions, &eachLine, lines);
+        ASSERT_EQ(together, eachLine) << patterns[i];
+	}
+}
+
+TEST(ParallelSearchTest, SplitsAfterNewlines) {
+    const char *text = "aaaa\nbb\ncccccc\nd\n\neeee";
+    std::vector<int> boundaries = ParallelSearchBase::splitAtLines(text, 0, static_cast<int>(strlen(text)), 2);
+    int expected[] = { 0, 5, 8, 15, 18, 22 };
+    ASSERT_EQ(std::vector<int>(expected, expected + sizeof(expected) / sizeof(expected[0])), boundaries);
+
+    // Nothing to split at
+    boundaries = ParallelSearchBase::splitAtLines(text, 18, 22, 1);
+    ASSERT_EQ(2, boundaries.size());
+}
+
+TEST(ParallelSearchTest, SameMatchesAsReplacer) {
+    const std::string text = testText();
+    const char *patterns[] = { "ERROR (\\d+)", "^(\\w+)=(\\w*)$", "(?<name>[a-z])=(\\d+)", "\\b\\w", "(a)|(b)", "e(?=[ \\r])",
+                               "(?<= )[a-z]+", "x*", "^", "$", "\\b", "line.*", "\xC3\xA4|\xE2\x82\xAC", "(?<name>\\w)\\1" };
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); ++i)
+	{
+        assertSameAsReplacer<Utf8CharTraits>(text, patterns[i]);
+        assertSameAsReplacer<AnsiCharTraits>(text, patterns[i]);
+	}
+}
+
+TEST(ParallelSearchTest, SameMatchesWithStartPositionCountAndFlags) {
+    const std::string text = testText();
+    assertSameAsReplacer<Utf8CharTraits>(text, "ERROR \\d+", 20);
+    assertSameAsReplacer<Utf8CharTraits>(text, "\\w+", 5, 7);
+    assertSameAsReplacer<Utf8CharTraits>(text, "^", 0, 3);
+    assertSameAsReplacer<Utf8CharTraits>(text, "error (\\d+)|LINE", 0, 0, python_re_flag_ignorecase);
+    assertSameAsReplacer<AnsiCharTraits>(text, "error (\\d+)|LINE", 0, 0, python_re_flag_ignorecase);
+}
+
+TEST(ParallelSearchTest, CountsWithoutCollectingGroups) {
+    const std::string text = testText();
+    const char *patterns[] = { "ERROR (\\d+)", "\\w+", "x*", "^", "(?<name>\\w)\\1" };
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); ++i)
+	{
+        Replacer<Utf8CharTraits> replacer;
+        long expected = replacer.count(text.c_str(), static_cast<int>(text.size()), 0, patterns[i], python_re_flag_normal);
+
+        ParallelSearch<Utf8CharTraits> parallelSearch(text.c_str(), static_cast<int>(text.size()), 0, 0, patterns[i], python_re_flag_normal, false);
+        ASSERT_TRUE(parallelSearch.run(3, 5));
+        ASSERT_EQ(expected, parallelSearch.getStats().matches) << patterns[i];
+	}
+}
+
+TEST(ParallelSearchTest, StopsWhenHandlerReturnsFalse) {
+    const std::string text = testText();
+    ParallelSearch<Utf8CharTraits> parallelSearch(text.c_str(), static_cast<int>(text.size()), 0, 0, "\\w+", python_re_flag_normal);
+    ASSERT_TRUE(parallelSearch.run(2, 10));
+
+    int count = 0;
+    parallelSearch.reportMatches(stopAfterSecondMatch, &count);
+    ASSERT_EQ(2, count);
+}
+
+/** A regex that is too complex for boost fails the parallel search, so the caller can run it again normally
+ */
+static std::string nestedStarsText()
+{
+    std::string text(200, 'a');
+    text += "\n";
+    text += std::string(5000, 'a');
+    return text;
+}
+
+TEST(ParallelSearchTest, FailsIfAChunkFails) {
+    // With a step limit as high as boost's own, the engine runs out of stack space on the long line before it reaches the limit
+    RegexComplexity::setStepLimit(100000000);
+    std::string text(nestedStarsText());
+    ParallelSearch<Utf8CharTraits> parallelSearch(text.c_str(), static_cast<int>(text.size()), 0, 0, "(a*)*(a*)*(a*)*b", python_re_flag_normal);
+    bool succeeded = parallelSearch.run(2, 10);
+    RegexComplexity::setStepLimit(RegexComplexity::DEFAULT_STEP_LIMIT);
+    ASSERT_FALSE(succeeded);
+}
+
+TEST(ParallelSearchTest, ThrowsIfAChunkIsTooComplex) {
+    std::string text(nestedStarsText());
+    ParallelSearch<Utf8CharTraits> parallelSearch(text.c_str(), static_cast<int>(text.size()), 0, 0, "(a*)*(a*)*(a*)*b", python_re_flag_normal);
+    ASSERT_THROW(parallelSearch.run(2, 10), RegexTooComplexException);
+}
+
+static bool countMatches(const char * /* text */, Match * /* match */, void *state)
+{
+    ++*reinterpret_cast<long*>(state);
+    return true;
+}
+
+TEST(ParallelSearchTest, DISABLED_BenchmarkLogScan) {
+    // About 64MB of log lines
+    std::string text;
+    for (int line = 0; text.size() < 64 * 1024 * 1024; ++line)
+	{
+        std::ostringstream logLine;
+        logLine << "2014-05-03 12:" << (line / 60) % 60 << ":" << line % 60 << " [thread " << line % 17 << "] "
+                << ((line % 97) ? "INFO request handled in " : "WARN request slow, took ") << (line * 7919) % 1000 << "ms\r\n";
+        text += logLine.str();
+	}
+    const int textLength = static_cast<int>(text.size());
+    const char *pattern = "(\\w+) request \\w+,? \\w+ (?:in )?(\\d{3,})ms";
+
+    long singleMatches = 0;
+    BenchmarkTimer singleTimer;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.search(text.c_str(), textLength, 0, 0, pattern, countMatches, &singleMatches, python_re_flag_normal);
+    double singleTime = singleTimer.elapsedMilliseconds();
+
+    long parallelMatches = 0;
+    BenchmarkTimer parallelTimer;
+    ParallelSearch<Utf8CharTraits> parallelSearch(text.c_str(), textLength, 0, 0, pattern, python_re_flag_normal);
+    ASSERT_TRUE(parallelSearch.run());
+    parallelSearch.reportMatches(countMatches, &parallelMatches);
+    double parallelTime = parallelTimer.elapsedMilliseconds();
+
+    ASSERT_EQ(singleMatches, parallelMatches);
+    printf("%d bytes, %ld matches: one thread %.1fms, %d processors %.1fms (%ld chunks)\n",
+           textLength, singleMatches, singleTime, ParallelSearchBase::processorCount(), parallelTime, parallelSearch.getStats().parallelChunks);
+}
+
+}
@@ -0,0 +1,119 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "Replacer.h"
+#include "ParallelSearch.h"
+#include "RegexComplexity.h"
+
+namespace NppPythonScript
+{
+
+/** Puts the step limit back, so it doesn't leak into other tests
+ */
+class RegexComplexityTest : public ::testing::Test
+{
+protected:
+    virtual void TearDown()
+	{
+        RegexComplexity::setStepLimit(RegexComplexity::DEFAULT_STEP_LIMIT);
+	}
+
+    // Catastrophic backtracking for (a+)+$ - each way of splitting the a's is tried before it fails at the 'b'
+    static std::string backtrackingLine()
+	{
+        return "ok line\r\n" + std::string(30, 'a') + "b\r\n";
+	}
+};
+
+static bool countMatches(const char * /* text */, Match * /* match */, void *state)
+{
+    ++*reinterpret_cast<long*>(state);
+    return true;
+}
+
+template <class CharTraitsT>
+static void assertTooComplex(const std::string& text, const char *pattern)
+{
+    const long exceededBefore = RegexComplexity::getStats().limitExceeded;
+    long matches = 0;
+    Replacer<CharTraitsT> replacer;
+    try
+	{
+        replacer.search(text.c_str(), static_cast<int>(text.size()), 0, 0, pattern, countMatches, &matches, python_re_flag_normal);
+        FAIL() << pattern << " didn't reach the limit";
+	}
+    catch (const RegexTooComplexException& e)
+	{
+        ASSERT_EQ(pattern, e.pattern());
+        ASSERT_NE(std::string::npos, std::string(e.what()).find(pattern));
+	}
+
+    RegexComplexityStats stats = RegexComplexity::getStats();
+    ASSERT_EQ(exceededBefore + 1, stats.limitExceeded);
+    ASSERT_EQ(pattern, stats.lastExceededPattern);
+}
+
+TEST_F(RegexComplexityTest, LimitNamesThePattern) {
+    RegexComplexity::setStepLimit(100000);
+    assertTooComplex<Utf8CharTraits>(backtrackingLine(), "(a+)+$");
+    assertTooComplex<AnsiCharTraits>(backtrackingLine(), "(a+)+$");
+}
+
+TEST_F(RegexComplexityTest, LimitWithAPrefilter) {
+    // "aaa" is found by the prefilter, and the regex tried just before it
+    RegexComplexity::setStepLimit(100000);
+    assertTooComplex<Utf8CharTraits>(backtrackingLine(), "aaa(a+)+$");
+    assertTooComplex<AnsiCharTraits>(backtrackingLine(), "aaa(a+)+$");
+}
+
+TEST_F(RegexComplexityTest, LimitCanBeRaised) {
+    const std::string text = backtrackingLine();
+    RegexComplexity::setStepLimit(100000);
+    assertTooComplex<Utf8CharTraits>(text, "(a+)+$");
+
+    // 2^20 ways to split the a's, so well under the limit
+    const std::string shorter = "ok line\r\n" + std::string(20, 'a') + "b\r\n";
+    RegexComplexity::setStepLimit(RegexComplexity::DEFAULT_STEP_LIMIT);
+    long matches = 0;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.search(shorter.c_str(), static_cast<int>(shorter.size()), 0, 0, "(a+)+$", countMatches, &matches, python_re_flag_normal);
+    ASSERT_EQ(0, matches);
+}
+
+TEST_F(RegexComplexityTest, LimitStopsTheReplace) {
+    RegexComplexity::setStepLimit(100000);
+    const std::string text = backtrackingLine();
+    ReplacementBatch replacements;
+    Replacer<Utf8CharTraits> replacer;
+    ASSERT_THROW(replacer.startReplace(text.c_str(), static_cast<int>(text.size()), 0, 0, "(a+)+$", "x", python_re_flag_normal, replacements), 
+                 RegexTooComplexException);
+}
+
+TEST_F(RegexComplexityTest, LimitStopsTheParallelChunks) {
+    RegexComplexity::setStepLimit(100000);
+    std::string text;
+    for (int line = 0; line < 100; ++line)
+	{
+        text += "ok line\r\n";
+	}
+    text += backtrackingLine();
+    ParallelSearch<Utf8CharTraits> search(text.c_str(), static_cast<int>(text.size()), 0, 0, "(a+)+$", python_re_flag_normal);
+    ASSERT_THROW(search.run(4, 64), RegexTooComplexException);
+}
+
+TEST_F(RegexComplexityTest, SlowestRunIsKept) {
+    RegexComplexity::recordRun(1, "quick");
+    const DWORD slowest = RegexComplexity::getStats().slowestRun;
+    RegexComplexity::recordRun(slowest + 1000, "slow");
+
+    RegexComplexityStats stats = RegexComplexity::getStats();
+    ASSERT_EQ(slowest + 1000, stats.slowestRun);
+    ASSERT_EQ("slow", stats.slowestRunPattern);
+
+    // A quicker run doesn't replace it
+    RegexComplexity::recordRun(slowest + 1, "quicker");
+    ASSERT_EQ("slow", RegexComplexity::getStats().slowestRunPattern);
+}
+
+}
@@ -0,0 +1,154 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "Replacer.h"
+#include "ReplacementTemplate.h"
+#include "ReplacementBatch.h"
+#include "BenchmarkTimer.h"
+
+namespace NppPythonScript
+{
+
+struct ExpandState
+{
+    std::vector<std::string> formats;
+    LiteralEncoding encoding;
+    int supportedCount;
+    int matchCount;
+};
+
+/** Expands every format with a ReplacementTemplate and with boost's formatter (Match::expand), and checks they agree.
+ */
+static bool compareExpansions(const char *text, Match *match, void *state)
+{
+    ExpandState *expandState = reinterpret_cast<ExpandState*>(state);
+    ++expandState->matchCount;
+    for (std::vector<std::string>::const_iterator it = expandState->formats.begin(); it != expandState->formats.end(); ++it)
+	{
+        ReplacementTemplate replaceTemplate(it->c_str(), expandState->encoding);
+        if (!replaceTemplate.isSupported())
+		{
+            continue;
+		}
+        ++expandState->supportedCount;
+
+        ReplacementBatch batch;
+        replaceTemplate.expand(text, match, batch);
+        batch.commitReplacement(0, 0);
+
+        char *expected;
+        int expectedLength;
+        match->expand(it->c_str(), &expected, &expectedLength);
+        std::string expectedString(expected, expectedLength);
+        delete [] expected;
+
+        EXPECT_EQ(expectedString, std::string(batch.getReplacement(batch.front()), batch.front().length)) << "Format: " << *it;
+	}
+    return true;
+}
+
+template <class CharTraitsT>
+static int assertSameAsBoost(const char *text, const char *regex, const std::vector<std::string>& formats)
+{
+    ExpandState state;
+    state.formats = formats;
+    state.encoding = CharTraitsT::literalEncoding;
+    state.supportedCount = 0;
+    state.matchCount = 0;
+
+    Replacer<CharTraitsT> replacer;
+    replacer.search(text, static_cast<int>(strlen(text)), 0, 0, regex, compareExpansions, &state, python_re_flag_normal);
+    EXPECT_LT(0, state.matchCount);
+    return state.supportedCount;
+}
+
+static std::vector<std::string> sampleFormats()
+{
+    const char *formats[] = {
+        "plain", "", "$1", "$2-$1", "${1}x", "$10", "$&", "$0", "$$", "$", "$x", "${", "${1", "${MATCH}", "$MATCH", "${^MATCH}", 
+        "$+", "$+{name}", "$+{missing}", "$+{name", "$LAST_PAREN_MATCH", "${MATCHx}",
+        "\\1\\2", "\\0101", "\\n\\t\\r\\a\\e\\f\\v", "\\", "\\x41", "\\x4g", "\\x", "\\x{263A}", "\\x{41", "\\x{zz}", "\\x{e4}", "\\cA", "\\c", "\\q", "\\$1",
+        "(a)", "(a", "a)b", "?1yes:no", "?2yes:no", "(?1yes:no)rest", "(?2yes:no)rest", "?{1}y:n", "?{1y", "?", "?x", 
+        "(?1(?2both:one):none)", "?1?2a:b:c", "(a:b)", "x:y", "(?1a:b:c)d", "((?9x:y))", "?12x", 
+        "\xC3\xA4$1\xC3\xBC", "\\\xC3\xA4", "&amp;"
+	};
+    return std::vector<std::string>(formats, formats + sizeof(formats) / sizeof(formats[0]));
+}
+
+TEST(ReplacementTemplateTest, SameAsBoostUtf8) {
+    std::vector<std::string> formats = sampleFormats();
+    int supported = assertSameAsBoost<Utf8CharTraits>("xx ab y\xC3\xA4 b ac", "(a)?(?<name>b|c)", formats);
+    ASSERT_LT(0, supported);
+}
+
+TEST(ReplacementTemplateTest, SameAsBoostAnsi) {
+    std::vector<std::string> formats = sampleFormats();
+    formats.push_back("\\c\xC1");
+    formats.push_back("\\x{1e4}");
+    int supported = assertSameAsBoost<AnsiCharTraits>("xx ab y\xE4 b ac", "(a)?(?<name>b|c)", formats);
+    ASSERT_LT(0, supported);
+}
+
+/** Random formats made of the characters that mean something to boost's formatter
+ */
+TEST(ReplacementTemplateTest, RandomFormatsSameAsBoost) {
+    const char alphabet[] = "$\\(){}?:+&^1029xaMATCHnc";
+    std::vector<std::string> formats;
+    unsigned int seed = 12345;
+    for (int i = 0; i < 2000; ++i)
+	{
+        std::string format;
+        seed = seed * 1103515245 + 12345;
+        int length = (seed >> 16) % 8;
+        for (int c = 0; c < length; ++c)
+		{
+            seed = seed * 1103515245 + 12345;
+            format += alphabet[(seed >> 16) % (sizeof(alphabet) - 1)];
+		}
+        formats.push_back(format);
+	}
+
+    assertSameAsBoost<Utf8CharTraits>("xx ab yy b", "(a)?(b)", formats);
+    assertSameAsBoost<AnsiCharTraits>("xx ab yy b", "(a)?(b)", formats);
+}
+
+TEST(ReplacementTemplateTest, UnsupportedFormats) {
+    ASSERT_TRUE(ReplacementTemplate("x$1(?2y:z)\\n", LITERAL_ENCODING_UTF8).isSupported());
+    ASSERT_FALSE(ReplacementTemplate("\\u$1", LITERAL_ENCODING_UTF8).isSupported());
+    ASSERT_FALSE(ReplacementTemplate("$`", LITERAL_ENCODING_UTF8).isSupported());
+    ASSERT_FALSE(ReplacementTemplate("?{name}x", LITERAL_ENCODING_ANSI).isSupported());
+    ASSERT_FALSE(ReplacementTemplate("\xC3", LITERAL_ENCODING_UTF8).isSupported());
+    ASSERT_TRUE(ReplacementTemplate("\xC3", LITERAL_ENCODING_ANSI).isSupported());
+}
+
+TEST(ReplacementTemplateTest, ReplaceUsesTemplate) {
+    Replacer<Utf8CharTraits> replacer;
+    ReplacementBatch entries;
+    replacer.startReplace("key=value; k\xC3\xA4y=v", 17, 0, 0, "(\\w+)=(\\w+)", "$2:$1", python_re_flag_normal, entries);
+    ASSERT_EQ(2, entries.size());
+    ASSERT_STREQ("value:key", entries.getReplacement(entries[0]));
+    ASSERT_STREQ("v:k\xC3\xA4y", entries.getReplacement(entries[1]));
+    ASSERT_EQ(11, entries[1].start);
+}
+
+/** Times a replace with group references on a document with many matches.
+ */
+TEST(ReplacementTemplateTest, DISABLED_BenchmarkExpand) {
+    std::string text;
+    for (int i = 0; i < 100000; ++i)
+	{
+        text += "key=value; ";
+	}
+
+    Replacer<Utf8CharTraits> replacer;
+    ReplacementBatch entries;
+    BenchmarkTimer timer;
+    replacer.startReplace(text.c_str(), static_cast<int>(text.size()), 0, 0, "(\\w+)=(\\w+)", "$2 = \\1", python_re_flag_normal, entries);
+    double elapsed = timer.elapsedMilliseconds();
+
+    ASSERT_EQ(100000, entries.size());
+    printf("100,000 replacements of \"$2 = \\1\": %.1fms\n", elapsed);
+}
+
+}
@@ -4,7 +4,7 @@
 
 #include <gtest/gtest.h>
 #include "Replacer.h"
-#include "ReplaceEntry.h"
+#include "ReplacementBatch.h"
 
 namespace NppPythonScript 
 {
@@ -17,37 +17,23 @@ class ReplacerTest : public ::testing::Test {
 };
 
 
-ReplaceEntry convert(const char *text, Match *match)
-{
-    GroupDetail *fullMatch = match->group(0);
-    return ReplaceEntry(fullMatch->start(), fullMatch->end(), "yyy", 3);
-}
-
-
-void deleteEntry(ReplaceEntry* entry)
-{
-    delete entry;
-}
-
 TEST_F(ReplacerTest, SimpleReplace) {
     NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
-    std::list<NppPythonScript::ReplaceEntry* > entries;
+    NppPythonScript::ReplacementBatch entries;
     bool moreEntries = replacer.startReplace("aaabbbaaabb", 12, 0, 0, "(b+)", "x$1x", NppPythonScript::python_re_flag_normal, entries);
     ASSERT_EQ(2, entries.size());
-    std::list<NppPythonScript::ReplaceEntry*>::const_iterator it = entries.begin();
+    NppPythonScript::ReplacementBatch::const_iterator it = entries.begin();
 
-    ASSERT_EQ(3, (*it)->getStart());
-    ASSERT_STREQ("xbbbx", (*it)->getReplacement());
-    ASSERT_EQ(5, (*it)->getReplacementLength());
+    ASSERT_EQ(3, it->start);
+    ASSERT_STREQ("xbbbx", entries.getReplacement(*it));
+    ASSERT_EQ(5, it->length);
 
     ++it;
 
-    ASSERT_EQ(9, (*it)->getStart());
-    ASSERT_STREQ("xbbx", (*it)->getReplacement());
-    ASSERT_EQ(4, (*it)->getReplacementLength());
+    ASSERT_EQ(9, it->start);
+    ASSERT_STREQ("xbbx", entries.getReplacement(*it));
+    ASSERT_EQ(4, it->length);
     ASSERT_EQ(false, moreEntries);
-
-    for_each(entries.begin(), entries.end(), deleteEntry);
 }
 
 
@@ -55,33 +41,28 @@ TEST_F(ReplacerTest, SimpleReplace) {
  */
 TEST_F(ReplacerTest, ReplaceUtf8) {
     NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
-    std::list<NppPythonScript::ReplaceEntry* > entries;
+    NppPythonScript::ReplacementBatch entries;
     bool moreEntries = replacer.startReplace("aaa\xc3\xb4" "bbbaaa\xc3\xbc" "bb", 15, 0, 0,  "aaa([\xc3\xbc])", "x$1x", NppPythonScript::python_re_flag_normal,entries);
     ASSERT_EQ(1, entries.size());
-    std::list<NppPythonScript::ReplaceEntry*>::const_iterator it = entries.begin();
-
-    ASSERT_EQ(8, (*it)->getStart());
-    ASSERT_STREQ("x\xC3\xBCx", (*it)->getReplacement());
-    ASSERT_EQ(4, (*it)->getReplacementLength());
+    NppPythonScript::ReplacementBatch::const_iterator it = entries.begin();
 
-
-    for_each(entries.begin(), entries.end(), deleteEntry);
+    ASSERT_EQ(8, it->start);
+    ASSERT_STREQ("x\xC3\xBCx", entries.getReplacement(*it));
+    ASSERT_EQ(4, it->length);
 }
 
 /** Test ensures characters outside of the BMP are matched correctly
  */
 TEST_F(ReplacerTest, ReplaceExtendedUtf8) {
     NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
-    std::list<NppPythonScript::ReplaceEntry* > entries;
+    NppPythonScript::ReplacementBatch entries;
     bool moreEntries = replacer.startReplace("aaa\xF0\x9F\x82\xB7" "ZZZ" "bbbaaa\xF0\x9F\x82\xB8" "ZZZ", 23, 0, 0, "aaa([\xF0\x9F\x82\xB8])", "x$1x", NppPythonScript::python_re_flag_normal,entries);
     ASSERT_EQ(1, entries.size());
-    std::list<NppPythonScript::ReplaceEntry*>::const_iterator it = entries.begin();
-
-    ASSERT_EQ(13, (*it)->getStart());
-    ASSERT_STREQ("x\xF0\x9F\x82\xB8x", (*it)->getReplacement());
-    ASSERT_EQ(6, (*it)->getReplacementLength());
+    NppPythonScript::ReplacementBatch::const_iterator it = entries.begin();
 
-    for_each(entries.begin(), entries.end(), deleteEntry);
+    ASSERT_EQ(13, it->start);
+    ASSERT_STREQ("x\xF0\x9F\x82\xB8x", entries.getReplacement(*it));
+    ASSERT_EQ(6, it->length);
 }
 
 /** Tests simple ANSI (8 bit ASCII) replacement
@@ -89,21 +70,19 @@ TEST_F(ReplacerTest, ReplaceExtendedUtf8) {
 TEST_F(ReplacerTest, ReplaceSimpleAnsi) {
 
     NppPythonScript::Replacer<NppPythonScript::AnsiCharTraits> replacer;
-    std::list<NppPythonScript::ReplaceEntry* > entries;
+    NppPythonScript::ReplacementBatch entries;
     bool moreEntries = replacer.startReplace("aaa\xF0\x9F" "ZZZ" "aaa\x9F\xB8" "ZZZ", 16, 0, 0, "aaa([\xF0\x9F])", "x$1x", NppPythonScript::python_re_flag_normal,entries);
     ASSERT_EQ(2, entries.size());
-    std::list<NppPythonScript::ReplaceEntry*>::const_iterator it = entries.begin();
-    ASSERT_EQ(0, (*it)->getStart());
-    ASSERT_STREQ("x\xF0x", (*it)->getReplacement());
-    ASSERT_EQ(3, (*it)->getReplacementLength());
+    NppPythonScript::ReplacementBatch::const_iterator it = entries.begin();
+    ASSERT_EQ(0, it->start);
+    ASSERT_STREQ("x\xF0x", entries.getReplacement(*it));
+    ASSERT_EQ(3, it->length);
 
     ++it;
 
-    ASSERT_EQ(8, (*it)->getStart());
-    ASSERT_STREQ("x\x9Fx", (*it)->getReplacement());
-    ASSERT_EQ(3, (*it)->getReplacementLength());
-
-    for_each(entries.begin(), entries.end(), deleteEntry);
+    ASSERT_EQ(8, it->start);
+    ASSERT_STREQ("x\x9Fx", entries.getReplacement(*it));
+    ASSERT_EQ(3, it->length);
 }
 
 /** Tests UTF8 replacement with a UTF-8 string replacement
@@ -111,15 +90,147 @@ TEST_F(ReplacerTest, ReplaceSimpleAnsi) {
 TEST_F(ReplacerTest, ReplaceUtf8ReplacementString) {
 
     NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
-    std::list<NppPythonScript::ReplaceEntry* > entries;
+    NppPythonScript::ReplacementBatch entries;
     bool moreEntries = replacer.startReplace("aaa\xC3\xB4" "ZZZ" , 8, 0, 0, "aaa\xC3\xB4", "x" "\xC3\xB5" "z", NppPythonScript::python_re_flag_normal,entries);
     ASSERT_EQ(1, entries.size());
-    std::list<NppPythonScript::ReplaceEntry*>::const_iterator it = entries.begin();
-    ASSERT_EQ(0, (*it)->getStart());
-    ASSERT_STREQ("x" "\xC3\xB5" "z", (*it)->getReplacement());
-    ASSERT_EQ(4, (*it)->getReplacementLength());
+    NppPythonScript::ReplacementBatch::const_iterator it = entries.begin();
+    ASSERT_EQ(0, it->start);
+    ASSERT_STREQ("x" "\xC3\xB5" "z", entries.getReplacement(*it));
+    ASSERT_EQ(4, it->length);
+}
+
+/** Tests that replacements with no group references are copied as they are, and that the texts are kept in one arena
+ */
+TEST_F(ReplacerTest, ReplacementBatchHoldsPlainReplacements) {
+    NppPythonScript::Replacer<NppPythonScript::AnsiCharTraits> replacer;
+    NppPythonScript::ReplacementBatch entries;
+    std::string text;
+    for (int i = 0; i < 1000; ++i)
+	{
+        text += "abc ";
+	}
+    replacer.startReplace(text.c_str(), static_cast<int>(text.size()), 0, 0, "b", "XY", NppPythonScript::python_re_flag_normal, entries);
+    ASSERT_EQ(1000, entries.size());
+
+    for (size_t i = 0; i < entries.size(); ++i)
+	{
+        ASSERT_EQ(static_cast<int>(i * 4 + 1), entries[i].start);
+        ASSERT_EQ(static_cast<int>(i * 4 + 2), entries[i].end);
+        ASSERT_EQ(2, entries[i].length);
+        ASSERT_STREQ("XY", entries.getReplacement(entries[i]));
+	}
+
+    // Each replacement is followed by its terminating '\0' in the arena
+    ASSERT_EQ(entries.getReplacement(entries[0]) + 3, entries.getReplacement(entries[1]));
+}
+
+/** Tests that the second replace with the same pattern and flags reuses the compiled regex
+ */
+TEST_F(ReplacerTest, RegexCacheReusesCompiledPattern) {
+    NppPythonScript::RegexCache<NppPythonScript::Utf8CharTraits>::getInstance().clear();
+    NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
+    NppPythonScript::ReplacementBatch entries;
+    replacer.startReplace("aaabbbaaabb", 12, 0, 0, "(b+)", "x$1x", NppPythonScript::python_re_flag_normal, entries);
+    replacer.startReplace("aaabbbaaabb", 12, 0, 0, "(b+)", "y$1y", NppPythonScript::python_re_flag_normal, entries);
+    replacer.startReplace("aaabbbaaabb", 12, 0, 0, "(b+)", "x$1x", NppPythonScript::python_re_flag_ignorecase, entries);
+    ASSERT_EQ(6, entries.size());
+
+    NppPythonScript::RegexCacheStats stats = NppPythonScript::RegexCache<NppPythonScript::Utf8CharTraits>::getInstance().getStats();
+    ASSERT_EQ(1, stats.hits);
+    ASSERT_EQ(2, stats.misses);
+    ASSERT_EQ(2, stats.size);
+}
+
+/** Tests that the least recently used pattern is evicted when the cache is full
+ */
+TEST_F(ReplacerTest, RegexCacheEvictsLeastRecentlyUsed) {
+    NppPythonScript::RegexCache<NppPythonScript::AnsiCharTraits>& cache = NppPythonScript::RegexCache<NppPythonScript::AnsiCharTraits>::getInstance();
+    cache.clear();
+    cache.setCapacity(2);
+
+    cache.get("a+", boost::regex_constants::normal);
+    cache.get("b+", boost::regex_constants::normal);
+    cache.get("a+", boost::regex_constants::normal);
+    cache.get("c+", boost::regex_constants::normal);   // evicts b+
+    cache.get("a+", boost::regex_constants::normal);
+    cache.get("b+", boost::regex_constants::normal);
+
+    NppPythonScript::RegexCacheStats stats = cache.getStats();
+    ASSERT_EQ(2, stats.hits);
+    ASSERT_EQ(4, stats.misses);
+    ASSERT_EQ(2, stats.evictions);
+    ASSERT_EQ(2, stats.size);
+
+    cache.setCapacity(NppPythonScript::RegexCache<NppPythonScript::AnsiCharTraits>::DEFAULT_CAPACITY);
+    cache.clear();
+}
+
+/** count() uses the same engines as search(), so the counts match for regexes, literals and start positions
+ */
+TEST_F(ReplacerTest, CountMatchesSearch) {
+    NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
+    const char *text = "aaabbbaaabb Abc abc \xC3\xA4" "bc";
+    const int textLength = static_cast<int>(strlen(text));
+
+    ASSERT_EQ(5, replacer.count(text, textLength, 0, "(b+)", NppPythonScript::python_re_flag_normal));
+    ASSERT_EQ(5, replacer.getStats().matches);
+    ASSERT_EQ(3, replacer.count(text, textLength, 0, "bc", NppPythonScript::python_re_flag_literal));
+    ASSERT_EQ(2, replacer.count(text, textLength, 0, "abc", static_cast<NppPythonScript::python_re_flags>(NppPythonScript::python_re_flag_literal | NppPythonScript::python_re_flag_ignorecase)));
+    ASSERT_EQ(1, replacer.count(text, textLength, 13, "abc", NppPythonScript::python_re_flag_literal));
+    ASSERT_EQ(0, replacer.count(text, textLength, 0, "xyz", NppPythonScript::python_re_flag_normal));
+}
+
+static std::vector<int> replacedPositions(NppPythonScript::ReplacementBatch& entries)
+{
+    std::vector<int> positions;
+    for (NppPythonScript::ReplacementBatch::const_iterator it = entries.begin(); it != entries.end(); ++it)
+	{
+        positions.push_back(it->start);
+        positions.push_back(it->end);
+	}
+    return positions;
+}
 
+/** In line mode, each line is the whole text: ^ and $ are at the ends of the line, whatever the line ending
+ */
+TEST_F(ReplacerTest, LineModeSearchesEachLineOnItsOwn) {
+    NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
+    const char *text = "ab\r\ncd\nef\rgh \t\r\n  ij";
+    const int textLength = static_cast<int>(strlen(text));
+
+    NppPythonScript::ReplacementBatch entries;
+    replacer.startReplace(text, textLength, 0, 0, "\\A\\w|\\w\\z", "", NppPythonScript::python_re_flag_lines, entries);
+    int expected[] = { 0, 1, 1, 2, 4, 5, 5, 6, 7, 8, 8, 9, 10, 11, 19, 20 };
+    ASSERT_EQ(std::vector<int>(expected, expected + 16), replacedPositions(entries));
+
+    // \s+ can't match the line endings, so the spaces at the end of one line and the start of the next are separate matches
+    NppPythonScript::ReplacementBatch spaces;
+    replacer.startReplace(text, textLength, 0, 0, "\\s+", "", NppPythonScript::python_re_flag_lines, spaces);
+    int expectedSpaces[] = { 12, 14, 16, 18 };
+    ASSERT_EQ(std::vector<int>(expectedSpaces, expectedSpaces + 4), replacedPositions(spaces));
+    ASSERT_EQ(2, replacer.getStats().matches);
+}
 
-    for_each(entries.begin(), entries.end(), deleteEntry);
+TEST_F(ReplacerTest, LineModeCanIncludeLineEndings) {
+    NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
+    const char *text = "a\r\nb\nc";
+    const int textLength = static_cast<int>(strlen(text));
+    const NppPythonScript::python_re_flags includeLineEndings = static_cast<NppPythonScript::python_re_flags>(NppPythonScript::python_re_flag_lines | NppPythonScript::python_re_flag_includelineendings);
+
+    ASSERT_EQ(0, replacer.count(text, textLength, 0, "\\r?\\n", NppPythonScript::python_re_flag_lines));
+    ASSERT_EQ(2, replacer.count(text, textLength, 0, "\\r?\\n", includeLineEndings));
+
+    // The empty line after a final line ending is a line of its own, unless the ranges of the lines include their endings
+    ASSERT_EQ(3, replacer.count("a\nb\n", 4, 0, "^", NppPythonScript::python_re_flag_lines));
+    ASSERT_EQ(2, replacer.count("a\nb\n", 4, 0, "^", includeLineEndings));
+}
+
+TEST_F(ReplacerTest, LineModeCountsMatchesOnAllLines) {
+    NppPythonScript::Replacer<NppPythonScript::AnsiCharTraits> replacer;
+    NppPythonScript::ReplacementBatch entries;
+    replacer.startReplace("xx\nxx\nxx", 8, 2, 3, "x", "y", NppPythonScript::python_re_flag_lines, entries);
+    int expected[] = { 3, 4, 4, 5, 6, 7 };
+    ASSERT_EQ(std::vector<int>(expected, expected + 6), replacedPositions(entries));
+    ASSERT_EQ(3, replacer.getStats().matches);
 }
 }
\ No newline at end of file
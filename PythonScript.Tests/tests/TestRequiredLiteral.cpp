@@ -0,0 +1,206 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "RequiredLiteral.h"
+#include "Replacer.h"
+#include "ReplacementBatch.h"
+#include "BenchmarkTimer.h"
+
+namespace NppPythonScript
+{
+
+static void assertRequiredLiteral(const char *pattern, const char *expectedLiteral, int expectedMinOffset, int expectedMaxOffset)
+{
+    RequiredLiteral required(pattern, LITERAL_ENCODING_UTF8);
+    ASSERT_TRUE(required.isFound()) << pattern;
+    ASSERT_EQ(std::string(expectedLiteral), required.literal()) << pattern;
+    ASSERT_EQ(expectedMinOffset, required.minOffset()) << pattern;
+    ASSERT_EQ(expectedMaxOffset, required.maxOffset()) << pattern;
+}
+
+static void assertNoRequiredLiteral(const char *pattern)
+{
+    RequiredLiteral required(pattern, LITERAL_ENCODING_UTF8);
+    ASSERT_FALSE(required.isFound()) << pattern;
+}
+
+TEST(RequiredLiteralTest, FindsLongestRequiredRun) {
+    assertRequiredLiteral("ERROR\\s+\\d{4}", "ERROR", 0, 0);
+    assertRequiredLiteral("\\d{4}-ERROR", "-ERROR", 4, 4);
+    assertRequiredLiteral("\\b0x[0-9a-f]+", "0x", 0, 0);
+    assertRequiredLiteral("ab+cdef", "cdef", 2, RequiredLiteral::UNBOUNDED);
+    assertRequiredLiteral("colou?r", "colo", 0, 0);
+    assertRequiredLiteral("(abc)+xy", "xy", 0, RequiredLiteral::UNBOUNDED);
+    assertRequiredLiteral("x{2}yz", "yz", 2, 2);
+    assertRequiredLiteral("[abc\\]]def", "def", 1, 1);
+    assertRequiredLiteral("[]a[:alpha:]]?.def", "def", 1, 2);
+    assertRequiredLiteral("\\w+\\.txt", ".txt", 1, RequiredLiteral::UNBOUNDED);
+    assertRequiredLiteral("\\Qa.b*\\E", "a.b*", 0, 0);
+    assertRequiredLiteral("\\n\\tab", "\n\tab", 0, 0);
+    assertRequiredLiteral("^ab\\bcd$", "abcd", 0, 0);
+    assertRequiredLiteral("(?<=x)abc", "abc", 0, RequiredLiteral::UNBOUNDED);
+    assertRequiredLiteral("\xC3\xA4" "bc", "\xC3\xA4" "bc", 0, 0);
+    assertRequiredLiteral(".{2,3}\xC3\xA4\xC3\xB6", "\xC3\xA4\xC3\xB6", 2, 3);
+}
+
+TEST(RequiredLiteralTest, GivesUpWhenUnsure) {
+    assertNoRequiredLiteral("");
+    assertNoRequiredLiteral("abc|def");
+    assertNoRequiredLiteral("(?i)abc");
+    assertNoRequiredLiteral("(?:x(*ACCEPT))abc");
+    assertNoRequiredLiteral("(a)abc\\1");
+    assertNoRequiredLiteral("\\x41bc");
+    assertNoRequiredLiteral("\\Gabc");
+    assertNoRequiredLiteral("abc[de");
+    assertNoRequiredLiteral("abc(de");
+    assertNoRequiredLiteral("\\Qab\\E+");
+    assertNoRequiredLiteral("a*b?");
+    assertNoRequiredLiteral("abc\xC3");
+}
+
+typedef std::vector<std::pair<int, int> > GroupSpans;
+
+static bool collectGroups(const char * /* text */, Match *match, void *state)
+{
+    GroupSpans *spans = reinterpret_cast<GroupSpans*>(state);
+    for (int group = 0; group < match->groupCount(); ++group)
+	{
+        GroupDetail groupDetail;
+        match->group(group, groupDetail);
+        spans->push_back(groupDetail.matched() ? std::pair<int, int>(groupDetail.start(), groupDetail.end()) : std::pair<int, int>(-1, -1));
+	}
+    return true;
+}
+
+/** Searches (and replaces) with the pattern, and with the pattern wrapped in a non-capturing group, which is the same 
+ *  regex but doesn't have a required literal at the top level, so is searched without the prefilter.
+ */
+template <class CharTraitsT>
+static void assertSameAsWithoutPrefilter(const std::string& text, const char *pattern, python_re_flags flags, int startPosition, bool expectPrefilter)
+{
+    Replacer<CharTraitsT> replacer;
+    const int textLength = static_cast<int>(text.size());
+    std::string unfiltered = std::string("(?:") + pattern + ")";
+
+    GroupSpans prefilteredSpans;
+    replacer.search(text.c_str(), textLength, startPosition, 0, pattern, collectGroups, &prefilteredSpans, flags);
+    ASSERT_EQ(expectPrefilter, replacer.getStats().prefilterUsed) << pattern;
+
+    GroupSpans unfilteredSpans;
+    replacer.search(text.c_str(), textLength, startPosition, 0, unfiltered.c_str(), collectGroups, &unfilteredSpans, flags);
+    ASSERT_FALSE(replacer.getStats().prefilterUsed);
+
+    ASSERT_EQ(unfilteredSpans, prefilteredSpans) << pattern;
+
+    // The prefix ($`) runs from the end of the previous match, even where the prefilter started the regex engine later
+    ReplacementBatch prefilteredReplacements;
+    replacer.startReplace(text.c_str(), textLength, startPosition, 0, pattern, "[$`|$&]", flags, prefilteredReplacements);
+    ReplacementBatch unfilteredReplacements;
+    replacer.startReplace(text.c_str(), textLength, startPosition, 0, unfiltered.c_str(), "[$`|$&]", flags, unfilteredReplacements);
+
+    ASSERT_EQ(unfilteredReplacements.size(), prefilteredReplacements.size()) << pattern;
+    ReplacementBatch::const_iterator unfilteredIt = unfilteredReplacements.begin();
+    for (ReplacementBatch::const_iterator it = prefilteredReplacements.begin(); it != prefilteredReplacements.end(); ++it, ++unfilteredIt)
+	{
+        ASSERT_EQ(unfilteredIt->start, it->start);
+        ASSERT_STREQ(unfilteredReplacements.getReplacement(*unfilteredIt), prefilteredReplacements.getReplacement(*it)) << pattern;
+	}
+}
+
+static const char *s_prefilterText = 
+    "xxabcx ERROR  1234 ERROR 12 aabc aaab 12-ERROR 99-ERROR WARN\r\nline end\r\n"
+    "\xC3\xA4" "bc ZZ\xC3\xA4" "b \xC3\xA4\xC3\xA4" "bc singing ringing \xE2\x82" "abc ERR Error 2014 xabc ABC abc\r\n"
+    "WARN abc \xC3\x84" "BC 7-error colour color \xF0\x9F\x82\xB7" "abc end";
+
+static const char *s_prefilterPatterns[] = {
+    "ERROR\\s+\\d{4}",
+    "\\d{2}-ERROR",
+    "\\bERR(OR)?\\b",
+    "x*abc",
+    "[a-z]{2,3}abc",
+    "\\w+ing\\b",
+    "(\\w+)ing\\b",
+    "^WARN",
+    "end$",
+    "aab",
+    "(?<=x)abc",
+    "a(?=bc)bc",
+    "\\r\\nline",
+    "\xC3\xA4" "bc",
+    ".{0,3}\xC3\xA4" "b",
+    ".\\s?colou?r",
+    "\\Qabc\\E"
+};
+
+TEST(RequiredLiteralTest, PrefilteredSearchSameAsRegexUtf8) {
+    const python_re_flags flagSets[] = { python_re_flag_normal, python_re_flag_ignorecase, python_re_flag_wholedoc };
+    const int startPositions[] = { 0, 5, 17, 75 };
+    for (size_t p = 0; p < sizeof(s_prefilterPatterns) / sizeof(s_prefilterPatterns[0]); ++p)
+	{
+        for (size_t f = 0; f < sizeof(flagSets) / sizeof(flagSets[0]); ++f)
+		{
+            for (size_t s = 0; s < sizeof(startPositions) / sizeof(startPositions[0]); ++s)
+			{
+                assertSameAsWithoutPrefilter<Utf8CharTraits>(s_prefilterText, s_prefilterPatterns[p], flagSets[f], startPositions[s], true);
+			}
+		}
+	}
+}
+
+TEST(RequiredLiteralTest, PrefilteredSearchSameAsRegexAnsi) {
+    for (size_t p = 0; p < sizeof(s_prefilterPatterns) / sizeof(s_prefilterPatterns[0]); ++p)
+	{
+        assertSameAsWithoutPrefilter<AnsiCharTraits>(s_prefilterText, s_prefilterPatterns[p], python_re_flag_normal, 0, true);
+        assertSameAsWithoutPrefilter<AnsiCharTraits>(s_prefilterText, s_prefilterPatterns[p], python_re_flag_ignorecase, 3, true);
+	}
+}
+
+TEST(RequiredLiteralTest, StatsShowWhetherPrefilterWasUsed) {
+    Replacer<Utf8CharTraits> replacer;
+    const char *text = "ERROR 1234 WARN 12 ERROR 99 ERROR  2014";
+    GroupSpans spans;
+
+    replacer.search(text, static_cast<int>(strlen(text)), 0, 0, "ERROR\\s+\\d{4}", collectGroups, &spans, python_re_flag_normal);
+    ASSERT_TRUE(replacer.getStats().prefilterUsed);
+    ASSERT_EQ(std::string("ERROR"), replacer.getStats().prefilterLiteral);
+    ASSERT_EQ(3, replacer.getStats().literalCandidates);
+    ASSERT_EQ(3, replacer.getStats().regexRuns);
+    ASSERT_EQ(2, replacer.getStats().matches);
+
+    replacer.search(text, static_cast<int>(strlen(text)), 0, 0, "ERROR|WARN", collectGroups, &spans, python_re_flag_normal);
+    ASSERT_FALSE(replacer.getStats().prefilterUsed);
+    ASSERT_EQ(4, replacer.getStats().matches);
+}
+
+static bool countMatch(const char * /* text */, Match * /* match */, void *state)
+{
+    ++*reinterpret_cast<int*>(state);
+    return true;
+}
+
+/** An alert scan over a log that has almost no matches, with and without the prefilter
+ */
+TEST(RequiredLiteralTest, DISABLED_BenchmarkMostlyMissingSearch) {
+    std::string text;
+    while (text.size() < 8 * 1024 * 1024)
+	{
+        text += "2014-04-26 10:15:32 INFO  [worker-7] Processed request id=42871 in 12ms, status OK\r\n";
+        text += "2014-04-26 10:15:33 WARN  [worker-3] Slow response from upstream, retrying (attempt 2)\r\n";
+	}
+    text += "2014-04-26 10:15:34 ERROR 4012 [worker-1] Connection reset\r\n";
+    const int textLength = static_cast<int>(text.size());
+
+    Replacer<Utf8CharTraits> replacer;
+    const char *patterns[] = { "ERROR\\s+\\d{4}", "(?:ERROR\\s+\\d{4})", "\\d+-ERROR", "(?:\\d+-ERROR)" };
+    for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); ++p)
+	{
+        int matches = 0;
+        BenchmarkTimer timer;
+        replacer.search(text.c_str(), textLength, 0, 0, patterns[p], countMatch, &matches, python_re_flag_normal);
+        double elapsed = timer.elapsedMilliseconds();
+        printf("%-22s %d matches in %.1fms (prefilter %s)\n", patterns[p], matches, elapsed, replacer.getStats().prefilterUsed ? "used" : "not used");
+	}
+}
+
+}
@@ -0,0 +1,139 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "Replacer.h"
+#include "ReverseSearch.h"
+
+namespace NppPythonScript
+{
+
+static bool describeMatch(const char * /* text */, Match *match, void *state)
+{
+    std::vector<std::string> *descriptions = reinterpret_cast<std::vector<std::string>*>(state);
+    std::ostringstream description;
+    for (int groupNo = 0; groupNo < match->groupCount(); ++groupNo)
+	{
+        GroupDetail groupDetail;
+        match->group(groupNo, groupDetail);
+        description << groupDetail.start() << "-" << groupDetail.end() << (groupDetail.matched() ? " " : "? ");
+	}
+
+    description << match->groupIndexFromName("name") << " ";
+
+    char *expanded;
+    int expandedLength;
+    match->expand("<$&|$1>", &expanded, &expandedLength);
+    description << std::string(expanded, expandedLength);
+    delete [] expanded;
+
+    descriptions->push_back(description.str());
+    return true;
+}
+
+/** Lines of words and numbers, long enough to need a few blocks
+ */
+static std::string sampleText()
+{
+    std::ostringstream text;
+    for (int line = 0; line < 2000; ++line)
+	{
+        text << "ERROR " << line << " key" << (line % 7) << "=value\r\n";
+        if (0 == line % 100)
+		{
+            text << "\r\n\xC3\xA4\xC3\xB6 x=1 y=22\n";
+		}
+	}
+    return text.str();
+}
+
+template <class CharTraitsT>
+static void assertReverseOfForward(const std::string& text, const char *pattern, int startPosition = 0, int extraFlags = python_re_flag_normal)
+{
+    const int textLength = static_cast<int>(text.size());
+    const python_re_flags flags = static_cast<python_re_flags>(extraFlags);
+
+    std::vector<std::string> forward;
+    Replacer<CharTraitsT> replacer;
+    replacer.search(text.c_str(), textLength, startPosition, 0, pattern, describeMatch, &forward, flags);
+
+    std::vector<std::string> backward;
+    ReverseSearch<CharTraitsT> reverseSearch(text.c_str(), textLength, startPosition, pattern, flags);
+    reverseSearch.search(0, describeMatch, &backward);
+
+    std::reverse(backward.begin(), backward.end());
+    ASSERT_EQ(forward.size(), backward.size()) << pattern;
+    for (size_t i = 0; i < forward.size(); ++i)
+	{
+        ASSERT_EQ(forward[i], backward[i]) << pattern << " match " << i;
+	}
+    ASSERT_EQ(replacer.getStats().matches, reverseSearch.getStats().matches) << pattern;
+}
+
+TEST(ReverseSearchTest, SameMatchesAsForwardSearch) {
+    const std::string text = sampleText();
+    const char *patterns[] = { "ERROR (\\d+)", "^(\\w+)=(\\w*)", "(?<name>[a-z])=(\\d+)", "x*", "^", "$", "\\b", "(a)|(b)|(ERROR)",
+                               "value", "(?<=key)\\d", "\xC3\xB6|\\d", "\\s+ERROR \\d+", "\\d+$" };
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); ++i)
+	{
+        assertReverseOfForward<Utf8CharTraits>(text, patterns[i]);
+        assertReverseOfForward<AnsiCharTraits>(text, patterns[i]);
+	}
+
+    assertReverseOfForward<Utf8CharTraits>(text, "ERROR \\d+", 10);
+    assertReverseOfForward<Utf8CharTraits>(text, "error \\d+", 5000, python_re_flag_ignorecase);
+    assertReverseOfForward<Utf8CharTraits>(text, "^E.*", 0, python_re_flag_dotall | python_re_flag_wholedoc);
+}
+
+TEST(ReverseSearchTest, ShortText) {
+    assertReverseOfForward<Utf8CharTraits>("abc def", "\\w+");
+    assertReverseOfForward<Utf8CharTraits>("abc def", "x*");
+    assertReverseOfForward<Utf8CharTraits>("", "x*");
+    assertReverseOfForward<Utf8CharTraits>("abc\ndef\n", "^");
+}
+
+TEST(ReverseSearchTest, OnlyLineLocalPatternsAreBlockwise) {
+    const std::string text = "one\ntwo\n";
+    ASSERT_TRUE((ReverseSearch<Utf8CharTraits>(text.c_str(), 8, 0, "\\w+", python_re_flag_normal).isBlockwise()));
+    ASSERT_FALSE((ReverseSearch<Utf8CharTraits>(text.c_str(), 8, 0, "\\s+", python_re_flag_normal).isBlockwise()));
+    ASSERT_FALSE((ReverseSearch<Utf8CharTraits>(text.c_str(), 8, 0, "o.", python_re_flag_dotall).isBlockwise()));
+}
+
+TEST(ReverseSearchTest, PreviousMatchOnlySearchesBackToIt) {
+    const std::string text = sampleText();
+    const int textLength = static_cast<int>(text.size());
+
+    Replacer<Utf8CharTraits> replacer;
+    std::vector<std::string> all;
+    replacer.search(text.c_str(), textLength, 0, 0, "key(\\d)", describeMatch, &all, python_re_flag_normal);
+
+    std::vector<std::string> last;
+    ReverseSearch<Utf8CharTraits> reverseSearch(text.c_str(), textLength, 0, "key(\\d)", python_re_flag_normal);
+    reverseSearch.search(1, describeMatch, &last);
+    ASSERT_EQ(1, last.size());
+    ASSERT_EQ(all.back(), last[0]);
+
+    // Only the first block was searched
+    ASSERT_LT(reverseSearch.getStats().regexRuns, replacer.getStats().regexRuns / 10);
+}
+
+TEST(ReverseSearchTest, MaxCountCountsFromTheEnd) {
+    const std::string text = sampleText();
+    const int textLength = static_cast<int>(text.size());
+
+    std::vector<std::string> all;
+    Replacer<AnsiCharTraits> replacer;
+    replacer.search(text.c_str(), textLength, 0, 0, "ERROR (\\d+)", describeMatch, &all, python_re_flag_normal);
+
+    std::vector<std::string> last;
+    ReverseSearch<AnsiCharTraits> reverseSearch(text.c_str(), textLength, 0, "ERROR (\\d+)", python_re_flag_normal);
+    reverseSearch.search(300, describeMatch, &last);
+    ASSERT_EQ(300, last.size());
+    ASSERT_EQ(300, reverseSearch.getStats().matches);
+    for (size_t i = 0; i < last.size(); ++i)
+	{
+        ASSERT_EQ(all[all.size() - 1 - i], last[i]);
+	}
+}
+
+}
@@ -0,0 +1,134 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "ScintillaNotificationArgs.h"
+#include "Scintilla.h"
+
+namespace NppPythonScript
+{
+
+typedef ScintillaNotificationArgs Args;
+
+SCNotification makeNotification(unsigned int code)
+{
+    SCNotification notifyCode;
+    memset(&notifyCode, 0, sizeof(notifyCode));
+    notifyCode.nmhdr.code = code;
+    return notifyCode;
+}
+
+TEST(ScintillaNotificationArgsTest, CharAddedHasOnlyCodeAndCh) {
+    SCNotification notifyCode = makeNotification(SCN_CHARADDED);
+    notifyCode.ch = 'x';
+    notifyCode.position = 99;
+    Args args(&notifyCode);
+
+    ASSERT_EQ(2, args.fieldCount());
+    ASSERT_TRUE(args.has(Args::FIELD_CODE));
+    ASSERT_EQ(SCN_CHARADDED, args.value(Args::FIELD_CODE));
+    ASSERT_TRUE(args.has(Args::FIELD_CH));
+    ASSERT_EQ('x', args.value(Args::FIELD_CH));
+    ASSERT_FALSE(args.has(Args::FIELD_POSITION));
+}
+
+TEST(ScintillaNotificationArgsTest, ModifiedHasTheTextOfItsLength) {
+    SCNotification notifyCode = makeNotification(SCN_MODIFIED);
+    const char text[] = "inserted and more";
+    notifyCode.text = text;
+    notifyCode.length = 8;
+    notifyCode.position = 10;
+    notifyCode.modificationType = SC_MOD_INSERTTEXT;
+    notifyCode.linesAdded = 1;
+    Args args(&notifyCode);
+
+    ASSERT_EQ(11, args.fieldCount());
+    ASSERT_EQ("inserted", args.text());
+    ASSERT_FALSE(args.textIsNone());
+    ASSERT_EQ(10, args.value(Args::FIELD_POSITION));
+    ASSERT_EQ(8, args.value(Args::FIELD_LENGTH));
+    ASSERT_EQ(1, args.value(Args::FIELD_LINESADDED));
+    ASSERT_TRUE(args.has(Args::FIELD_TOKEN));
+    ASSERT_TRUE(args.has(Args::FIELD_ANNOTATIONLINESADDED));
+}
+
+TEST(ScintillaNotificationArgsTest, ModifiedWithoutTextHasEmptyText) {
+    SCNotification notifyCode = makeNotification(SCN_MODIFIED);
+    notifyCode.length = 5;
+    notifyCode.modificationType = SC_MOD_CHANGESTYLE;
+    Args args(&notifyCode);
+
+    ASSERT_TRUE(args.has(Args::FIELD_TEXT));
+    ASSERT_FALSE(args.textIsNone());
+    ASSERT_EQ("", args.text());
+}
+
+TEST(ScintillaNotificationArgsTest, AutoCompleteSelectionTextIsNullTerminated) {
+    SCNotification notifyCode = makeNotification(SCN_AUTOCSELECTION);
+    notifyCode.text = "selected";
+    notifyCode.length = 0;
+    Args args(&notifyCode);
+    ASSERT_EQ("selected", args.text());
+
+    notifyCode.text = NULL;
+    Args noText(&notifyCode);
+    ASSERT_TRUE(noText.has(Args::FIELD_TEXT));
+    ASSERT_TRUE(noText.textIsNone());
+    noText.ownText();
+    ASSERT_TRUE(noText.textIsNone());
+}
+
+TEST(ScintillaNotificationArgsTest, TextIsOnlyCopiedByOwnText) {
+    SCNotification notifyCode = makeNotification(SCN_MODIFIED);
+    char text[] = "inserted";
+    notifyCode.text = text;
+    notifyCode.length = 8;
+    Args args(&notifyCode);
+    Args borrowedCopy(args);
+    ASSERT_FALSE(args.ownsText());
+
+    args.ownText();
+    ASSERT_TRUE(args.ownsText());
+    Args ownedCopy(args);
+    ASSERT_TRUE(ownedCopy.ownsText());
+
+    // Scintilla can reuse the text once the notification returns
+    text[0] = 'X';
+    ASSERT_EQ("inserted", args.text());
+    ASSERT_EQ("inserted", ownedCopy.text());
+    ASSERT_EQ("Xnserted", borrowedCopy.text());
+}
+
+TEST(ScintillaNotificationArgsTest, UnknownCodeHasAllTheFields) {
+    SCNotification notifyCode = makeNotification(4000);
+    Args args(&notifyCode);
+    // Everything but the text (which is NULL), updated, margin, ch and count
+    ASSERT_EQ(Args::NUMBER_OF_FIELDS - 5, args.fieldCount());
+    ASSERT_FALSE(args.has(Args::FIELD_TEXT));
+    ASSERT_TRUE(args.has(Args::FIELD_HWNDFROM));
+}
+
+TEST(ScintillaNotificationArgsTest, FieldsCanBeChangedAndRemoved) {
+    SCNotification notifyCode = makeNotification(SCN_UPDATEUI);
+    notifyCode.updated = SC_UPDATE_SELECTION;
+    Args args(&notifyCode);
+    args.set(Args::FIELD_COUNT, 3);
+    ASSERT_EQ(3, args.value(Args::FIELD_COUNT));
+    ASSERT_EQ(3, args.fieldCount());
+
+    args.remove(Args::FIELD_UPDATED);
+    ASSERT_FALSE(args.has(Args::FIELD_UPDATED));
+    ASSERT_EQ(2, args.fieldCount());
+}
+
+TEST(ScintillaNotificationArgsTest, FieldsAreFoundByTheirDictKeys) {
+    Args::Field field;
+    ASSERT_TRUE(Args::findField("modificationType", field));
+    ASSERT_EQ(Args::FIELD_MODIFICATIONTYPE, field);
+    ASSERT_STREQ("modificationType", Args::fieldName(field));
+    ASSERT_TRUE(Args::findField("count", field));
+    ASSERT_EQ(Args::FIELD_COUNT, field);
+    ASSERT_FALSE(Args::findField("modificationtype", field));
+}
+
+}
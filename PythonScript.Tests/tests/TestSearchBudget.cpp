@@ -0,0 +1,169 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "Replacer.h"
+#include "ParallelSearch.h"
+#include "SearchBudget.h"
+
+namespace NppPythonScript
+{
+
+/** Makes sure the cancel and the time limit don't leak into other tests
+ */
+class SearchBudgetTest : public ::testing::Test
+{
+protected:
+    virtual void TearDown()
+	{
+        SearchBudget::clearCancel();
+        SearchBudget::setTimeLimit(0);
+	}
+
+    static std::string lines(int count)
+	{
+        std::string text;
+        for (int line = 0; line < count; ++line)
+		{
+            text += "key=value 12345\r\n";
+		}
+        return text;
+	}
+};
+
+static bool countMatches(const char * /* text */, Match * /* match */, void *state)
+{
+    ++*reinterpret_cast<long*>(state);
+    return true;
+}
+
+/** Cancels the searches on this thread at the match given in state
+ */
+static bool cancelAtMatch(const char * /* text */, Match * /* match */, void *state)
+{
+    if (0 == --*reinterpret_cast<long*>(state))
+	{
+        SearchBudget::cancelThread(::GetCurrentThreadId());
+	}
+    return true;
+}
+
+/** Takes at least a millisecond for each match
+ */
+static bool slowMatch(const char * /* text */, Match * /* match */, void * /* state */)
+{
+    DWORD start = ::GetTickCount();
+    while (::GetTickCount() - start < 2)
+	{
+	}
+    return true;
+}
+
+TEST_F(SearchBudgetTest, NotStoppedByDefault) {
+    const std::string text = lines(1000);
+    long matches = 0;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.search(text.c_str(), static_cast<int>(text.size()), 0, 0, "(\\w+)=(\\w+)", countMatches, &matches, python_re_flag_normal);
+    ASSERT_EQ(1000, matches);
+    ASSERT_EQ(SEARCH_NOT_STOPPED, replacer.getStats().stopReason);
+}
+
+TEST_F(SearchBudgetTest, CancelStopsTheSearch) {
+    const std::string text = lines(1000);
+    const char *patterns[] = { "(\\w+)=(\\w+)", "value \\d+", "value" };
+    const int flags[] = { python_re_flag_normal, python_re_flag_normal, python_re_flag_literal };
+    const int matchEnds[] = { 9, 15, 9 };    // In each line
+    for (int i = 0; i < 3; ++i)
+	{
+        long cancelAt = 100;
+        Replacer<Utf8CharTraits> replacer;
+        replacer.search(text.c_str(), static_cast<int>(text.size()), 0, 0, patterns[i], cancelAtMatch, &cancelAt, static_cast<python_re_flags>(flags[i]));
+        SearchBudget::clearCancel();
+
+        const SearchStats& stats = replacer.getStats();
+        ASSERT_EQ(SEARCH_CANCELLED, stats.stopReason) << patterns[i];
+        ASSERT_GE(stats.matches, 100) << patterns[i];
+        ASSERT_LE(stats.matches, 100 + static_cast<long>(SearchBudget::CHECK_INTERVAL)) << patterns[i];
+
+        // Everything up to the end of the last match was searched
+        ASSERT_EQ((stats.matches - 1) * 17 + matchEnds[i], stats.stoppedAt) << patterns[i];
+	}
+}
+
+TEST_F(SearchBudgetTest, CancelStopsTheReplace) {
+    const std::string text = lines(1000);
+    SearchBudget::cancelThread(::GetCurrentThreadId());
+
+    ReplacementBatch replacements;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.startReplace(text.c_str(), static_cast<int>(text.size()), 0, 0, "(\\w+)=(\\w+)", "$2=$1", python_re_flag_normal, replacements);
+    ASSERT_EQ(SEARCH_CANCELLED, replacer.getStats().stopReason);
+    ASSERT_EQ(static_cast<size_t>(SearchBudget::CHECK_INTERVAL), replacements.size());
+}
+
+TEST_F(SearchBudgetTest, CancelIsForOneThread) {
+    const std::string text = lines(1000);
+    SearchBudget::cancelThread(::GetCurrentThreadId() + 1);
+
+    long matches = 0;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.search(text.c_str(), static_cast<int>(text.size()), 0, 0, "value", countMatches, &matches, python_re_flag_literal);
+    ASSERT_EQ(1000, matches);
+    ASSERT_EQ(SEARCH_NOT_STOPPED, replacer.getStats().stopReason);
+}
+
+TEST_F(SearchBudgetTest, CancelStopsThePrefilteredCandidates) {
+    // No matches, but the literal is in every line, so there's a regex run for each
+    const std::string text = lines(1000);
+    SearchBudget::cancelThread(::GetCurrentThreadId());
+
+    long matches = 0;
+    Replacer<Utf8CharTraits> replacer;
+    replacer.search(text.c_str(), static_cast<int>(text.size()), 0, 0, "value \\d{6}", countMatches, &matches, python_re_flag_normal);
+    ASSERT_EQ(0, matches);
+    ASSERT_EQ(SEARCH_CANCELLED, replacer.getStats().stopReason);
+    ASSERT_EQ(0, replacer.getStats().stoppedAt);
+    ASSERT_LE(replacer.getStats().regexRuns, static_cast<long>(SearchBudget::CHECK_INTERVAL));
+}
+
+TEST_F(SearchBudgetTest, TimeLimit) {
+    const std::string text = lines(1000);
+    SearchBudget::setTimeLimit(20);
+
+    Replacer<Utf8CharTraits> replacer;
+    replacer.search(text.c_str(), static_cast<int>(text.size()), 0, 0, "value", slowMatch, NULL, python_re_flag_literal);
+    ASSERT_EQ(SEARCH_TIME_LIMIT, replacer.getStats().stopReason);
+    ASSERT_LT(replacer.getStats().matches, 1000);
+}
+
+TEST_F(SearchBudgetTest, CancelStopsSearchMany) {
+    const std::string text = lines(1000);
+    std::vector<std::string> keywords;
+    keywords.push_back("key");
+    keywords.push_back("value");
+    SearchBudget::cancelThread(::GetCurrentThreadId());
+
+    ReplacementBatch replacements;
+    std::vector<std::string> replacementTexts(2, "x");
+    Replacer<Utf8CharTraits> replacer;
+    replacer.startReplaceMany(text.c_str(), static_cast<int>(text.size()), 0, keywords, replacementTexts, python_re_flag_normal, replacements);
+    ASSERT_EQ(SEARCH_CANCELLED, replacer.getStats().stopReason);
+    ASSERT_EQ(static_cast<size_t>(SearchBudget::CHECK_INTERVAL), replacements.size());
+    ASSERT_EQ(replacements.back().end, replacer.getStats().stoppedAt);
+}
+
+TEST_F(SearchBudgetTest, CancelStopsTheParallelChunks) {
+    const std::string text = lines(100000);
+    SearchBudget::cancelThread(::GetCurrentThreadId());
+
+    ParallelSearch<Utf8CharTraits> search(text.c_str(), static_cast<int>(text.size()), 0, 0, "(\\w+)=(\\w+)", python_re_flag_normal);
+    ASSERT_TRUE(search.run(4, 64 * 1024));
+    ASSERT_EQ(SEARCH_CANCELLED, search.getStats().stopReason);
+    ASSERT_LT(search.getStats().matches, 100000);
+
+    long reported = 0;
+    search.reportMatches(countMatches, &reported);
+    ASSERT_EQ(0, reported);
+}
+
+}
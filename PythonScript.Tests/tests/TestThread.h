@@ -0,0 +1,108 @@
+#ifndef TESTTHREAD_20140511_H
+#define TESTTHREAD_20140511_H
+
+// VS2010 has no std::thread or std::mutex, so these are Windows threads and critical sections on Windows, and pthreads
+// elsewhere, so the tests of the code that several threads use at once build anywhere.
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/** Runs a function on a thread of its own, from start() until join() (or the destructor) has waited for it to finish
+ */
+class TestThread
+{
+public:
+    typedef void (*ThreadFunction)(void *param);
+
+    TestThread()
+		: m_function(NULL),
+          m_param(NULL),
+          m_running(false)
+	{}
+
+    ~TestThread() { join(); }
+
+    void start(ThreadFunction function, void *param)
+	{
+        m_function = function;
+        m_param = param;
+#ifdef _WIN32
+        m_thread = ::CreateThread(NULL, 0, threadStart, this, 0, NULL);
+        m_running = (NULL != m_thread);
+#else
+        m_running = (0 == pthread_create(&m_thread, NULL, threadStart, this));
+#endif
+	}
+
+    void join()
+	{
+        if (m_running)
+		{
+#ifdef _WIN32
+            ::WaitForSingleObject(m_thread, INFINITE);
+            ::CloseHandle(m_thread);
+#else
+            pthread_join(m_thread, NULL);
+#endif
+            m_running = false;
+		}
+	}
+
+private:
+    TestThread(const TestThread&);               // copy constructor disabled
+    TestThread& operator = (const TestThread&);  // assignment operator disabled
+
+#ifdef _WIN32
+    static DWORD WINAPI threadStart(LPVOID instance)
+	{
+        static_cast<TestThread*>(instance)->m_function(static_cast<TestThread*>(instance)->m_param);
+        return 0;
+	}
+
+    HANDLE m_thread;
+#else
+    static void *threadStart(void *instance)
+	{
+        static_cast<TestThread*>(instance)->m_function(static_cast<TestThread*>(instance)->m_param);
+        return NULL;
+	}
+
+    pthread_t m_thread;
+#endif
+
+    ThreadFunction m_function;
+    void *m_param;
+    bool m_running;
+};
+
+/** A lock, for the locked versions the benchmarks compare against
+ */
+class TestMutex
+{
+public:
+#ifdef _WIN32
+    TestMutex() { ::InitializeCriticalSection(&m_lock); }
+    ~TestMutex() { ::DeleteCriticalSection(&m_lock); }
+    void lock() { ::EnterCriticalSection(&m_lock); }
+    void unlock() { ::LeaveCriticalSection(&m_lock); }
+#else
+    TestMutex() { pthread_mutex_init(&m_lock, NULL); }
+    ~TestMutex() { pthread_mutex_destroy(&m_lock); }
+    void lock() { pthread_mutex_lock(&m_lock); }
+    void unlock() { pthread_mutex_unlock(&m_lock); }
+#endif
+
+private:
+    TestMutex(const TestMutex&);               // copy constructor disabled
+    TestMutex& operator = (const TestMutex&);  // assignment operator disabled
+
+#ifdef _WIN32
+    CRITICAL_SECTION m_lock;
+#else
+    pthread_mutex_t m_lock;
+#endif
+};
+
+#endif // TESTTHREAD_20140511_H
@@ -0,0 +1,177 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "UTF8Iterator.h"
+#include "BenchmarkTimer.h"
+
+/** Checks that the iterator reads the same characters (with the same lengths) as the Utf8Decoder, 
+ *  which is the reference for how invalid UTF-8 is mapped.
+ */
+static void assertSameAsDecoder(const std::string& text)
+{
+    const char *doc = text.c_str();
+    int length = static_cast<int>(text.size());
+
+    UtfConversion::Utf8Decoder decoder(doc, length);
+    UTF8Iterator it(doc, 0, length);
+    UTF8Iterator end(doc, length, length);
+    for (; !decoder.isEnd(); decoder.advanceToNext())
+	{
+        ASSERT_TRUE(it != end);
+        ASSERT_EQ(decoder.decodedChar(), *it);
+        int start = it.pos();
+        ++it;
+        ASSERT_EQ(static_cast<int>(decoder.decodedLength()), it.pos() - start);
+	}
+    ASSERT_TRUE(it == end);
+}
+
+TEST(UTF8IteratorTest, AllTwoByteSequencesSameAsDecoder) {
+    for (int first = 0; first < 256; ++first)
+	{
+        for (int second = 0; second < 256; ++second)
+		{
+            std::string text;
+            text += static_cast<char>(first);
+            text += static_cast<char>(second);
+            assertSameAsDecoder(text);
+		}
+	}
+}
+
+TEST(UTF8IteratorTest, MultiByteLeadsSameAsDecoder) {
+    // Every lead byte with the interesting continuation ranges, including the overlong forms, surrogates and 
+    // sequences cut short by the end of the text
+    const unsigned char continuations[] = { 0x00, 0x41, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0, 0xE0, 0xFF };
+    const int count = sizeof(continuations) / sizeof(continuations[0]);
+    for (int first = 0x80; first < 256; ++first)
+	{
+        for (int i = 0; i < count; ++i)
+		{
+            for (int j = 0; j < count; ++j)
+			{
+                for (int k = 0; k < count; ++k)
+				{
+                    std::string text;
+                    text += static_cast<char>(first);
+                    text += static_cast<char>(continuations[i]);
+                    text += static_cast<char>(continuations[j]);
+                    text += static_cast<char>(continuations[k]);
+                    assertSameAsDecoder(text);
+                    assertSameAsDecoder(text.substr(0, 3));
+				}
+			}
+		}
+	}
+}
+
+TEST(UTF8IteratorTest, RandomTextSameAsDecoder) {
+    unsigned int seed = 42;
+    for (int n = 0; n < 200; ++n)
+	{
+        // Mostly ASCII, with runs long enough to cross the 16 byte blocks of the ASCII scan
+        std::string text;
+        for (int i = 0; i < 300; ++i)
+		{
+            seed = seed * 1103515245 + 12345;
+            unsigned int r = (seed >> 16) & 0x7FFF;
+            text += static_cast<char>(r % 23 == 0 ? 0x80 + (r >> 5) % 0x80 : 'a' + r % 26);
+		}
+        assertSameAsDecoder(text);
+	}
+}
+
+TEST(UTF8IteratorTest, BackwardsThenForwardsInMixedText) {
+    std::string text("abc\xC3\xA4" "def\xE2\x82\xAC" "ghijklmnopqrstuvwxyz");
+    const char *doc = text.c_str();
+    int length = static_cast<int>(text.size());
+
+    UTF8Iterator it(doc, 0, length);
+    for (int i = 0; i < 8; ++i)
+	{
+        ++it;
+	}
+    ASSERT_EQ('g', *it);
+    --it;
+    ASSERT_EQ(0x20AC, *it);
+    --it;
+    --it;
+    --it;
+    --it;
+    ASSERT_EQ(0xE4, *it);
+    ++it;
+    ASSERT_EQ('d', *it);
+    ++it;
+    ++it;
+    ++it;
+    ASSERT_EQ(0x20AC, *it);
+    ++it;
+    ASSERT_EQ('g', *it);
+}
+
+/** Reads the text with the iterator, and with a Utf8Decoder per character (as the iterator used to), and prints the throughput of both.
+ */
+static void benchmarkIterator(const char *name, const std::string& text)
+{
+    const char *doc = text.c_str();
+    int length = static_cast<int>(text.size());
+    const int passes = 10;
+    double megabytes = static_cast<double>(length) * passes / (1024 * 1024);
+
+    U32 iteratorSum = 0;
+    BenchmarkTimer iteratorTimer;
+    for (int pass = 0; pass < passes; ++pass)
+	{
+        UTF8Iterator end(doc, length, length);
+        for (UTF8Iterator it(doc, 0, length); it != end; ++it)
+		{
+            iteratorSum += *it;
+		}
+	}
+    double iteratorElapsed = iteratorTimer.elapsedMilliseconds();
+
+    U32 decoderSum = 0;
+    BenchmarkTimer decoderTimer;
+    for (int pass = 0; pass < passes; ++pass)
+	{
+        for (int pos = 0; pos < length; )
+		{
+            UtfConversion::Utf8Decoder decoder(doc + pos, length - pos);
+            decoderSum += decoder.decodedChar();
+            pos += decoder.decodedLength();
+		}
+	}
+    double decoderElapsed = decoderTimer.elapsedMilliseconds();
+
+    ASSERT_EQ(decoderSum, iteratorSum);
+    printf("%s: iterator %.0fMB/s, decoder per character %.0fMB/s\n", name, megabytes * 1000 / iteratorElapsed, megabytes * 1000 / decoderElapsed);
+}
+
+TEST(UTF8IteratorTest, DISABLED_BenchmarkAscii) {
+    std::string text;
+    while (text.size() < 4 * 1024 * 1024)
+	{
+        text += "The quick brown fox jumps over the lazy dog; int main() { return 0; }\r\n";
+	}
+    benchmarkIterator("ASCII", text);
+}
+
+TEST(UTF8IteratorTest, DISABLED_BenchmarkMixedCjk) {
+    std::string text;
+    while (text.size() < 4 * 1024 * 1024)
+	{
+        text += "id=42 \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88 value \xE4\xB8\xAD\xE6\x96\x87\r\n";
+	}
+    benchmarkIterator("Mixed CJK", text);
+}
+
+TEST(UTF8IteratorTest, DISABLED_BenchmarkInvalidHeavy) {
+    // Latin-1 text read as UTF-8, so every accented letter is an invalid byte
+    std::string text;
+    while (text.size() < 4 * 1024 * 1024)
+	{
+        text += "Caf\xE9 cr\xE8me br\xFBl\xE9" "e \xE0 la fran\xE7" "aise, na\xEFve \xFC" "ber \xC3\r\n";
+	}
+    benchmarkIterator("Invalid heavy", text);
+}
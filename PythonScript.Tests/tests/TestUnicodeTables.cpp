@@ -0,0 +1,153 @@
+#include "stdafx.h"
+
+
+#include <gtest/gtest.h>
+#include "UnicodeTables.h"
+#include "UTF8Iterator.h"
+#include "BenchmarkTimer.h"
+
+/** Asks Windows for the CT_CTYPE1 classes of a code point, as u32_regex_traits::isctype used to.
+ */
+static unsigned short windowsCharacterType(U32 c)
+{
+    U16_char u16c = UtfConversion::toUtf16(c);
+    WORD char_class[2] = { 0, 0 };
+    ::GetStringTypeExW(LOCALE_USER_DEFAULT, CT_CTYPE1, u16c, u16c.length(), &char_class[0]);
+    return char_class[0];
+}
+
+TEST(UnicodeTablesTest, CaseMappings) {
+    ASSERT_EQ('a', UnicodeTables::foldCase('A'));
+    ASSERT_EQ('a', UnicodeTables::foldCase('a'));
+    ASSERT_EQ(0xE4, UnicodeTables::foldCase(0xC4));
+    ASSERT_EQ('k', UnicodeTables::foldCase(0x212A));         // KELVIN SIGN
+    ASSERT_EQ(0x1C6, UnicodeTables::foldCase(0x1C5));        // Titlecase DZ with caron
+    ASSERT_EQ(0x10428, UnicodeTables::foldCase(0x10400));    // Deseret, outside the BMP
+
+    ASSERT_EQ('A', UnicodeTables::toUpper('a'));
+    ASSERT_EQ('A', UnicodeTables::toUpper('A'));
+    ASSERT_EQ(0xC4, UnicodeTables::toUpper(0xE4));
+    ASSERT_EQ(0x1C4, UnicodeTables::toUpper(0x1C6));
+    ASSERT_EQ(0xDF, UnicodeTables::toUpper(0xDF));           // Uppercase is "SS", so no simple mapping
+    ASSERT_EQ(0x1F88, UnicodeTables::toUpper(0x1F80));       // Uppercase has two code points, so the titlecase is used
+    ASSERT_EQ(0x10400, UnicodeTables::toUpper(0x10428));
+
+    // Not characters, so unchanged
+    ASSERT_EQ(0xD800, UnicodeTables::foldCase(0xD800));
+    ASSERT_EQ(0x110000, UnicodeTables::toUpper(0x110000));
+}
+
+/** Values that GetStringTypeEx is known to return, including where Windows differs from a plain reading of the Unicode database
+ */
+TEST(UnicodeTablesTest, CharacterTypesOfKnownCharacters) {
+    ASSERT_EQ(C1_ALPHA | C1_UPPER | C1_XDIGIT | C1_DEFINED, UnicodeTables::characterType('A'));
+    ASSERT_EQ(C1_ALPHA | C1_LOWER | C1_DEFINED, UnicodeTables::characterType('z'));
+    ASSERT_EQ(C1_DIGIT | C1_XDIGIT | C1_DEFINED, UnicodeTables::characterType('7'));
+    ASSERT_EQ(C1_PUNCT | C1_DEFINED, UnicodeTables::characterType('_'));
+    ASSERT_EQ(C1_SPACE | C1_BLANK | C1_DEFINED, UnicodeTables::characterType(' '));
+    ASSERT_EQ(C1_SPACE | C1_BLANK | C1_CNTRL | C1_DEFINED, UnicodeTables::characterType('\t'));
+    ASSERT_EQ(C1_SPACE | C1_CNTRL | C1_DEFINED, UnicodeTables::characterType('\r'));
+    ASSERT_EQ(C1_SPACE | C1_CNTRL | C1_DEFINED, UnicodeTables::characterType(0x85));
+    ASSERT_EQ(C1_SPACE | C1_BLANK | C1_DEFINED, UnicodeTables::characterType(0xA0));
+    ASSERT_EQ(C1_SPACE | C1_BLANK | C1_DEFINED, UnicodeTables::characterType(0x3000));
+    ASSERT_EQ(C1_SPACE | C1_BLANK | C1_CNTRL | C1_DEFINED, UnicodeTables::characterType(0xFEFF));
+    ASSERT_EQ(C1_PUNCT | C1_CNTRL | C1_DEFINED, UnicodeTables::characterType(0xAD));
+    ASSERT_EQ(C1_DIGIT | C1_PUNCT | C1_DEFINED, UnicodeTables::characterType(0xB2));
+    ASSERT_EQ(C1_PUNCT | C1_DEFINED, UnicodeTables::characterType(0xBD));
+    ASSERT_EQ(C1_ALPHA | C1_UPPER | C1_LOWER | C1_DEFINED, UnicodeTables::characterType(0x1C5));
+    ASSERT_EQ(C1_ALPHA | C1_UPPER | C1_LOWER | C1_DEFINED, UnicodeTables::characterType(0x1F88));
+    ASSERT_EQ(C1_ALPHA | C1_LOWER | C1_DEFINED, UnicodeTables::characterType(0x2071));
+    ASSERT_EQ(C1_ALPHA | C1_DEFINED, UnicodeTables::characterType(0x2160));
+    ASSERT_EQ(C1_DEFINED, UnicodeTables::characterType(0x903));
+    ASSERT_EQ(C1_CNTRL | C1_DEFINED, UnicodeTables::characterType(0x600));
+    ASSERT_EQ(C1_DIGIT | C1_XDIGIT | C1_DEFINED, UnicodeTables::characterType(0xFF13));
+    ASSERT_EQ(C1_ALPHA | C1_DEFINED, UnicodeTables::characterType(0x65E5));
+    ASSERT_EQ(0, UnicodeTables::characterType(0x110000));
+
+    // Outside the BMP, the type of the lead surrogate (which is what GetStringTypeEx gave for the first UTF-16 unit)
+    ASSERT_EQ(UnicodeTables::characterType(0xD801), UnicodeTables::characterType(0x10400));
+}
+
+/** Windows' tables are for a different version of Unicode than the generated ones (14.0), so only ASCII must agree exactly.
+ *  Of the BMP characters already assigned in Unicode 3.2, 159 have a different type in 14.0 (mostly Cherokee, which became
+ *  cased letters), and Windows' tables are newer than 3.2, so any more differences than that are a problem with the rules
+ *  in CreateUnicodeTables.py.
+ */
+TEST(UnicodeTablesTest, CharacterTypesSameAsGetStringTypeEx) {
+    const int maxUnicodeVersionDifferences = 159;
+    int differences = 0;
+    for (U32 c = 0; c < 0x10000; ++c)
+	{
+        if (c >= 0xD800 && c <= 0xDFFF)
+		{
+            continue;
+		}
+
+        unsigned short windows = windowsCharacterType(c);
+        if (c < 0x80)
+		{
+            ASSERT_EQ(windows, UnicodeTables::characterType(c)) << "U+" << std::hex << c;
+		}
+        else if ((windows & C1_DEFINED) && windows != UnicodeTables::characterType(c))
+		{
+            ++differences;
+		}
+	}
+    ASSERT_LE(differences, maxUnicodeVersionDifferences);
+}
+
+TEST(UnicodeTablesTest, RegexClassesUseTheTables) {
+    const u32_regex_traits::charT word[] = { 'w' };
+    u32_regex_traits::char_class_type wordClass = u32_regex_traits::lookup_classname(word, word + 1);
+    ASSERT_TRUE(u32_regex_traits::isctype('_', wordClass));
+    ASSERT_TRUE(u32_regex_traits::isctype(0xE4, wordClass));
+    ASSERT_TRUE(u32_regex_traits::isctype(0x65E5, wordClass));
+    ASSERT_FALSE(u32_regex_traits::isctype(' ', wordClass));
+    ASSERT_FALSE(u32_regex_traits::isctype(0x3000, wordClass));
+
+    ASSERT_EQ(0x1C6, u32_regex_traits::tolower(0x1C4));
+    ASSERT_EQ('k', u32_regex_traits::tolower(0x212A));
+    ASSERT_EQ(0x1C4, u32_regex_traits::toupper(0x1C6));
+}
+
+/** Classifies every character of a mixed text with the tables, and with a call to GetStringTypeEx per character (as isctype used to).
+ */
+TEST(UnicodeTablesTest, DISABLED_BenchmarkCharacterType) {
+    std::vector<U32> text;
+    const U32 sample[] = { 'i', 'd', '=', '4', '2', ' ', 0x65E5, 0x672C, 0x8A9E, ' ', 'C', 'a', 'f', 0xE9, '\t', 0x3B1, 0x3B2, '\r', '\n' };
+    while (text.size() < 4 * 1024 * 1024)
+	{
+        text.insert(text.end(), sample, sample + sizeof(sample) / sizeof(sample[0]));
+	}
+
+    const int passes = 5;
+    double millions = static_cast<double>(text.size()) * passes / 1000000;
+    const unsigned short wordMask = C1_ALPHA | C1_DIGIT;
+
+    int tableCount = 0;
+    BenchmarkTimer tableTimer;
+    for (int pass = 0; pass < passes; ++pass)
+	{
+        for (std::vector<U32>::const_iterator it = text.begin(); it != text.end(); ++it)
+		{
+            if (UnicodeTables::characterType(*it) & wordMask)
+                ++tableCount;
+		}
+	}
+    double tableElapsed = tableTimer.elapsedMilliseconds();
+
+    int windowsCount = 0;
+    BenchmarkTimer windowsTimer;
+    for (int pass = 0; pass < passes; ++pass)
+	{
+        for (std::vector<U32>::const_iterator it = text.begin(); it != text.end(); ++it)
+		{
+            if (windowsCharacterType(*it) & wordMask)
+                ++windowsCount;
+		}
+	}
+    double windowsElapsed = windowsTimer.elapsedMilliseconds();
+
+    ASSERT_EQ(windowsCount, tableCount);
+    printf("Character types: tables %.0fM chars/s, GetStringTypeEx per character %.0fM chars/s\n", millions * 1000 / tableElapsed, millions * 1000 / windowsElapsed);
+}
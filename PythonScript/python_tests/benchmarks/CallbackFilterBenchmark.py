@@ -0,0 +1,31 @@
+# -*- coding: utf-8 -*-
+# Times typing into the editor with a synchronous SCN_MODIFIED callback that only wants deletions, written the usual
+# way (returning straight away in Python for anything else), and with a filter that notify() checks before it takes
+# the GIL.  Typing only inserts, so with the filter the callback is never called, and should cost next to nothing -
+# the delivered and filtered counts from editor.getCallbackStats() show which notifications reached Python.
+from Npp import *
+from npp_unit_tests.benchmarks.TypingBenchmark import timeTyping, runInNewDocument
+
+def deletedInPython(args):
+    if not (args['modificationType'] & MODIFICATIONFLAGS.DELETETEXT):
+        return
+
+def deleted(args):
+    pass
+
+def runBenchmark():
+    console.write('%-30s %16s %12s %12s\n' % ('callback', 'us per key press', 'delivered', 'filtered'))
+    cases = [
+        ('none', None, None),
+        ('checks in Python', deletedInPython, None),
+        ('native filter', deleted, {'modificationType': MODIFICATIONFLAGS.DELETETEXT})
+        ]
+    for (name, callback, filter) in cases:
+        editor.clearCallbacks()
+        if callback:
+            editor.callbackSync(callback, [SCINTILLANOTIFICATION.MODIFIED], filter)
+        elapsed = timeTyping()
+        stats = editor.getCallbackStats(callback) if callback else {'delivered': 0, 'filtered': 0}
+        console.write('%-30s %16.1f %12d %12d\n' % (name, elapsed, stats['delivered'], stats['filtered']))
+
+runInNewDocument(runBenchmark)
@@ -0,0 +1,61 @@
+# -*- coding: utf-8 -*-
+# Times typing into the editor with a synchronous SCN_MODIFIED callback that reads one field of its args, one that reads
+# them all, and one that copies them into a dict, as notify() used to give every callback.  The args only make a Python
+# object for a field when it is read, so the callback that reads one field should be the cheapest.
+#
+# The memory blocks allocated per notification are counted with sys.getallocatedblocks() (Python 3.4 and later).  Each
+# callback keeps the args and what it read until the end of the run, so everything that was allocated for them is still
+# counted, and the count without a callback is taken off.
+import sys
+from Npp import *
+from npp_unit_tests.benchmarks.TypingBenchmark import KEY_PRESSES, timeTyping, runInNewDocument
+
+kept = []
+
+def readOneField(args):
+    kept.append((args, args['modificationType']))
+
+def readAllFields(args):
+    kept.append((args, args.items()))
+
+def copyToDict(args):
+    kept.append((args, args.copy()))
+
+def allocatedBlocks():
+    return sys.getallocatedblocks() if hasattr(sys, 'getallocatedblocks') else None
+
+def timeAndCountBlocks():
+    del kept[:]
+    blocksBefore = allocatedBlocks()
+    elapsed = timeTyping()
+    blocksAfter = allocatedBlocks()
+    notifications = len(kept)
+    del kept[:]
+    if blocksBefore is None:
+        return (elapsed, notifications, None)
+    return (elapsed, notifications, blocksAfter - blocksBefore)
+
+def runBenchmark():
+    console.write('%-30s %16s %14s %22s\n' % ('callback', 'us per key press', 'notifications', 'blocks per notification'))
+    cases = [
+        ('none', None),
+        ('reads one field', readOneField),
+        ('reads all fields', readAllFields),
+        ('copies to a dict (as before)', copyToDict)
+        ]
+    baseBlocks = 0
+    for (name, callback) in cases:
+        editor.clearCallbacks()
+        if callback:
+            editor.callbackSync(callback, [SCINTILLANOTIFICATION.MODIFIED])
+        (elapsed, notifications, blocks) = timeAndCountBlocks()
+        if blocks is None:
+            perNotification = 'needs Python 3.4'
+        elif callback is None:
+            baseBlocks = blocks
+            perNotification = '%.2f per key press' % (float(blocks) / KEY_PRESSES)
+        else:
+            perNotification = '%.2f' % (float(blocks - baseBlocks) / notifications)
+        console.write('%-30s %16.1f %14d %22s\n' % (name, elapsed, notifications, perNotification))
+
+runInNewDocument(runBenchmark)
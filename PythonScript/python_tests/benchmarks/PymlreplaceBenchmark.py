@@ -0,0 +1,56 @@
+# -*- coding: utf-8 -*-
+# Times editor.pymlreplace(), which finds all the matches with one finditer() pass and then replaces them together,
+# against the way it used to work: a re.search() from Python, then a target replace in Scintilla, for each match in turn.
+#
+# Run from the Python Script console, the results are written to the console.
+import re
+import time
+from Npp import *
+
+MATCH_COUNTS = [1000, 10000, 100000]
+
+def makeDocument(matchCount):
+    editor.setText(''.join('key%d = value%d\r\n' % (line, line) for line in range(matchCount)))
+    editor.emptyUndoBuffer()
+
+def perMatchReplace(search, replace):
+    """ The pymlreplace() of version 0.9 """
+    contents = editor.getText()
+    expression = re.compile(search, re.MULTILINE)
+    offset = 0
+    position = 0
+    editor.beginUndoAction()
+    match = expression.search(contents, position)
+    while match:
+        replacement = match.expand(replace)
+        editor.setTargetStart(match.start() + offset)
+        editor.setTargetEnd(match.end() + offset)
+        editor.replaceTarget(replacement)
+        offset += len(replacement) - (match.end() - match.start())
+        position = match.end()
+        match = expression.search(contents, position)
+    editor.endUndoAction()
+
+def timeReplace(replaceFunction, matchCount):
+    makeDocument(matchCount)
+    start = time.clock()
+    replaceFunction(r'^key(\d+) = (\w+)$', r'\2 = key\1')
+    elapsed = time.clock() - start
+    if editor.getLineCount() != matchCount + 1 or not editor.getLine(0).startswith('value0 = key0'):
+        console.writeError('Unexpected result for %d matches\n' % matchCount)
+    return elapsed
+
+def runBenchmark():
+    notepad.new()
+    try:
+        console.write('%10s %12s %12s\n' % ('matches', 'per match', 'batched'))
+        for matchCount in MATCH_COUNTS:
+            perMatch = timeReplace(perMatchReplace, matchCount)
+            batched = timeReplace(editor.pymlreplace, matchCount)
+            console.write('%10d %11.3fs %11.3fs\n' % (matchCount, perMatch, batched))
+    finally:
+        editor.setSavePoint()
+        notepad.close()
+
+console.show()
+runBenchmark()
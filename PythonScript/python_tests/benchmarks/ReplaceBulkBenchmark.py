@@ -0,0 +1,45 @@
+# -*- coding: utf-8 -*-
+# Times editor.rereplace() replacing each match separately against rebuilding the text in one go
+# (see editor.setBulkReplaceThreshold), for increasing numbers of matches in a document of a fixed size.
+# The crossover is where the bulk time drops below the per match time - the default threshold should be around there.
+#
+# Run from the Python Script console, the results are written to the console.
+import time
+from Npp import *
+
+DOCUMENT_LINES = 200000
+MATCH_COUNTS = [10, 100, 300, 1000, 3000, 10000, 30000, 100000, 200000]
+
+def timeReplace(threshold, matchCount):
+    # Every (DOCUMENT_LINES / matchCount)th line has a match, so the matches are spread across the whole document
+    step = DOCUMENT_LINES // matchCount
+    lines = []
+    for line in range(DOCUMENT_LINES):
+        if line % step == 0:
+            lines.append('line %d has a MATCH in it\r\n' % line)
+        else:
+            lines.append('line %d has nothing in it\r\n' % line)
+    editor.setText(''.join(lines))
+    editor.emptyUndoBuffer()
+
+    editor.setBulkReplaceThreshold(threshold)
+    start = time.clock()
+    editor.rereplace('MATCH', 'REPLACEMENT')
+    return time.clock() - start
+
+def runBenchmark():
+    originalThreshold = editor.getBulkReplaceThreshold()
+    notepad.new()
+    try:
+        console.write('%10s %12s %12s\n' % ('matches', 'per match', 'bulk'))
+        for matchCount in MATCH_COUNTS:
+            perMatch = timeReplace(0, matchCount)
+            bulk = timeReplace(1, matchCount)
+            console.write('%10d %11.3fs %11.3fs\n' % (matchCount, perMatch, bulk))
+    finally:
+        editor.setBulkReplaceThreshold(originalThreshold)
+        editor.setSavePoint()
+        notepad.close()
+
+console.show()
+runBenchmark()
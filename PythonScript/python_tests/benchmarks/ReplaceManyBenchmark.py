@@ -0,0 +1,41 @@
+# -*- coding: utf-8 -*-
+# Times a separate editor.replace() for each of a list of mappings against one editor.replaceMany() for all of them,
+# for increasing numbers of mappings in a document of a fixed size.
+#
+# Run from the Python Script console, the results are written to the console.
+import time
+from Npp import *
+from npp_unit_tests.benchmarks.TypingBenchmark import makeDocument
+
+MAPPING_COUNTS = [1, 10, 50, 100, 300, 1000]
+
+def timeSeparate(mappings):
+    makeDocument()
+    start = time.clock()
+    for search, replace in mappings:
+        editor.replace(search, replace)
+    return time.clock() - start, editor.getText()
+
+def timeReplaceMany(mappings):
+    makeDocument()
+    start = time.clock()
+    editor.replaceMany(mappings)
+    return time.clock() - start, editor.getText()
+
+def runBenchmark():
+    notepad.new()
+    try:
+        console.write('%10s %12s %12s\n' % ('mappings', 'separate', 'replaceMany'))
+        for mappingCount in MAPPING_COUNTS:
+            mappings = [('token%d;' % ((mapping * 7919) % 100000), 'replaced%d;' % mapping) for mapping in range(mappingCount)]
+            separate, separateText = timeSeparate(mappings)
+            many, manyText = timeReplaceMany(mappings)
+            if separateText != manyText:
+                console.writeError('different results for %d mappings\n' % mappingCount)
+            console.write('%10d %11.3fs %11.3fs\n' % (mappingCount, separate, many))
+    finally:
+        editor.setSavePoint()
+        notepad.close()
+
+console.show()
+runBenchmark()
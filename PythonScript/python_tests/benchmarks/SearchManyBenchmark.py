@@ -0,0 +1,41 @@
+# -*- coding: utf-8 -*-
+# Times a separate editor.search() for each of a list of keywords against one editor.searchMany() for all of them,
+# for increasing numbers of keywords in a document of a fixed size.
+#
+# Run from the Python Script console, the results are written to the console.
+import time
+from Npp import *
+from npp_unit_tests.benchmarks.TypingBenchmark import makeDocument
+
+KEYWORD_COUNTS = [1, 10, 50, 100, 500, 1000]
+
+def timeSeparate(keywords):
+    found = []
+    start = time.clock()
+    for index, keyword in enumerate(keywords):
+        editor.search(keyword, lambda m: found.append(index))
+    return time.clock() - start, len(found)
+
+def timeSearchMany(keywords):
+    start = time.clock()
+    found = editor.searchMany(keywords)
+    return time.clock() - start, len(found)
+
+def runBenchmark():
+    notepad.new()
+    try:
+        makeDocument()
+        console.write('%10s %10s %12s %12s\n' % ('keywords', 'matches', 'separate', 'searchMany'))
+        for keywordCount in KEYWORD_COUNTS:
+            keywords = ['token%d;' % ((keyword * 7919) % 100000) for keyword in range(keywordCount)]
+            separate, separateMatches = timeSeparate(keywords)
+            many, manyMatches = timeSearchMany(keywords)
+            if separateMatches != manyMatches:
+                console.writeError('different numbers of matches for %d keywords: %d and %d\n' % (keywordCount, separateMatches, manyMatches))
+            console.write('%10d %10d %11.3fs %11.3fs\n' % (keywordCount, manyMatches, separate, many))
+    finally:
+        editor.setSavePoint()
+        notepad.close()
+
+console.show()
+runBenchmark()
@@ -0,0 +1,43 @@
+# -*- coding: utf-8 -*-
+# The harness shared by the benchmarks of editor callbacks (TypingLatencyBenchmark, NotificationArgsBenchmark and
+# CallbackFilterBenchmark): each one types into a new document with different callbacks registered, and writes the
+# time per key press to the console.  makeDocument() writes the large document that SearchManyBenchmark and
+# ReplaceManyBenchmark search.
+#
+# Run the benchmarks from the Python Script console, this module on its own does nothing.
+import time
+from Npp import *
+
+KEY_PRESSES = 5000
+DOCUMENT_LINES = 200000
+
+def timeTyping(keyPresses = KEY_PRESSES):
+    """Clears the document and adds keyPresses characters one at a time, with a line break every 80, as typing would.
+    Every callback registered is called as usual.  Returns the microseconds per key press."""
+    editor.clearAll()
+    start = time.clock()
+    for key in range(keyPresses):
+        editor.addText('x' if key % 80 else '\n')
+    return (time.clock() - start) * 1000000.0 / keyPresses
+
+def makeDocument(documentLines = DOCUMENT_LINES):
+    """Replaces the text of the document with documentLines lines of assignments, each with a token to search for,
+    and empties the undo buffer."""
+    lines = []
+    for line in range(documentLines):
+        lines.append('name%d = token%d; // value %d\r\n' % (line % 1000, (line * 31) % 100000, line))
+    editor.setText(''.join(lines))
+    editor.emptyUndoBuffer()
+
+def runInNewDocument(benchmark):
+    """Shows the console, and calls benchmark() with a new document open and no editor callbacks registered.
+    The callbacks are cleared and the document closed afterwards, even if the benchmark fails."""
+    console.show()
+    notepad.new()
+    editor.clearCallbacks()
+    try:
+        benchmark()
+    finally:
+        editor.clearCallbacks()
+        editor.setSavePoint()
+        notepad.close()
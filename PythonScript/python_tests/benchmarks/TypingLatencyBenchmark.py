@@ -0,0 +1,36 @@
+# -*- coding: utf-8 -*-
+# Times typing into the editor with no callbacks, with one, and with many.  Each key press sends several notifications
+# (SCN_MODIFIED, SCN_CHARADDED, SCN_UPDATEUI, SCN_PAINTED...), and the ones no script asked for should return without
+# waiting for the GIL - so the callbacks on SCN_DWELLSTART, which typing never sends, should cost next to nothing.
+from Npp import *
+from npp_unit_tests.benchmarks.TypingBenchmark import timeTyping, runInNewDocument
+
+MANY_CALLBACKS = 50
+
+def charAdded(args):
+    pass
+
+def dwellStart(args):
+    pass
+
+def registerCallbacks(callback, event, count):
+    for index in range(count):
+        # A separate function each time, as the same function registered again would just be called again
+        editor.callbackSync(lambda args: callback(args), [event])
+
+def runBenchmark():
+    console.write('%-40s %16s\n' % ('callbacks', 'us per key press'))
+    cases = [
+        ('none', None, None, 0),
+        ('1 on SCN_DWELLSTART', dwellStart, SCINTILLANOTIFICATION.DWELLSTART, 1),
+        ('%d on SCN_DWELLSTART' % MANY_CALLBACKS, dwellStart, SCINTILLANOTIFICATION.DWELLSTART, MANY_CALLBACKS),
+        ('1 on SCN_CHARADDED', charAdded, SCINTILLANOTIFICATION.CHARADDED, 1),
+        ('%d on SCN_CHARADDED' % MANY_CALLBACKS, charAdded, SCINTILLANOTIFICATION.CHARADDED, MANY_CALLBACKS)
+        ]
+    for (name, callback, event, count) in cases:
+        editor.clearCallbacks()
+        if count:
+            registerCallbacks(callback, event, count)
+        console.write('%-40s %16.1f\n' % (name, timeTyping()))
+
+runInNewDocument(runBenchmark)
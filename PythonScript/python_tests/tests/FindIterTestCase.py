@@ -0,0 +1,54 @@
+# -*- coding: utf-8 -*-
+import unittest
+import re
+from Npp import *
+
+class FindIterTestCase(unittest.TestCase):
+    def setUp(self):
+        notepad.new()
+        notepad.runMenuCommand("Encoding", "Encode in UTF-8")
+        editor.write('abc123 def5432 gh98\r\näbc123 üef5432 öh98\r\n')
+        
+    def tearDown(self):
+        editor.setSavePoint()
+        notepad.close()
+
+    def test_finditer(self):
+        matches = [(m.start(), m.end(), m.group()) for m in editor.finditer('([äüöa-z]+)([0-9]+)')]
+        self.assertEquals(matches, [(0, 6, 'abc123'), (7, 14, 'def5432'), (15, 19, 'gh98'),
+                                    (21, 28, 'äbc123'), (29, 37, 'üef5432'), (38, 43, 'öh98')])
+
+    def test_finditer_same_as_research(self):
+        found = []
+        editor.research('[a-z]+(?=[0-9]{3})|$', lambda m: found.append(m.span()))
+        self.assertEquals([m.span() for m in editor.finditer('[a-z]+(?=[0-9]{3})|$')], found)
+
+    def test_finditer_flags_start_end(self):
+        matches = [m.group(1) for m in editor.finditer('([A-Z]+)[0-9]+', re.IGNORECASE, 3, 40)]
+        self.assertEquals(matches, ['def', 'gh', 'äbc', 'üef'])
+
+    def test_finditer_is_lazy(self):
+        matches = editor.finditer('[0-9]+')
+        self.assertEquals(matches.next().group(), '123')
+        self.assertEquals(matches.next().group(), '5432')
+
+    def test_matches_can_be_kept(self):
+        matches = list(editor.finditer('([a-z]+)([0-9]+)'))
+        self.assertEquals(len(matches), 3)
+        self.assertEquals(matches[1].group(2), '5432')
+        self.assertEquals(matches[2].expand(r'\2\1'), '98gh')
+
+    def test_edit_during_finditer(self):
+        matches = editor.finditer('[0-9]+')
+        first = matches.next()
+        editor.insertText(0, 'x')
+        with self.assertRaisesRegexp(RuntimeError, 'changed'):
+            matches.next()
+        with self.assertRaisesRegexp(RuntimeError, 'changed'):
+            first.group()
+        self.assertEquals(first.span(), (3, 6))
+
+    def test_finditer_bad_pattern(self):
+        self.assertRaises(RuntimeError, editor.finditer, '([a-z]')
+
+suite = unittest.TestLoader().loadTestsFromTestCase(FindIterTestCase)
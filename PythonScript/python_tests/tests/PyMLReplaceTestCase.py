@@ -0,0 +1,39 @@
+# -*- coding: utf-8 -*-
+import unittest
+import re
+from Npp import *
+
+class PyMLReplaceTestCase(unittest.TestCase):
+    def setUp(self):
+        notepad.new()
+        notepad.runMenuCommand("Encoding", "Encode in UTF-8")
+        editor.write('one=1\r\ntwo=22\r\nÄpfel=333\r\n')
+        
+    def tearDown(self):
+        editor.setSavePoint()
+        notepad.close()
+
+    def test_replace_all(self):
+        editor.pymlreplace(r'^(\w+)=(\d+)$', r'\2=\1')
+        self.assertEqual(editor.getText(), '1=one\r\n22=two\r\n333=Äpfel\r\n')
+
+    def test_matches_across_lines(self):
+        editor.pymlreplace(r'\d+\r\n(\w)', r'|\1')
+        self.assertEqual(editor.getText(), 'one=|two=|Äpfel=333\r\n')
+
+    def test_count_and_flags(self):
+        editor.pymlreplace(r'^[A-Z]+', 'X', 1, re.IGNORECASE)
+        self.assertEqual(editor.getText(), 'X=1\r\ntwo=22\r\nÄpfel=333\r\n')
+
+    def test_start_and_end(self):
+        editor.pymlreplace(r'\d', '#', 0, 0, 3, 12)
+        self.assertEqual(editor.getText(), 'one=#\r\ntwo=##\r\nÄpfel=333\r\n')
+
+    def test_replacement_is_one_undo_action(self):
+        editor.pymlreplace(r'\d', '#')
+        self.assertEqual(editor.getText(), 'one=#\r\ntwo=##\r\nÄpfel=###\r\n')
+        editor.undo()
+        self.assertEqual(editor.getText(), 'one=1\r\ntwo=22\r\nÄpfel=333\r\n')
+
+
+suite = unittest.TestLoader().loadTestsFromTestCase(PyMLReplaceTestCase)
@@ -0,0 +1,91 @@
+# -*- coding: utf-8 -*-
+import unittest
+import re
+from Npp import *
+
+class PyReplaceTestCase(unittest.TestCase):
+    def setUp(self):
+        notepad.new()
+        notepad.runMenuCommand("Encoding", "Encode in UTF-8")
+        editor.write('Code: ABCD and more  \r\nCode: XY\r\n  Code: EFGHIJ\r\nlast Äpfel line')
+        
+    def tearDown(self):
+        editor.setSavePoint()
+        notepad.close()
+
+    def old_engine(self, search, replace, count=0, flags=0, startLine=0, endLine=None):
+        """ Runs pyreplace with Python's re module, and returns the text it gives, then undoes it """
+        before = editor.getText()
+        editor.pyreplace(search, replace, count, flags | editor.RE_PYTHONENGINE, startLine, endLine if endLine is not None else editor.getLineCount() - 1)
+        result = editor.getText()
+        editor.setText(before)
+        return result
+
+    def test_simple_replace(self):
+        editor.pyreplace(r'^Code: ([A-Z]{4,8})', r'The code is \1')
+        self.assertEqual(editor.getText(), 'The code is ABCD and more  \r\nCode: XY\r\n  Code: EFGHIJ\r\nlast Äpfel line')
+
+    def test_same_as_python_engine(self):
+        for search, replace in [(r'^(\w+)', r'<\1>'), (r'\s+$', ''), (r'([A-Z])([A-Z])', r'\2\1'), (r'x*', '-'), (r'Äpfel', 'Birnen')]:
+            expected = self.old_engine(search, replace)
+            editor.pyreplace(search, replace)
+            self.assertEqual(editor.getText(), expected, search)
+            editor.undo()
+
+    def test_matches_dont_run_over_line_ends(self):
+        editor.pyreplace(r'\s+', ' ')
+        self.assertEqual(editor.getText(), 'Code: ABCD and more \r\nCode: XY\r\n Code: EFGHIJ\r\nlast Äpfel line')
+
+    def test_include_line_endings(self):
+        editor.pyreplace(r'XY\r\n', 'XY ', 0, editor.RE_INCLUDELINEENDINGS)
+        self.assertEqual(editor.getText(), 'Code: ABCD and more  \r\nCode: XY   Code: EFGHIJ\r\nlast Äpfel line')
+
+    def test_count_and_lines(self):
+        editor.pyreplace(r'Code', 'Key', 1, 0, 1, 2)
+        self.assertEqual(editor.getText(), 'Code: ABCD and more  \r\nKey: XY\r\n  Code: EFGHIJ\r\nlast Äpfel line')
+        editor.pyreplace(r'code', 'Key', 0, re.IGNORECASE, 2, 2)
+        self.assertEqual(editor.getText(), 'Code: ABCD and more  \r\nKey: XY\r\n  Key: EFGHIJ\r\nlast Äpfel line')
+
+    def test_replace_is_one_undo_action(self):
+        editor.pyreplace(r'[A-Z]', '_')
+        editor.undo()
+        self.assertEqual(editor.getText(), 'Code: ABCD and more  \r\nCode: XY\r\n  Code: EFGHIJ\r\nlast Äpfel line')
+
+    def test_pysearch(self):
+        found = []
+        editor.pysearch(r'Code: (\w+)', lambda line, m: found.append((line, m.group(1), m.span())))
+        lineTwo = editor.positionFromLine(2)
+        self.assertEqual(found, [(0, 'ABCD', (0, 10)), (1, 'XY', (23, 31)), (2, 'EFGHIJ', (lineTwo + 2, lineTwo + 14))])
+
+    def test_pysearch_lines_and_stop(self):
+        found = []
+        def stopAfterFirst(line, m):
+            found.append(line)
+            return False
+        editor.pysearch(r'Code', stopAfterFirst, 0, 1)
+        self.assertEqual(found, [1])
+
+    def test_pysearch_python_engine(self):
+        found = []
+        editor.pysearch(r'Code: (\w+)', lambda line, m: found.append((line, m.group(1), m.span())), editor.RE_PYTHONENGINE)
+        self.assertEqual(found, [(0, 'ABCD', (0, 10)), (1, 'XY', (0, 8)), (2, 'EFGHIJ', (2, 14))])
+
+    def test_verbose_flag(self):
+        search = r'''^Code:\ ([A-Z]+)   # the code
+                     \s*$                # and nothing else on the line'''
+        expected = self.old_engine(search, r'Key \1', 0, re.VERBOSE)
+        self.assertEqual(expected, 'Code: ABCD and more  \r\nKey XY\r\n  Code: EFGHIJ\r\nlast Äpfel line')
+        editor.pyreplace(search, r'Key \1', 0, re.VERBOSE)
+        self.assertEqual(editor.getText(), expected)
+
+    def test_pysearch_verbose_flag(self):
+        found = []
+        editor.pysearch(r'Code:\ (\w+)  # a code', lambda line, m: found.append((line, m.group(1), m.span())), re.VERBOSE)
+        self.assertEqual(found, [(0, 'ABCD', (0, 10)), (1, 'XY', (0, 8)), (2, 'EFGHIJ', (2, 14))])
+
+    def test_multiline_flag_is_native(self):
+        editor.pyreplace(r'^Code', 'Key', 0, re.MULTILINE)
+        self.assertEqual(editor.getText(), 'Key: ABCD and more  \r\nKey: XY\r\n  Code: EFGHIJ\r\nlast Äpfel line')
+
+
+suite = unittest.TestLoader().loadTestsFromTestCase(PyReplaceTestCase)
@@ -0,0 +1,44 @@
+# -*- coding: utf-8 -*-
+import unittest
+from Npp import *
+
+class RegexStepLimitTestCase(unittest.TestCase):
+    def setUp(self):
+        notepad.new()
+        editor.write('ok line\r\n' + 'a' * 30 + 'b\r\n')
+        self.originalLimit = editor.getRegexStepLimit()
+        
+    def tearDown(self):
+        editor.setRegexStepLimit(self.originalLimit)
+        editor.setSavePoint()
+        notepad.close()
+
+    def test_error_names_the_pattern(self):
+        editor.setRegexStepLimit(100000)
+        with self.assertRaisesRegexp(RuntimeError, r'\(a\+\)\+\$'):
+            editor.research(r'(a+)+$', lambda m: None)
+
+    def test_replace_changes_nothing(self):
+        editor.setRegexStepLimit(100000)
+        self.assertRaises(RuntimeError, editor.rereplace, r'(a+)+$', 'x')
+        self.assertEqual(editor.getText(), 'ok line\r\n' + 'a' * 30 + 'b\r\n')
+
+    def test_limit_is_counted(self):
+        editor.setRegexStepLimit(100000)
+        before = editor.getRegexComplexityStats()['limitExceeded']
+        self.assertRaises(RuntimeError, editor.recount, r'x?(a+)+$')
+        stats = editor.getRegexComplexityStats()
+        self.assertEqual(stats['limitExceeded'], before + 1)
+        self.assertEqual(stats['lastExceededPattern'], r'x?(a+)+$')
+        self.assertEqual(stats['stepLimit'], 100000)
+
+    def test_ordinary_search_is_unaffected(self):
+        editor.setRegexStepLimit(100000)
+        self.assertEqual(editor.recount(r'line'), 1)
+        self.assertTrue(editor.getLastSearchStats()['slowestRegexRun'] >= 0)
+
+    def test_limit_must_be_positive(self):
+        self.assertRaises(TypeError, editor.setRegexStepLimit, 0)
+        self.assertRaises(TypeError, editor.setRegexStepLimit, -1)
+
+suite = unittest.TestLoader().loadTestsFromTestCase(RegexStepLimitTestCase)
@@ -0,0 +1,43 @@
+# -*- coding: utf-8 -*-
+import unittest
+import re
+from Npp import *
+
+class ReplaceBulkTestCase(unittest.TestCase):
+    def setUp(self):
+        self.originalThreshold = editor.getBulkReplaceThreshold()
+        notepad.new()
+        notepad.runMenuCommand("Encoding", "Encode in UTF-8")
+        editor.write(u'Abc123DEF4567 ghi8910\r\nAbc123\r\nxyz\r\n')
+        
+    def tearDown(self):
+        editor.setBulkReplaceThreshold(self.originalThreshold)
+        editor.setSavePoint()
+        notepad.close()
+        
+    def test_bulk_replace(self):
+        editor.setBulkReplaceThreshold(1)
+        editor.rereplace(r'([A-Z]{3})', r'<\1>', re.IGNORECASE)
+        text = editor.getText()
+        self.assertEqual(text, u'<Abc>123<DEF>4567 <ghi>8910\r\n<Abc>123\r\n<xyz>\r\n')
+
+    def test_bulk_replace_same_as_per_match(self):
+        editor.setBulkReplaceThreshold(0)
+        editor.rereplace(r'[0-9]+', 'NUMBER')
+        perMatchText = editor.getText()
+        editor.undo()
+        editor.setBulkReplaceThreshold(1)
+        editor.rereplace(r'[0-9]+', 'NUMBER')
+        self.assertEqual(editor.getText(), perMatchText)
+
+    def test_bulk_replace_is_one_undo(self):
+        editor.setBulkReplaceThreshold(1)
+        editor.replace('Abc', 'Z')
+        self.assertEqual(editor.getText(), u'Z123DEF4567 ghi8910\r\nZ123\r\nxyz\r\n')
+        editor.undo()
+        self.assertEqual(editor.getText(), u'Abc123DEF4567 ghi8910\r\nAbc123\r\nxyz\r\n')
+
+    def test_negative_threshold(self):
+        self.assertRaises(TypeError, editor.setBulkReplaceThreshold, -1)
+
+suite = unittest.TestLoader().loadTestsFromTestCase(ReplaceBulkTestCase)
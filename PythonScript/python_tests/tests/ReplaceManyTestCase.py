@@ -0,0 +1,45 @@
+# -*- coding: utf-8 -*-
+import unittest
+from Npp import *
+import re
+
+class ReplaceManyTestCase(unittest.TestCase):
+    def setUp(self):
+        notepad.new()
+        notepad.runMenuCommand("Encoding", "Encode in UTF-8")
+        editor.write('The cat sat on the mat, then the cats sat\r\nÄpfel äpfel\r\n')
+        
+    def tearDown(self):
+        editor.setSavePoint()
+        notepad.close()
+
+    def test_replace_many_dict(self):
+        editor.replaceMany({'the': 'a', 'cat': 'dog', 'cats': 'dogs', 'äpfel': 'Birnen'})
+        self.assertEqual(editor.getText(), 'The dog sat on a mat, an a dogs sat\r\nÄpfel Birnen\r\n')
+
+    def test_replace_many_pairs(self):
+        editor.replaceMany([('at', '$1'), ('sat', 'stood'), ('at', 'ignored')])
+        self.assertEqual(editor.getText(), 'The c$1 stood on the m$1, then the c$1s stood\r\nÄpfel äpfel\r\n')
+
+    def test_replace_many_is_one_pass(self):
+        editor.replaceMany([('cat', 'dog'), ('dog', 'cat')])
+        self.assertEqual(editor.getText(), 'The dog sat on the mat, then the dogs sat\r\nÄpfel äpfel\r\n')
+
+    def test_replace_many_ignorecase(self):
+        editor.replaceMany({'the': 'a', 'äpfel': 'Birnen'}, re.IGNORECASE)
+        self.assertEqual(editor.getText(), 'a cat sat on a mat, an a cats sat\r\nBirnen Birnen\r\n')
+
+    def test_replace_many_start_end(self):
+        editor.replaceMany({'the': 'a', 'at': 'AT'}, 0, 8, 22)
+        self.assertEqual(editor.getText(), 'The cat sAT on a mAT, then the cats sat\r\nÄpfel äpfel\r\n')
+
+    def test_replace_many_one_undo(self):
+        editor.replaceMany({'the': 'a', 'cat': 'dog'})
+        editor.undo()
+        self.assertEqual(editor.getText(), 'The cat sat on the mat, then the cats sat\r\nÄpfel äpfel\r\n')
+
+    def test_replace_many_bad_arguments(self):
+        self.assertRaises(TypeError, editor.replaceMany, {'': 'x'})
+        self.assertRaises(TypeError, editor.replaceMany, [('a', 'b', 'c')])
+
+suite = unittest.TestLoader().loadTestsFromTestCase(ReplaceManyTestCase)
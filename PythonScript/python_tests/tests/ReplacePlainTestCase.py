@@ -27,4 +27,14 @@ class ReplacePlainTestCase(unittest.TestCase):
         editor.search(r'([abc]+)', lambda m: self.check_plain_search(m))
         self.assertEqual(self.called, True)
 
+    def test_plain_replace_ignorecase(self):
+        editor.replace(r'([ABC]+) EMBEDDED', 'TEST', re.IGNORECASE);
+        text = editor.getText()
+        self.assertEqual(text, 'Some text with TEST regex\r\n');
+
+    def test_plain_search_ignorecase(self):
+        self.called = False
+        editor.search(r'([ABC]+)', lambda m: self.check_plain_search(m), re.IGNORECASE)
+        self.assertEqual(self.called, True)
+
 suite = unittest.TestLoader().loadTestsFromTestCase(ReplacePlainTestCase)
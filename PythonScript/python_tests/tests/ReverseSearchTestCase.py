@@ -0,0 +1,60 @@
+# -*- coding: utf-8 -*-
+import unittest
+import re
+from Npp import *
+
+class ReverseSearchTestCase(unittest.TestCase):
+    def setUp(self):
+        notepad.new()
+        notepad.runMenuCommand("Encoding", "Encode in UTF-8")
+        editor.write(''.join('X%d key=value Äpfel\r\n' % line for line in range(500)))
+        
+    def tearDown(self):
+        editor.setSavePoint()
+        notepad.close()
+
+    def spans(self, method, *args):
+        found = []
+        method(args[0], lambda m: found.append((m.span(), m.groups())), *args[1:])
+        return found
+
+    def test_same_matches_as_research(self):
+        for pattern in [r'X([0-9]+)', r'^(\w+)', r'(Ä)pfel|(v)alue', r'x*', r'\s+X']:
+            expected = self.spans(editor.research, pattern)
+            expected.reverse()
+            self.assertEqual(self.spans(editor.rsearch, pattern), expected)
+
+    def test_start_and_end(self):
+        expected = self.spans(editor.research, r'X([0-9]+)', 0, 100, 5000)
+        expected.reverse()
+        self.assertEqual(self.spans(editor.rsearch, r'X([0-9]+)', 0, 100, 5000), expected)
+
+    def test_previous_match(self):
+        caret = editor.positionFromLine(250) + 3
+        found = self.spans(editor.rsearch, r'X([0-9]+)', 0, 0, caret, 1)
+        self.assertEqual(found, [((editor.positionFromLine(250), caret), ('25',))])
+
+    def test_nothing_before_the_start(self):
+        self.assertEqual(self.spans(editor.rsearch, r'X([0-9]+)', 0, 100, 100), [])
+
+    def test_end_zero_is_the_end_of_the_document(self):
+        expected = self.spans(editor.research, r'X([0-9]+)', 0, 100, 0)
+        expected.reverse()
+        self.assertEqual(len(expected), 495)    # X5 onwards - the lines before it are 21 bytes each
+        self.assertEqual(self.spans(editor.rsearch, r'X([0-9]+)', 0, 100, 0), expected)
+
+    def test_stops_when_function_returns_false(self):
+        found = []
+        def stopAfterTwo(m):
+            found.append(m.group(1))
+            return len(found) < 2
+        editor.rsearch(r'X([0-9]+)', stopAfterTwo)
+        self.assertEqual(found, ['499', '498'])
+        self.assertEqual(editor.getLastSearchStats()['matches'], 2)
+
+    def test_ignorecase(self):
+        found = self.spans(editor.rsearch, r'äPFEL', re.IGNORECASE, 0, -1, 1)
+        self.assertEqual(len(found), 1)
+        self.assertEqual(found[0][0][1], editor.getLineEndPosition(499))
+
+suite = unittest.TestLoader().loadTestsFromTestCase(ReverseSearchTestCase)
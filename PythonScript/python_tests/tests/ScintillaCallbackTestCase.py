@@ -221,6 +221,136 @@ class ScintillaCallbackTestCase(unittest.TestCase):
             self.callbackCalled = True
 
 
+    def test_coalesced_modified_callback(self):
+        self.coalescedCalls = []
+        editor.callback(lambda a: self.callback_coalesced(a), [SCINTILLANOTIFICATION.MODIFIED], coalesce=True)
+        for _ in range(20):
+            editor.write('line\n')
+        timeout = 2.0
+        while sum(call['linesAdded'] for call in self.coalescedCalls) < 20 and timeout > 0:
+            time.sleep(0.1)
+            timeout -= 0.1
+        self.assertEqual(sum(call['linesAdded'] for call in self.coalescedCalls), 20)
+        self.assertLess(len(self.coalescedCalls), 20)
+        self.assertGreaterEqual(sum(call['count'] for call in self.coalescedCalls), 20)
+        # The last call covers the text written after the first call was taken from the queue, up to the end
+        lastCall = self.coalescedCalls[-1]
+        self.assertEqual(lastCall['position'] + lastCall['length'], editor.getLength())
+
+    def callback_coalesced(self, args):
+        if not self.coalescedCalls:
+            time.sleep(0.3)    # The rest of the writes arrive while this call runs
+        self.coalescedCalls.append(dict(args))
+
+
+    def test_callback_args_mapping(self):
+        editor.callbackSync(lambda a: self.callback_args_mapping(a), [SCINTILLANOTIFICATION.MODIFIED])
+        editor.write('abc')
+        self.assertTrue(self.callbackCalled)
+        results = self.callbackResults
+        self.assertEqual(results['text'], 'abc')
+        self.assertEqual(results['code'], SCINTILLANOTIFICATION.MODIFIED)
+        self.assertTrue(results['hasText'])
+        self.assertFalse(results['hasCh'])
+        self.assertEqual(results['ch'], 'missing')
+        self.assertTrue(results['keyError'])
+        self.assertEqual(results['dict']['length'], 3)
+        self.assertEqual(sorted(results['keys']), sorted(results['dict'].keys()))
+        self.assertEqual(results['len'], len(results['dict']))
+
+    def callback_args_mapping(self, args):
+        if args['modificationType'] & 1 == 0:   # ignore modifications that aren't SC_MOD_INSERTTEXT
+            return
+        self.callbackResults['text'] = args['text']
+        self.callbackResults['code'] = args['code']
+        self.callbackResults['hasText'] = 'text' in args
+        self.callbackResults['hasCh'] = 'ch' in args
+        self.callbackResults['ch'] = args.get('ch', 'missing')
+        try:
+            args['ch']
+            self.callbackResults['keyError'] = False
+        except KeyError:
+            self.callbackResults['keyError'] = True
+        self.callbackResults['dict'] = dict(args)
+        self.callbackResults['keys'] = [key for key in args]
+        self.callbackResults['len'] = len(args)
+        self.callbackCalled = True
+
+    def test_callback_args_used_as_dict(self):
+        editor.callbackSync(lambda a: self.callback_args_used_as_dict(a), [SCINTILLANOTIFICATION.MODIFIED])
+        editor.write('abc')
+        self.assertTrue(self.callbackCalled)
+        results = self.callbackResults
+        self.assertEqual(type(results['copy']), dict)
+        self.assertEqual(results['copy']['text'], 'abc')
+        self.assertEqual(results['repr'], repr(results['copy']))
+        self.assertTrue(results['equal'])
+        self.assertEqual(sorted(results['iteritems']), sorted(results['copy'].items()))
+        self.assertEqual(sorted(results['itervalues']), sorted(results['copy'].values()))
+        self.assertEqual(results['position'], 42)
+        self.assertEqual(results['mine'], 'mine')
+        self.assertFalse(results['hasText'])
+        self.assertEqual(results['len'], len(results['copy']))
+        self.assertEqual(results['copy']['position'], 0)
+
+    def callback_args_used_as_dict(self, args):
+        if args['modificationType'] & 1 == 0:   # ignore modifications that aren't SC_MOD_INSERTTEXT
+            return
+        self.callbackResults['copy'] = args.copy()
+        self.callbackResults['repr'] = repr(args)
+        self.callbackResults['equal'] = (args == self.callbackResults['copy'])
+        self.callbackResults['iteritems'] = list(args.iteritems())
+        self.callbackResults['itervalues'] = list(args.itervalues())
+        args['position'] = 42
+        args['mine'] = 'mine'
+        del args['text']
+        self.callbackResults['position'] = args['position']
+        self.callbackResults['mine'] = args.get('mine')
+        self.callbackResults['hasText'] = 'text' in args
+        self.callbackResults['len'] = len(args)
+        self.callbackCalled = True
+
+    def test_callback_queue_cannot_block(self):
+        self.assertFalse(hasattr(editor, 'QUEUE_BLOCK'))
+        self.assertRaises(TypeError, editor.setCallbackQueueOverflow, 0)   # the value editor.QUEUE_BLOCK had
+        self.assertEqual(editor.getCallbackQueueOverflow(), editor.QUEUE_DROPOLDEST)
+        self.assertFalse('blocked' in editor.getCallbackQueueStats())
+        editor.setCallbackQueueOverflow(editor.QUEUE_DROPNEWEST)
+        try:
+            self.assertEqual(editor.getCallbackQueueOverflow(), editor.QUEUE_DROPNEWEST)
+        finally:
+            editor.setCallbackQueueOverflow(editor.QUEUE_DROPOLDEST)
+
+    def test_filtered_sync_callback(self):
+        self.filteredCalls = []
+        callback = lambda a: self.filteredCalls.append(a['modificationType'])
+        editor.callbackSync(callback, [SCINTILLANOTIFICATION.MODIFIED], {'modificationType': MODIFICATIONFLAGS.INSERTTEXT})
+        editor.write('abc')
+        editor.setSel(0, 1)
+        editor.replaceSel('')
+        self.assertEqual(len(self.filteredCalls), 1)
+        self.assertTrue(self.filteredCalls[0] & MODIFICATIONFLAGS.INSERTTEXT)
+        stats = editor.getCallbackStats(callback)
+        self.assertEqual(stats['delivered'], 1)
+        self.assertGreaterEqual(stats['filtered'], 1)    # the DELETETEXT, and any BEFOREINSERT and BEFOREDELETE
+
+    def test_filtered_callback_lines(self):
+        editor.write('line0\r\nline1\r\nline2\r\nline3\r\n')
+        self.filteredCalls = []
+        editor.callbackSync(lambda a: self.filteredCalls.append(editor.lineFromPosition(a['position'])), [SCINTILLANOTIFICATION.MODIFIED],
+                            {'lines': (1, 2), 'modificationType': MODIFICATIONFLAGS.INSERTTEXT, 'minLength': 2})
+        editor.insertText(editor.positionFromLine(0), 'xx')
+        editor.insertText(editor.positionFromLine(2), 'yy')
+        editor.insertText(editor.positionFromLine(2), 'z')
+        editor.insertText(editor.positionFromLine(3), 'xx')
+        self.assertEqual(self.filteredCalls, [2])
+
+    def test_filter_with_unknown_field(self):
+        with self.assertRaisesRegexp(TypeError, 'unknown filter field'):
+            editor.callback(lambda a: None, [SCINTILLANOTIFICATION.MODIFIED], False, {'modificationTypes': 1})
+        with self.assertRaisesRegexp(TypeError, 'lines'):
+            editor.callbackSync(lambda a: None, [SCINTILLANOTIFICATION.MODIFIED], {'lines': (5, 2)})
+
     def poll_for_callback(self, timeout = 0.5, interval = 0.1):
         while self.callbackCalled == False and timeout > 0:
             time.sleep(interval)
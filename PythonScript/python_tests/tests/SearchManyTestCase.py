@@ -0,0 +1,51 @@
+# -*- coding: utf-8 -*-
+import unittest
+import re
+from Npp import *
+
+class SearchManyTestCase(unittest.TestCase):
+    def setUp(self):
+        notepad.new()
+        notepad.runMenuCommand("Encoding", "Encode in UTF-8")
+        editor.write('ushers said his hers, she\r\nÄpfel äpfel\r\n')
+        
+    def tearDown(self):
+        editor.setSavePoint()
+        notepad.close()
+
+    def test_search_many(self):
+        found = editor.searchMany(['he', 'she', 'his', 'hers'])
+        self.assertEquals(found, [(1, 1, 4), (0, 2, 4), (3, 2, 6), (2, 12, 15), (0, 16, 18), (3, 16, 20), (1, 22, 25), (0, 23, 25)])
+
+    def test_search_many_same_as_search(self):
+        keywords = ['he', 's', 'hers', 'äpfel', 'x']
+        for index, keyword in enumerate(keywords):
+            expected = []
+            editor.search(keyword, lambda m: expected.append((index, m.start(), m.end())))
+            self.assertEquals([f for f in editor.searchMany(keywords) if f[0] == index], expected)
+
+    def test_search_many_with_function(self):
+        found = []
+        editor.searchMany(['his', 'she'], lambda index, m: found.append((index, m.group())))
+        self.assertEquals(found, [(1, 'she'), (0, 'his'), (1, 'she')])
+
+    def test_search_many_stops(self):
+        found = []
+        def stopAfterTwo(index, m):
+            found.append(m.span())
+            return len(found) < 2
+        editor.searchMany(['he', 'she'], stopAfterTwo)
+        self.assertEquals(found, [(1, 4), (2, 4)])
+
+    def test_search_many_ignorecase(self):
+        self.assertEquals(editor.searchMany(['äpfel']), [(0, 34, 40)])
+        self.assertEquals(editor.searchMany(['äpfel'], None, re.IGNORECASE), [(0, 27, 33), (0, 34, 40)])
+
+    def test_search_many_start_end(self):
+        found = editor.searchMany(['he', 'his', 'hers'], None, 0, 10, 21)
+        self.assertEquals(found, [(1, 12, 15), (0, 16, 18), (2, 16, 20)])
+
+    def test_search_many_empty_keyword(self):
+        self.assertRaises(TypeError, editor.searchMany, ['he', ''])
+
+suite = unittest.TestLoader().loadTestsFromTestCase(SearchManyTestCase)
@@ -0,0 +1,45 @@
+# -*- coding: utf-8 -*-
+import unittest
+import time
+from Npp import *
+
+class SearchTimeLimitTestCase(unittest.TestCase):
+    def setUp(self):
+        notepad.new()
+        editor.write('key=value 12345\r\n' * 1000)
+        self.originalLimit = editor.getSearchTimeLimit()
+        
+    def tearDown(self):
+        editor.setSearchTimeLimit(self.originalLimit)
+        editor.setSavePoint()
+        notepad.close()
+
+    def slow_match(self, m):
+        time.sleep(0.002)
+
+    def test_no_limit(self):
+        editor.setSearchTimeLimit(0)
+        self.assertEqual(editor.recount(r'(\w+)=(\w+)'), 1000)
+        self.assertEqual(editor.getLastSearchStats()['stopped'], None)
+
+    def test_search_stopped(self):
+        editor.setSearchTimeLimit(20)
+        with self.assertRaisesRegexp(RuntimeError, 'time limit'):
+            editor.research(r'(\w+)=(\w+)', self.slow_match)
+        stats = editor.getLastSearchStats()
+        self.assertEqual(stats['stopped'], 'timeLimit')
+        self.assertTrue(0 < stats['matches'] < 1000)
+        self.assertEqual(stats['stoppedAt'], (stats['matches'] - 1) * 17 + 9)
+
+    def test_stopped_replace_replaces_nothing(self):
+        editor.setSearchTimeLimit(20)
+        def slow_replace(m):
+            time.sleep(0.002)
+            return 'x'
+        self.assertRaises(RuntimeError, editor.rereplace, r'value', slow_replace)
+        self.assertEqual(editor.getText(), 'key=value 12345\r\n' * 1000)
+
+    def test_negative_limit(self):
+        self.assertRaises(TypeError, editor.setSearchTimeLimit, -1)
+
+suite = unittest.TestLoader().loadTestsFromTestCase(SearchTimeLimitTestCase)
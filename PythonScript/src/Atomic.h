@@ -0,0 +1,72 @@
+#ifndef ATOMIC_20140511_H
+#define ATOMIC_20140511_H
+
+// VS2010 has no <atomic>, so these are the Interlocked functions on Windows, and GCC's __sync builtins elsewhere.
+// Both are full memory barriers.
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+
+namespace NppPythonScript
+{
+    /** Adds 1 to value, and returns the new value
+     */
+    inline long atomicIncrement(volatile long *value)
+	{
+#ifdef _WIN32
+        return ::InterlockedIncrement(value);
+#else
+        return __sync_add_and_fetch(value, 1);
+#endif
+	}
+
+    /** Takes 1 from value, and returns the new value
+     */
+    inline long atomicDecrement(volatile long *value)
+	{
+#ifdef _WIN32
+        return ::InterlockedDecrement(value);
+#else
+        return __sync_sub_and_fetch(value, 1);
+#endif
+	}
+
+    /** Sets value to exchange if it is comparand, and returns what it was before
+     */
+    inline long atomicCompareExchange(volatile long *value, long exchange, long comparand)
+	{
+#ifdef _WIN32
+        return ::InterlockedCompareExchange(value, exchange, comparand);
+#else
+        return __sync_val_compare_and_swap(value, comparand, exchange);
+#endif
+	}
+
+    /** Sets value, after everything this thread wrote before it is visible to the other threads
+     */
+    inline void atomicStore(volatile long *value, long newValue)
+	{
+#ifdef _WIN32
+        ::InterlockedExchange(value, newValue);
+#else
+        __sync_synchronize();
+        *value = newValue;
+        __sync_synchronize();
+#endif
+	}
+
+    /** Gives the rest of this thread's time slice to another thread that is ready to run
+     */
+    inline void yieldThread()
+	{
+#ifdef _WIN32
+        ::Sleep(0);
+#else
+        sched_yield();
+#endif
+	}
+}
+
+#endif // ATOMIC_20140511_H
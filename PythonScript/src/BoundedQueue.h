@@ -0,0 +1,249 @@
+#ifndef BOUNDEDQUEUE_20140511_H
+#define BOUNDEDQUEUE_20140511_H
+
+#include "Atomic.h"
+
+namespace NppPythonScript
+{
+    /** What BoundedQueue::push() does when the queue is full
+     */
+    enum QueueOverflow
+	{
+        QUEUE_BLOCK,          // Wait for the consumer to make room (push() returns QUEUE_FULL, for the caller to wait and try again)
+        QUEUE_DROP_OLDEST,    // Throw away the item at the front of the queue
+        QUEUE_DROP_NEWEST     // Throw away the item being pushed
+	};
+
+    struct QueueStats
+	{
+        QueueStats()
+			: capacity(0),
+              pushed(0),
+              droppedOldest(0),
+              droppedNewest(0),
+              blocked(0)
+		{}
+
+        long capacity;
+        long pushed;
+        long droppedOldest;
+        long droppedNewest;
+        long blocked;          // The number of times a producer had to wait for room (counted by the caller, with countBlocked())
+	};
+
+    /** A fixed size ring of items that any number of threads can push() to and pop() from, without a lock.
+     *
+     *  Each cell has a sequence number that says whose turn it is: pos when it is free for the push to position pos, and
+     *  pos + 1 once the item has been stored, for the pop from position pos.  A push or pop claims its position by
+     *  moving the enqueue or dequeue position on with atomicCompareExchange(), then owns the cell until it stores the next
+     *  sequence number.  The positions and sequence numbers are read without an atomic operation - a stale value only
+     *  makes the atomicCompareExchange() fail, and that is also the barrier between reading the sequence and the item.
+     *  (This is Dmitry Vyukov's bounded queue.)  Only the operations in Atomic.h are used, so it doesn't need a kernel call,
+     *  and it builds and can be tested off Windows too.
+     *
+     *  The queue also keeps a count of the items that have been, or are being, pushed and haven't been popped.  The push that
+     *  takes it from 0 to 1 returns PUSHED_TO_EMPTY - it is the only one that needs to wake a waiting consumer.  isEmpty() is
+     *  only true when no push is in progress either, so a consumer that finds pop() fails but isEmpty() is false knows an item
+     *  is about to arrive, and shouldn't go to sleep.
+     *
+     *  PyProducerConsumer has one consumer, but a QUEUE_DROP_OLDEST push pops as well, so the pops have to allow for
+     *  several threads too.
+     */
+    template <typename T>
+    class BoundedQueue
+	{
+	public:
+        enum PushResult
+		{
+            PUSHED,
+            PUSHED_TO_EMPTY,    // The queue was empty - wake the consumer
+            QUEUE_FULL,         // Only for QUEUE_BLOCK - nothing was pushed
+            DROPPED             // Only for QUEUE_DROP_NEWEST
+		};
+
+        /** The capacity is rounded up to a power of 2
+         */
+        explicit BoundedQueue(long capacity);
+        ~BoundedQueue() { delete [] m_cells; }
+
+        PushResult push(const T& item, QueueOverflow overflow);
+
+        /** Moves the item at the front of the queue to item, or returns false if there isn't one ready
+         */
+        bool pop(T& item);
+
+        bool isEmpty() const { return 0 == m_count; }
+
+        void countBlocked() { atomicIncrement(&m_blocked); }
+
+        QueueStats getStats() const;
+
+	private:
+        BoundedQueue(const BoundedQueue&);               // copy constructor disabled
+        BoundedQueue& operator = (const BoundedQueue&);  // assignment operator disabled
+
+        struct Cell
+		{
+            volatile long sequence;
+            T item;
+		};
+
+        bool tryPush(const T& item);
+        bool tryPop(T& item);
+
+        // The positions wrap around, which is fine as the capacity is a power of 2
+        static long add(long position, long offset) { return static_cast<long>(static_cast<unsigned long>(position) + static_cast<unsigned long>(offset)); }
+        static long distance(long from, long to) { return static_cast<long>(static_cast<unsigned long>(to) - static_cast<unsigned long>(from)); }
+
+        Cell *m_cells;
+        long m_mask;
+        char m_padding1[64];    // The producers and the consumer each have their own cache line
+        volatile long m_enqueuePosition;
+        char m_padding2[64];
+        volatile long m_dequeuePosition;
+        char m_padding3[64];
+        volatile long m_count;                 // Items pushed (or being pushed) and not popped yet
+        volatile long m_droppedOldest;
+        volatile long m_droppedNewest;
+        volatile long m_blocked;
+	};
+
+    template <typename T>
+    BoundedQueue<T>::BoundedQueue(long capacity)
+		: m_enqueuePosition(0),
+          m_dequeuePosition(0),
+          m_count(0),
+          m_droppedOldest(0),
+          m_droppedNewest(0),
+          m_blocked(0)
+	{
+        long size = 2;
+        while (size < capacity)
+		{
+            size *= 2;
+		}
+        m_mask = size - 1;
+        m_cells = new Cell[size];
+        for (long position = 0; position < size; ++position)
+		{
+            m_cells[position].sequence = position;
+		}
+	}
+
+    template <typename T>
+    typename BoundedQueue<T>::PushResult BoundedQueue<T>::push(const T& item, QueueOverflow overflow)
+	{
+        const long count = atomicIncrement(&m_count);
+        while (!tryPush(item))
+		{
+            if (QUEUE_DROP_OLDEST == overflow)
+			{
+                T oldest;
+                if (tryPop(oldest))
+				{
+                    atomicDecrement(&m_count);
+                    atomicIncrement(&m_droppedOldest);
+				}
+                continue;
+			}
+
+            atomicDecrement(&m_count);
+            if (QUEUE_DROP_NEWEST == overflow)
+			{
+                atomicIncrement(&m_droppedNewest);
+                return DROPPED;
+			}
+            return QUEUE_FULL;
+		}
+
+        return (1 == count) ? PUSHED_TO_EMPTY : PUSHED;
+	}
+
+    template <typename T>
+    bool BoundedQueue<T>::pop(T& item)
+	{
+        if (tryPop(item))
+		{
+            atomicDecrement(&m_count);
+            return true;
+		}
+        return false;
+	}
+
+    template <typename T>
+    bool BoundedQueue<T>::tryPush(const T& item)
+	{
+        long position = m_enqueuePosition;
+        for (;;)
+		{
+            Cell& cell = m_cells[position & m_mask];
+            const long turn = distance(position, cell.sequence);
+            if (0 == turn)
+			{
+                const long claimed = atomicCompareExchange(&m_enqueuePosition, add(position, 1), position);
+                if (claimed == position)
+				{
+                    cell.item = item;
+                    atomicStore(&cell.sequence, add(position, 1));
+                    return true;
+				}
+                position = claimed;
+			}
+            else if (turn < 0)
+			{
+                // The cell still has the item from the last time round the ring
+                return false;
+			}
+            else
+			{
+                position = m_enqueuePosition;
+			}
+		}
+	}
+
+    template <typename T>
+    bool BoundedQueue<T>::tryPop(T& item)
+	{
+        long position = m_dequeuePosition;
+        for (;;)
+		{
+            Cell& cell = m_cells[position & m_mask];
+            const long turn = distance(add(position, 1), cell.sequence);
+            if (0 == turn)
+			{
+                const long claimed = atomicCompareExchange(&m_dequeuePosition, add(position, 1), position);
+                if (claimed == position)
+				{
+                    item = cell.item;
+                    cell.item = T();
+                    atomicStore(&cell.sequence, add(position, m_mask + 1));
+                    return true;
+				}
+                position = claimed;
+			}
+            else if (turn < 0)
+			{
+                // Nothing has been stored in the cell yet
+                return false;
+			}
+            else
+			{
+                position = m_dequeuePosition;
+			}
+		}
+	}
+
+    template <typename T>
+    QueueStats BoundedQueue<T>::getStats() const
+	{
+        QueueStats stats;
+        stats.capacity = m_mask + 1;
+        stats.pushed = m_enqueuePosition;    // Each push moves it on once
+        stats.droppedOldest = m_droppedOldest;
+        stats.droppedNewest = m_droppedNewest;
+        stats.blocked = m_blocked;
+        return stats;
+	}
+}
+
+#endif // BOUNDEDQUEUE_20140511_H
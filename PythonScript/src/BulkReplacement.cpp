@@ -0,0 +1,38 @@
+#include "stdafx.h"
+
+#include "BulkReplacement.h"
+#include "ReplacementBatch.h"
+
+namespace NppPythonScript
+{
+
+BulkReplacement::BulkReplacement(const char *text, const ReplacementBatch& replacements)
+	: m_spanStart(0),
+      m_spanEnd(0)
+{
+    if (replacements.empty())
+	{
+        return;
+	}
+
+    m_spanStart = replacements.front().start;
+    m_spanEnd = replacements.back().end;
+
+    ReplacementBatch::const_iterator endIterator = replacements.end();
+    size_t newLength = static_cast<size_t>(m_spanEnd - m_spanStart);
+    for (ReplacementBatch::const_iterator it = replacements.begin(); it != endIterator; ++it)
+	{
+        newLength = newLength + it->length - (it->end - it->start);
+	}
+    m_replacedText.reserve(newLength);
+
+    int copiedTo = m_spanStart;
+    for (ReplacementBatch::const_iterator it = replacements.begin(); it != endIterator; ++it)
+	{
+        m_replacedText.append(text + copiedTo, static_cast<size_t>(it->start - copiedTo));
+        m_replacedText.append(replacements.getReplacement(*it), static_cast<size_t>(it->length));
+        copiedTo = it->end;
+	}
+}
+
+}
@@ -0,0 +1,34 @@
+#ifndef BULKREPLACEMENT_20140418_H
+#define BULKREPLACEMENT_20140418_H
+
+namespace NppPythonScript
+{
+class ReplacementBatch;
+
+/** The text of the span of the document covered by a list of replacements (from the start of the first
+ *  replacement to the end of the last), with every replacement applied.  
+ *  The new text is built once in a contiguous buffer, so that the whole span can be replaced with a single 
+ *  SCI_REPLACETARGET, rather than one per replacement.
+ *
+ *  The replacements must be in document order and not overlap, which is how the Replacer produces them.
+ */
+class BulkReplacement
+{
+public:
+    BulkReplacement(const char *text, const ReplacementBatch& replacements);
+
+    int spanStart() const { return m_spanStart; }
+    int spanEnd() const { return m_spanEnd; }
+
+    const char *replacedText() const { return m_replacedText.data(); }
+    int replacedLength() const { return static_cast<int>(m_replacedText.size()); }
+
+private:
+    int m_spanStart;
+    int m_spanEnd;
+    std::string m_replacedText;
+};
+
+}
+
+#endif // BULKREPLACEMENT_20140418_H
@@ -17,12 +17,9 @@ namespace NppPythonScript
 	}
 
 
-    void CallbackExecArgs::setParams(boost::python::dict params)
+    void CallbackExecArgs::setParams(boost::python::object params)
 	{
-        if (NULL != params)
-		{
-            delete m_params;
-		}
-        m_params = new boost::python::dict(params);
+        delete m_params;
+        m_params = new boost::python::object(params);
 	}
 }
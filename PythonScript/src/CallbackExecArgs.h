@@ -1,6 +1,7 @@
 #ifndef CALLBACKEXECARGS_20140217_H
 #define CALLBACKEXECARGS_20140217_H
 
+#include "CoalescedEvents.h"
 
 namespace NppPythonScript
 {
@@ -10,19 +11,31 @@ class CallbackExecArgs
 public:
     CallbackExecArgs() 
         : m_callbacks(new std::list<boost::python::object>()),
-          m_params(NULL)
+          m_params(NULL),
+          m_dispatched(false)
 	{}
 
     virtual ~CallbackExecArgs();
 	
 	void addCallback(boost::python::object callback) { m_callbacks->push_back(callback); }
-    void setParams(boost::python::dict params);
+    void setParams(boost::python::object params);
 
 	std::list<boost::python::object> *getCallbacks() { return m_callbacks; }
-	boost::python::dict *getParams() { return m_params; }
+	boost::python::object *getParams() { return m_params; }
+
+    /** Set (with the GIL) when the consumer takes the args from the queue, after which no more notifications can be
+     *  coalesced into them
+     */
+    void setDispatched() { m_dispatched = true; }
+    bool isDispatched() const { return m_dispatched; }
+
+    CoalescedEvents& getCoalescedEvents() { return m_coalescedEvents; }
+
 private:
 	std::list<boost::python::object> *m_callbacks;
-	boost::python::dict *m_params;
+	boost::python::object *m_params;
+    bool m_dispatched;
+    CoalescedEvents m_coalescedEvents;
 };
 
 }
@@ -0,0 +1,56 @@
+#include "stdafx.h"
+
+#include "CoalescedEvents.h"
+#include "Scintilla.h"
+
+namespace NppPythonScript
+{
+
+void CoalescedEvents::addModification(int modificationType, int position, int length, int linesAdded)
+{
+    ++m_count;
+    m_linesAdded += linesAdded;
+    m_modificationType |= modificationType;
+
+    if (modificationType & SC_MOD_INSERTTEXT)
+	{
+        if (m_hasRange)
+		{
+            // Text inserted at the start of the range is before it
+            m_start = (m_start >= position) ? m_start + length : m_start;
+            m_end = (m_end >= position) ? m_end + length : m_end;
+		}
+        extend(position, position + length);
+	}
+    else if (modificationType & SC_MOD_DELETETEXT)
+	{
+        if (m_hasRange)
+		{
+            const int deletedEnd = position + length;
+            m_start = (m_start <= position) ? m_start : ((m_start < deletedEnd) ? position : m_start - length);
+            m_end = (m_end <= position) ? m_end : ((m_end < deletedEnd) ? position : m_end - length);
+		}
+        extend(position, position);
+	}
+    else if (length > 0)
+	{
+        extend(position, position + length);
+	}
+}
+
+void CoalescedEvents::extend(int start, int end)
+{
+    if (m_hasRange)
+	{
+        m_start = (std::min)(m_start, start);
+        m_end = (std::max)(m_end, end);
+	}
+    else
+	{
+        m_start = start;
+        m_end = end;
+        m_hasRange = true;
+	}
+}
+
+}
@@ -0,0 +1,54 @@
+#ifndef COALESCEDEVENTS_20140511_H
+#define COALESCEDEVENTS_20140511_H
+
+namespace NppPythonScript
+{
+    /** The notifications merged into one call of a coalescing async callback (editor.callback(..., coalesce=True)), while
+     *  the call was waiting in the queue.
+     *
+     *  For SCN_MODIFIED, the range is the part of the document, as it is after all the modifications, that any of them changed:
+     *  each insert or delete moves the range (and grows it, if it is inside it) as it would move the text, and then the range
+     *  is extended to cover the new text, or the place where the text was deleted.  Other modifications (styles, indicators...)
+     *  just extend the range to cover their text.
+     */
+    class CoalescedEvents
+	{
+	public:
+        CoalescedEvents()
+			: m_count(0),
+              m_hasRange(false),
+              m_start(0),
+              m_end(0),
+              m_linesAdded(0),
+              m_modificationType(0)
+		{}
+
+        /** Adds an SCN_MODIFIED notification
+         */
+        void addModification(int modificationType, int position, int length, int linesAdded);
+
+        /** Adds any other notification - only the latest one is passed to the callback, so only the count changes
+         */
+        void add() { ++m_count; }
+
+        int count() const { return m_count; }
+
+        bool hasRange() const { return m_hasRange; }
+        int start() const { return m_start; }
+        int length() const { return m_end - m_start; }
+        int linesAdded() const { return m_linesAdded; }
+        int modificationType() const { return m_modificationType; }    // The flags of all the modifications
+
+	private:
+        void extend(int start, int end);
+
+        int m_count;
+        bool m_hasRange;
+        int m_start;
+        int m_end;
+        int m_linesAdded;
+        int m_modificationType;
+	};
+}
+
+#endif // COALESCEDEVENTS_20140511_H
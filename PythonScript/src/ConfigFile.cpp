@@ -144,7 +144,13 @@ void ConfigFile::setSetting(const tstring& settingName, const tstring settingVal
 
 const tstring& ConfigFile::getSetting(const TCHAR *settingName)
 {
-	return m_settings[tstring(settingName)];
+	// Not added if it isn't there, so that save() doesn't write settings without values
+	SettingsTD::const_iterator it = m_settings.find(tstring(settingName));
+	if (it == m_settings.end())
+	{
+		return m_emptySetting;
+	}
+	return it->second;
 }
 
 const std::string& ConfigFile::getMenuScript(idx_t index) const
@@ -58,6 +58,7 @@ private:
 	// Used in case an invalid script number is requested
 	// so we can return a reference to this puppy instead.
 	std::string m_emptyString;
+	tstring m_emptySetting;
 	
 	
 	ToolbarItemsTD m_toolbarItems;
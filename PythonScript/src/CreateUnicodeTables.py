@@ -0,0 +1,274 @@
+# CreateUnicodeTables.py - regenerate UnicodeTables.cpp from the Unicode database
+# of the Python running this script.
+#
+# The tables are two stage lookups: the top bits of the code point select a block
+# of 256 entries, and identical blocks are only stored once.
+#
+# The character types (CT_CTYPE1 classes) are derived from the Unicode database in the
+# same way as Windows derives what GetStringTypeEx returns, so that the regex classes
+# (\w, \s, [[:alpha:]] etc) don't need to call into Windows for every character.
+
+import sys
+import os
+import unicodedata
+
+try:
+	unichr
+except NameError:
+	unichr = chr
+
+# Nothing above this has a lowercase mapping (as of Unicode 14, the last is U+1E921)
+TABLE_LIMIT = 0x20000
+BLOCK_SIZE = 256
+
+
+def simpleLowercase(codepoint):
+	""" Returns the simple (single code point) lowercase mapping of codepoint.
+	    Python 3 gives the full mapping, which only differs for U+0130, where the first
+	    code point of the full mapping is the simple mapping """
+	if 0xD800 <= codepoint <= 0xDFFF:
+		return codepoint
+	lower = unichr(codepoint).lower()
+	return ord(lower[0])
+
+
+def twoStageTable(values):
+	""" Splits values (one per code point below TABLE_LIMIT) into blocks, and returns
+	    (blockIndex, blocks), where blocks has each distinct block once """
+	blockIndex = []
+	blocks = []
+	blockLookup = {}
+	for start in range(0, len(values), BLOCK_SIZE):
+		block = tuple(values[start:start + BLOCK_SIZE])
+		if block not in blockLookup:
+			blockLookup[block] = len(blocks)
+			blocks.append(block)
+		blockIndex.append(blockLookup[block])
+	return blockIndex, blocks
+
+
+def formatRows(values, perLine, width):
+	lines = []
+	for start in range(0, len(values), perLine):
+		lines.append('\t' + ', '.join(str(v).rjust(width) for v in values[start:start + perLine]) + ',')
+	return '\n'.join(lines)
+
+
+def simpleUppercase(codepoint):
+	""" Returns the simple (single code point) uppercase mapping of codepoint.
+	    Where the full mapping has more than one code point, the simple mapping is the
+	    titlecase one if that is a single code point (e.g. U+1F80), otherwise there isn't one (e.g. U+00DF) """
+	if 0xD800 <= codepoint <= 0xDFFF:
+		return codepoint
+	upper = unichr(codepoint).upper()
+	if len(upper) == 1:
+		return ord(upper)
+	title = unichr(codepoint).title()
+	if len(title) == 1:
+		return ord(title)
+	return codepoint
+
+
+def caseTables(name, mapping):
+	""" Returns the C++ for the two stage table of the deltas from each code point to mapping(code point) """
+	deltas = [0]
+	deltaLookup = { 0 : 0 }
+	deltaIndexes = []
+	for codepoint in range(TABLE_LIMIT):
+		delta = mapping(codepoint) - codepoint
+		if delta not in deltaLookup:
+			deltaLookup[delta] = len(deltas)
+			deltas.append(delta)
+		deltaIndexes.append(deltaLookup[delta])
+
+	for codepoint in range(TABLE_LIMIT, 0x110000):
+		if mapping(codepoint) != codepoint:
+			raise Exception('U+{0:04X} has a {1} mapping, increase TABLE_LIMIT'.format(codepoint, name))
+
+	if len(deltas) > 256:
+		raise Exception('Too many distinct {0} deltas for an unsigned char index'.format(name))
+
+	blockIndex, blocks = twoStageTable(deltaIndexes)
+	if len(blocks) > 256:
+		raise Exception('Too many distinct blocks for an unsigned char index')
+
+	out = []
+	out.append('// Index of the block of s_{0}DeltaIndex for each 256 code points below TABLE_LIMIT'.format(name))
+	out.append('static const unsigned char s_{0}Block[{1}] = {{'.format(name, len(blockIndex)))
+	out.append(formatRows(blockIndex, 16, 3))
+	out.append('};')
+	out.append('')
+	out.append('// Index into s_{0}Deltas for each code point in the block'.format(name))
+	out.append('static const unsigned char s_{0}DeltaIndex[{1}][{2}] = {{'.format(name, len(blocks), BLOCK_SIZE))
+	for block in blocks:
+		out.append('    {')
+		out.append(formatRows(block, 16, 3))
+		out.append('    },')
+	out.append('};')
+	out.append('')
+	out.append('// {0} code point minus code point'.format(name[0].upper() + name[1:]))
+	out.append('static const U32 s_{0}Deltas[{1}] = {{'.format(name, len(deltas)))
+	out.append(formatRows(deltas, 8, 6))
+	out.append('};')
+	return '\n'.join(out)
+
+
+def asciiFoldedFromNonAscii():
+	folded = set()
+	for codepoint in range(0x80, TABLE_LIMIT):
+		lower = simpleLowercase(codepoint)
+		if lower < 0x80:
+			folded.add(lower)
+	out = []
+	out.append('// ASCII characters that are the lowercase of a non-ASCII character')
+	folded = sorted(folded)
+	out.append('static const U32 s_asciiFoldedFromNonAscii[{0}] = {{ {1} }};'.format(len(folded), ', '.join("'{0}'".format(chr(c)) for c in folded)))
+	return '\n'.join(out)
+
+
+# CT_CTYPE1 values, from WinNls.h
+C1_UPPER = 0x0001
+C1_LOWER = 0x0002
+C1_DIGIT = 0x0004
+C1_SPACE = 0x0008
+C1_PUNCT = 0x0010
+C1_CNTRL = 0x0020
+C1_BLANK = 0x0040
+C1_XDIGIT = 0x0080
+C1_ALPHA = 0x0100
+C1_DEFINED = 0x0200
+
+# Windows counts the Latin-1 superscripts as digits, the other Latin-1 numbers (fractions)
+# and the soft hyphen as punctuation, the byte order mark as a blank, and two modifier
+# letters that used to be lowercase letters as lowercase
+EXTRA_LOWER = [ 0x2071, 0x207F ]
+EXTRA_DIGITS = [ 0xB2, 0xB3, 0xB9 ]
+EXTRA_PUNCT = [ 0xAD, 0xB2, 0xB3, 0xB9, 0xBC, 0xBD, 0xBE ]
+EXTRA_BLANKS = [ 0x09, 0xFEFF ]
+XDIGIT_RANGES = [ (0x30, 0x39), (0x41, 0x46), (0x61, 0x66), (0xFF10, 0xFF19), (0xFF21, 0xFF26), (0xFF41, 0xFF46) ]
+
+
+def characterType(codepoint):
+	""" Returns the CT_CTYPE1 classes of a BMP code point, derived from the Unicode database 
+	    in the way that Windows derives the classes that GetStringTypeEx returns """
+	c = unichr(codepoint)
+	category = unicodedata.category(c)
+	bidi = unicodedata.bidirectional(c)
+	result = 0
+	if category != 'Cn':
+		result |= C1_DEFINED
+	if category[0] == 'L' or category == 'Nl':
+		result |= C1_ALPHA
+	if category in ('Lu', 'Lt'):
+		result |= C1_UPPER
+	if category in ('Ll', 'Lt') or codepoint in EXTRA_LOWER:
+		result |= C1_LOWER
+	if category == 'Nd' or codepoint in EXTRA_DIGITS:
+		result |= C1_DIGIT
+	if category in ('Zs', 'Zl', 'Zp') or bidi in ('B', 'S', 'WS') or codepoint in EXTRA_BLANKS:
+		result |= C1_SPACE
+	if category[0] in ('P', 'S') or codepoint in EXTRA_PUNCT:
+		result |= C1_PUNCT
+	if category in ('Cc', 'Cf'):
+		result |= C1_CNTRL
+	if category == 'Zs' or codepoint in EXTRA_BLANKS:
+		result |= C1_BLANK
+	for first, last in XDIGIT_RANGES:
+		if first <= codepoint <= last:
+			result |= C1_XDIGIT
+	return result
+
+
+def characterTypeTables():
+	types = [0]
+	typeLookup = { 0 : 0 }
+	typeIndexes = []
+	for codepoint in range(0x10000):
+		characterClass = characterType(codepoint)
+		if characterClass not in typeLookup:
+			typeLookup[characterClass] = len(types)
+			types.append(characterClass)
+		typeIndexes.append(typeLookup[characterClass])
+
+	if len(types) > 256:
+		raise Exception('Too many distinct character types for an unsigned char index')
+
+	blockIndex, blocks = twoStageTable(typeIndexes)
+	if len(blocks) > 256:
+		raise Exception('Too many distinct blocks for an unsigned char index')
+
+	out = []
+	out.append('// Index of the block of s_typeIndex for each 256 code points of the BMP')
+	out.append('static const unsigned char s_typeBlock[{0}] = {{'.format(len(blockIndex)))
+	out.append(formatRows(blockIndex, 16, 3))
+	out.append('};')
+	out.append('')
+	out.append('// Index into s_types for each code point in the block')
+	out.append('static const unsigned char s_typeIndex[{0}][{1}] = {{'.format(len(blocks), BLOCK_SIZE))
+	for block in blocks:
+		out.append('    {')
+		out.append(formatRows(block, 16, 3))
+		out.append('    },')
+	out.append('};')
+	out.append('')
+	out.append('// CT_CTYPE1 classes')
+	out.append('static const unsigned short s_types[{0}] = {{'.format(len(types)))
+	out.append(formatRows(['0x{0:03X}'.format(t) for t in types], 8, 5))
+	out.append('};')
+	return '\n'.join(out)
+
+
+def generate(outputPath):
+	with open(outputPath, 'w') as f:
+		f.write('// Generated by CreateUnicodeTables.py from Unicode {0} - do not edit by hand\n'.format(unicodedata.unidata_version))
+		f.write('\n')
+		f.write('#include "stdafx.h"\n')
+		f.write('\n')
+		f.write('#include "UnicodeTables.h"\n')
+		f.write('\n')
+		f.write('namespace UnicodeTables {\n')
+		f.write('\n')
+		f.write('static const U32 TABLE_LIMIT = 0x{0:X};\n'.format(TABLE_LIMIT))
+		f.write('\n')
+		f.write(caseTables('lowercase', simpleLowercase))
+		f.write('\n\n')
+		f.write(caseTables('uppercase', simpleUppercase))
+		f.write('\n\n')
+		f.write(asciiFoldedFromNonAscii())
+		f.write('\n\n')
+		f.write(characterTypeTables())
+		f.write('\n\n')
+		f.write('U32 foldCase(U32 c) {\n')
+		f.write('\tif (c < 0 || c >= TABLE_LIMIT)\n')
+		f.write('\t\treturn c;\n')
+		f.write('\treturn c + s_lowercaseDeltas[s_lowercaseDeltaIndex[s_lowercaseBlock[c >> 8]][c & 0xFF]];\n')
+		f.write('}\n')
+		f.write('\n')
+		f.write('U32 toUpper(U32 c) {\n')
+		f.write('\tif (c < 0 || c >= TABLE_LIMIT)\n')
+		f.write('\t\treturn c;\n')
+		f.write('\treturn c + s_uppercaseDeltas[s_uppercaseDeltaIndex[s_uppercaseBlock[c >> 8]][c & 0xFF]];\n')
+		f.write('}\n')
+		f.write('\n')
+		f.write('bool isFoldedFromNonAscii(U32 c) {\n')
+		f.write('\tfor (size_t i = 0; i < sizeof(s_asciiFoldedFromNonAscii) / sizeof(s_asciiFoldedFromNonAscii[0]); ++i) {\n')
+		f.write('\t\tif (s_asciiFoldedFromNonAscii[i] == c)\n')
+		f.write('\t\t\treturn true;\n')
+		f.write('\t}\n')
+		f.write('\treturn false;\n')
+		f.write('}\n')
+		f.write('\n')
+		f.write('unsigned short characterType(U32 c) {\n')
+		f.write('\tif (c < 0 || c > 0x10FFFF)\n')
+		f.write('\t\treturn 0;\n')
+		f.write('\tif (c > 0xFFFF)\n')
+		f.write('\t\tc = 0xD800 + ((c - 0x10000) >> 10);  // The lead surrogate\n')
+		f.write('\treturn s_types[s_typeIndex[s_typeBlock[c >> 8]][c & 0xFF]];\n')
+		f.write('}\n')
+		f.write('\n')
+		f.write('} // namespace UnicodeTables\n')
+
+
+if __name__ == '__main__':
+	outputPath = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), 'UnicodeTables.cpp')
+	generate(outputPath)
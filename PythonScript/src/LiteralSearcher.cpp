@@ -0,0 +1,326 @@
+#include "stdafx.h"
+
+#include "LiteralSearcher.h"
+#include "UnicodeTables.h"
+
+namespace NppPythonScript
+{
+
+LiteralSearcher::LiteralSearcher(const char *needle, int needleLength)
+	: m_needle(needle, needleLength)
+{
+    // Horspool bad character table - how far we can shift when the character aligned with the end of the needle doesn't match
+    for (int i = 0; i < 256; ++i)
+	{
+        m_skip[i] = needleLength;
+	}
+
+    for (int i = 0; i < needleLength - 1; ++i)
+	{
+        m_skip[static_cast<unsigned char>(needle[i])] = needleLength - 1 - i;
+	}
+}
+
+
+int LiteralSearcher::find(const char *text, int start, int end) const
+{
+    const int needleLength = static_cast<int>(m_needle.size());
+    if (0 == needleLength || end - start < needleLength)
+	{
+        return -1;
+	}
+
+    if (1 == needleLength)
+	{
+        const void *found = memchr(text + start, m_needle[0], static_cast<size_t>(end - start));
+        return found ? static_cast<int>(static_cast<const char *>(found) - text) : -1;
+	}
+
+#ifdef PYTHONSCRIPT_SSE2
+    if (sse2Available())
+	{
+        return findSse2(text, start, end);
+	}
+#endif
+
+    return findHorspool(text, start, end);
+}
+
+
+int LiteralSearcher::findHorspool(const char *text, int start, int end) const
+{
+    const int needleLength = static_cast<int>(m_needle.size());
+    const char *needle = m_needle.c_str();
+    const char lastChar = needle[needleLength - 1];
+
+    for (int position = start; position + needleLength <= end; )
+	{
+        const char current = text[position + needleLength - 1];
+        if (current == lastChar && 0 == memcmp(text + position, needle, needleLength - 1))
+		{
+            return position;
+		}
+        position += m_skip[static_cast<unsigned char>(current)];
+	}
+
+    return -1;
+}
+
+
+#ifdef PYTHONSCRIPT_SSE2
+
+int LiteralSearcher::findSse2(const char *text, int start, int end) const
+{
+    const int needleLength = static_cast<int>(m_needle.size());
+    const char *needle = m_needle.c_str();
+
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needleLength - 1]);
+
+    // Each block checks 16 candidate start positions, by comparing the first byte of the needle against the
+    // 16 bytes at position, and the last byte of the needle against the 16 bytes at position + needleLength - 1.
+    // Only candidates where both match are compared in full.
+    int position = start;
+    for (; position + needleLength - 1 + 16 <= end; position += 16)
+	{
+        const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position));
+        const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position + needleLength - 1));
+
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last))));
+
+        while (mask != 0)
+		{
+            int offset = lowestSetBit(mask);
+            if (needleLength <= 2 || 0 == memcmp(text + position + offset + 1, needle + 1, needleLength - 2))
+			{
+                return position + offset;
+			}
+            mask &= mask - 1;
+		}
+	}
+
+    // Less than a block left, so finish off with the scalar search
+    return findHorspool(text, position, end);
+}
+
+#endif
+
+
+IgnoreCaseLiteralSearcher::IgnoreCaseLiteralSearcher(const char *needle, int needleLength, LiteralEncoding encoding)
+	: m_encoding(encoding),
+      m_firstCharMode(FIRST_CHAR_SCALAR),
+      m_firstByte(0),
+      m_nonAsciiCanStart(false)
+{
+    if (LITERAL_ENCODING_UTF8 == encoding)
+	{
+        // Only the ASCII bytes are folded with the byte table, everything else is decoded first
+        for (int i = 0; i < 256; ++i)
+		{
+            m_byteFold[i] = static_cast<unsigned char>(i < 0x80 ? UnicodeTables::foldCase(i) : i);
+		}
+
+        UtfConversion::Utf8Decoder decoder(needle, needleLength);
+        while (!decoder.isEnd())
+		{
+            m_foldedNeedle.push_back(UnicodeTables::foldCase(decoder.decodedChar()));
+            decoder.advanceToNext();
+		}
+	}
+    else
+	{
+        // Use the same traits as the ANSI regex, so the case folding follows the code page in exactly the same way
+        boost::regex::traits_type traits;
+        for (int i = 0; i < 256; ++i)
+		{
+            m_byteFold[i] = static_cast<unsigned char>(traits.translate_nocase(static_cast<char>(i)));
+		}
+
+        for (int i = 0; i < needleLength; ++i)
+		{
+            m_foldedNeedle.push_back(m_byteFold[static_cast<unsigned char>(needle[i])]);
+		}
+	}
+
+    if (m_foldedNeedle.empty())
+	{
+        return;
+	}
+
+    const U32 first = m_foldedNeedle[0];
+
+    if (LITERAL_ENCODING_UTF8 == encoding)
+	{
+        m_nonAsciiCanStart = first >= 0x80 || UnicodeTables::isFoldedFromNonAscii(first);
+	}
+    else
+	{
+        for (int i = 0x80; i < 256; ++i)
+		{
+            if (m_byteFold[i] == first)
+			{
+                m_nonAsciiCanStart = true;
+			}
+		}
+	}
+
+    int asciiCandidates = 0;
+    for (int i = 0; i < 0x80; ++i)
+	{
+        if (m_byteFold[i] == first)
+		{
+            ++asciiCandidates;
+		}
+	}
+
+    if (0 == asciiCandidates)
+	{
+        m_firstCharMode = FIRST_CHAR_NONE;
+	}
+    else if (first < 0x80 && m_byteFold[first] == first)
+	{
+        m_firstByte = static_cast<unsigned char>(first);
+        if (1 == asciiCandidates)
+		{
+            m_firstCharMode = FIRST_CHAR_EXACT;
+		}
+        else if (2 == asciiCandidates && first >= 'a' && first <= 'z' && m_byteFold[first - 0x20] == first)
+		{
+            m_firstCharMode = FIRST_CHAR_LETTER;
+		}
+	}
+}
+
+
+int IgnoreCaseLiteralSearcher::find(const char *text, int start, int end, int *matchEnd) const
+{
+    if (m_foldedNeedle.empty() || start >= end || (FIRST_CHAR_NONE == m_firstCharMode && !m_nonAsciiCanStart))
+	{
+        return -1;
+	}
+
+#ifdef PYTHONSCRIPT_SSE2
+    if (FIRST_CHAR_SCALAR != m_firstCharMode && sse2Available())
+	{
+        return findSse2(text, start, end, matchEnd);
+	}
+#endif
+
+    return findScalar(text, start, end, matchEnd);
+}
+
+
+bool IgnoreCaseLiteralSearcher::isCandidate(unsigned char byte) const
+{
+    if (byte < 0x80)
+	{
+        return m_byteFold[byte] == m_foldedNeedle[0];
+	}
+    return m_nonAsciiCanStart;
+}
+
+
+/** Returns the end of the match if the needle matches at position, or -1 if it doesn't.
+ */
+int IgnoreCaseLiteralSearcher::matchAt(const char *text, int position, int end) const
+{
+    int current = position;
+    for (std::vector<U32>::const_iterator it = m_foldedNeedle.begin(); it != m_foldedNeedle.end(); ++it)
+	{
+        if (current >= end)
+		{
+            return -1;
+		}
+
+        unsigned char byte = static_cast<unsigned char>(text[current]);
+        if (byte < 0x80 || LITERAL_ENCODING_ANSI == m_encoding)
+		{
+            if (m_byteFold[byte] != *it)
+			{
+                return -1;
+			}
+            ++current;
+		}
+        else
+		{
+            // Decoded in the same way as the UTF8Iterator, so a continuation byte (which can only start a character
+            // if it is invalid) decodes to an invalid character, which never matches
+            UtfConversion::Utf8Decoder decoder(text + current, static_cast<unsigned int>(end - current));
+            if (UnicodeTables::foldCase(decoder.decodedChar()) != *it)
+			{
+                return -1;
+			}
+            current += static_cast<int>(decoder.decodedLength());
+		}
+	}
+    return current;
+}
+
+
+int IgnoreCaseLiteralSearcher::findScalar(const char *text, int start, int end, int *matchEnd) const
+{
+    for (int position = start; position < end; ++position)
+	{
+        if (isCandidate(static_cast<unsigned char>(text[position])))
+		{
+            int foundEnd = matchAt(text, position, end);
+            if (foundEnd != -1)
+			{
+                *matchEnd = foundEnd;
+                return position;
+			}
+		}
+	}
+    return -1;
+}
+
+
+#ifdef PYTHONSCRIPT_SSE2
+
+int IgnoreCaseLiteralSearcher::findSse2(const char *text, int start, int end, int *matchEnd) const
+{
+    const __m128i first = _mm_set1_epi8(static_cast<char>(m_firstByte));
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+
+    // Each block checks 16 candidate start positions.  ASCII letters are folded to lowercase by setting the 0x20 bit 
+    // before comparing with the (lowercase) first character, and bytes with the top bit set are candidates if a non-ASCII 
+    // character can fold to the first character.
+    int position = start;
+    for (; position + 16 <= end; position += 16)
+	{
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position));
+
+        unsigned int mask = 0;
+        if (FIRST_CHAR_LETTER == m_firstCharMode)
+		{
+            mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(block, caseBit), first)));
+		}
+        else if (FIRST_CHAR_EXACT == m_firstCharMode)
+		{
+            mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, first)));
+		}
+
+        if (m_nonAsciiCanStart)
+		{
+            mask |= static_cast<unsigned int>(_mm_movemask_epi8(block));
+		}
+
+        while (mask != 0)
+		{
+            int offset = lowestSetBit(mask);
+            int foundEnd = matchAt(text, position + offset, end);
+            if (foundEnd != -1)
+			{
+                *matchEnd = foundEnd;
+                return position + offset;
+			}
+            mask &= mask - 1;
+		}
+	}
+
+    return findScalar(text, position, end, matchEnd);
+}
+
+#endif
+
+}
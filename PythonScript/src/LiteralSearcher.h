@@ -0,0 +1,104 @@
+#ifndef LITERALSEARCHER_20140415_H
+#define LITERALSEARCHER_20140415_H
+
+#include "UtfConversion.h"
+#include "Sse2.h"
+
+namespace NppPythonScript
+{
+    /** Finds a literal byte sequence in a buffer, without going through the regex machinery.
+     *  Candidates are located 16 bytes at a time (SSE2) by comparing both the first and the last byte of the
+     *  needle, and then verified with a memcmp.  Where SSE2 is not available (and for the tail of the buffer)
+     *  a Horspool search is used.
+     *
+     *  The search works on bytes, so it is up to the caller to ensure that a byte match is also a character
+     *  match in the encoding of the document (see Utf8CharTraits::isLiteralSearchable()).
+     */
+    class LiteralSearcher
+	{
+	public:
+        LiteralSearcher(const char *needle, int needleLength);
+
+        /** Returns the position of the first occurrence of the needle that lies completely within [start, end) of text,
+         *  or -1 if there isn't one.
+         */
+        int find(const char *text, int start, int end) const;
+
+        /** As find(), but also returns the end of the match in matchEnd (so it can be used interchangeably with IgnoreCaseLiteralSearcher)
+         */
+        int find(const char *text, int start, int end, int *matchEnd) const
+		{
+            int found = find(text, start, end);
+            *matchEnd = found + needleLength();
+            return found;
+		}
+
+        int needleLength() const { return static_cast<int>(m_needle.size()); }
+
+	private:
+        int findHorspool(const char *text, int start, int end) const;
+#ifdef PYTHONSCRIPT_SSE2
+        int findSse2(const char *text, int start, int end) const;
+#endif
+
+        std::string m_needle;
+        int m_skip[256];
+	};
+
+    enum LiteralEncoding
+	{
+        LITERAL_ENCODING_UTF8,
+        LITERAL_ENCODING_ANSI
+	};
+
+    /** Finds a literal ignoring case, comparing characters in the same way as the regex engine does with the icase flag
+     *  (i.e. both characters are converted to lowercase first).
+     *
+     *  Candidate start positions are located 16 bytes at a time (SSE2) by folding the ASCII bytes of the text with a
+     *  compare-and-mask against the first character of the needle.  Each candidate is then verified character by character,
+     *  using a byte table for ASCII and UnicodeTables::foldCase() for the non-ASCII characters of UTF-8 text.  For ANSI text, 
+     *  the byte table comes from the regex traits, so it follows the code page.
+     *
+     *  As the length of a character can change when folding (e.g. KELVIN SIGN folds to 'k'), the length of a match
+     *  can differ from the length of the needle.
+     *
+     *  In UTF-8 mode the needle must be valid UTF-8 (see Utf8CharTraits::isLiteralSearchable()).
+     */
+    class IgnoreCaseLiteralSearcher
+	{
+	public:
+        IgnoreCaseLiteralSearcher(const char *needle, int needleLength, LiteralEncoding encoding);
+
+        /** Returns the position of the first match that lies completely within [start, end) of text, or -1 if there isn't one.
+         *  The end of the match is returned in matchEnd.
+         */
+        int find(const char *text, int start, int end, int *matchEnd) const;
+
+	private:
+        // How the ASCII bytes of a block of text are compared against the first character of the needle
+        enum FirstCharMode
+		{
+            FIRST_CHAR_NONE,       // No ASCII byte can start a match
+            FIRST_CHAR_EXACT,      // Only the byte itself
+            FIRST_CHAR_LETTER,     // An ASCII letter, so the byte OR 0x20 is compared
+            FIRST_CHAR_SCALAR      // Anything else - no block search
+		};
+
+        int findScalar(const char *text, int start, int end, int *matchEnd) const;
+#ifdef PYTHONSCRIPT_SSE2
+        int findSse2(const char *text, int start, int end, int *matchEnd) const;
+#endif
+        bool isCandidate(unsigned char byte) const;
+        int matchAt(const char *text, int position, int end) const;
+
+        LiteralEncoding m_encoding;
+        std::vector<U32> m_foldedNeedle;
+        unsigned char m_byteFold[256];
+        FirstCharMode m_firstCharMode;
+        unsigned char m_firstByte;
+        bool m_nonAsciiCanStart;   // A byte >= 0x80 (UTF-8: a lead byte) can start a match
+	};
+
+}
+
+#endif // LITERALSEARCHER_20140415_H
@@ -8,13 +8,13 @@ namespace NppPythonScript
 
 boost::python::str Match::py_group_number(int groupNumber)
 {
-    GroupDetail *groupDetail = group(groupNumber);
-    if (NULL == groupDetail)
+    GroupDetail groupDetail;
+    if (!group(groupNumber, groupDetail))
 	{
         throw GroupNotFoundException("no such group");
 	}
 
-    return boost::python::str(getTextForGroup(group(groupNumber)));
+    return boost::python::str(getTextForGroup(groupDetail));
 }
 
 
@@ -22,8 +22,8 @@ boost::python::str Match::py_group_name(boost::python::str pyGroupName)
 {
     std::string stringGroupName(boost::python::extract<const char *>(pyGroupName.attr("__str__")()));
     
-    GroupDetail *groupDetail = groupName(stringGroupName.c_str());
-    if (NULL == groupDetail)
+    GroupDetail groupDetail;
+    if (!groupName(stringGroupName.c_str(), groupDetail))
 	{
         throw GroupNotFoundException("no such group");
 	}
@@ -62,11 +62,11 @@ boost::python::str Match::py_expand(boost::python::object replaceFormat)
 
 int Match::py_start(int groupIndex)
 {
-    GroupDetail *groupDetail = group(groupIndex);
+    GroupDetail groupDetail;
     int result = -1;
-	if (groupDetail && groupDetail->matched()) 
+	if (group(groupIndex, groupDetail) && groupDetail.matched()) 
 	{
-        result = groupDetail->start();
+        result = groupDetail.start();
 	}
 
     return result;   
@@ -74,22 +74,22 @@ int Match::py_start(int groupIndex)
 
 int Match::py_start_name(boost::python::str groupName)
 {
-    GroupDetail *groupDetail = this->groupName(boost::python::extract<const char *>(groupName));
+    GroupDetail groupDetail;
     int result = -1;
-	if (groupDetail && groupDetail->matched()) 
+	if (this->groupName(boost::python::extract<const char *>(groupName), groupDetail) && groupDetail.matched()) 
 	{
-        result = groupDetail->start();
+        result = groupDetail.start();
 	}
     return result;
 }
 
 int Match::py_end(int groupIndex)
 {
-    GroupDetail *groupDetail = group(groupIndex);
+    GroupDetail groupDetail;
     int result = -1;
-	if (groupDetail && groupDetail->matched()) 
+	if (group(groupIndex, groupDetail) && groupDetail.matched()) 
 	{
-        result = groupDetail->end();
+        result = groupDetail.end();
 	}
 
     return result;   
@@ -97,11 +97,11 @@ int Match::py_end(int groupIndex)
 
 int Match::py_end_name(boost::python::str groupName)
 {
-    GroupDetail *groupDetail = this->groupName(boost::python::extract<const char *>(groupName));
+    GroupDetail groupDetail;
     int result = -1;
-	if (groupDetail && groupDetail->matched()) 
+	if (this->groupName(boost::python::extract<const char *>(groupName), groupDetail) && groupDetail.matched()) 
 	{
-        result = groupDetail->end();
+        result = groupDetail.end();
 	}
     return result;
 }
@@ -119,7 +119,8 @@ boost::python::tuple Match::py_span_name(boost::python::str groupName)
 int Match::py_lastindex()
 {
     int lastGroup = groupCount() - 1;
-    while(lastGroup > 0 && !group(lastGroup)->matched())
+    GroupDetail groupDetail;
+    while(lastGroup > 0 && !(group(lastGroup, groupDetail) && groupDetail.matched()))
         --lastGroup;
 
     return lastGroup;
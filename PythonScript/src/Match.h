@@ -6,23 +6,44 @@
 namespace NppPythonScript
 {
     
+    /** The position of one group of a match.  This is a plain value, so looking up a group doesn't allocate anything.
+     */
     class GroupDetail 
     {
     public:
-        virtual int start() const = 0;
-        virtual int end() const = 0;
-        virtual bool matched() const = 0;
-    
+        GroupDetail()
+			: m_start(-1),
+              m_end(-1),
+              m_matched(false)
+		{}
+
+        GroupDetail(int start, int end, bool matched)
+			: m_start(start),
+              m_end(end),
+              m_matched(matched)
+		{}
+
+        int start() const { return m_start; }
+        int end() const { return m_end; }
+        bool matched() const { return m_matched; }
+
+    private:
+        int m_start;
+        int m_end;
+        bool m_matched;
     };
 
     class Match
     {
     public:
         virtual int groupCount() = 0;
-        virtual GroupDetail* group(int groupNumber) = 0;
-        virtual GroupDetail* groupName(const char *groupName) = 0;
+
+        /** Fills in groupDetail for the given group, and returns true, or returns false if there is no such group.
+         */
+        virtual bool group(int groupNumber, GroupDetail& groupDetail) = 0;
+        virtual bool groupName(const char *groupName, GroupDetail& groupDetail) = 0;
         virtual void expand(const char* format, char **result, int *resultLength) = 0;
-        virtual std::string getTextForGroup(GroupDetail* group) = 0;
+        virtual std::string getTextForGroup(const GroupDetail& group) = 0;
         virtual int groupIndexFromName(const char *groupName) = 0;
 
         boost::python::str py_group_number(int groupNumber);
@@ -0,0 +1,167 @@
+#ifndef MATCHITERATOR_20140510_H
+#define MATCHITERATOR_20140510_H
+
+#include "Replacer.h"
+#include "TextChangedException.h"
+
+namespace NppPythonScript
+{
+
+/** Tells a MatchIterator (and the matches it has returned) whether the text being searched is still the same as it was when the
+ *  search started.  The text is only a pointer into the document, so once it has changed, nothing can be read from it.
+ */
+class TextSnapshot
+{
+public:
+    virtual ~TextSnapshot() {}
+
+    virtual bool isUnchanged() = 0;
+
+    /** Throws a TextChangedException if the text has changed
+     */
+    void check()
+	{
+        if (!isUnchanged())
+		{
+            throw TextChangedException("the document has changed since the search started");
+		}
+	}
+};
+
+
+/** A search that finds the matches one at a time, as they are asked for (editor.finditer() in Python).  Only the state of the
+ *  search is kept between matches, so a search with any number of matches takes the same memory.
+ */
+class MatchIterator
+{
+public:
+    virtual ~MatchIterator() {}
+
+    /** Returns the next match, or an empty pointer if there are no more.  Throws a TextChangedException if the text has changed.
+     *  Each match has everything it needs, so it can be kept after the iterator has moved on (or gone).
+     */
+    virtual boost::shared_ptr<Match> next() = 0;
+};
+
+
+/** A match returned by a RegexMatchIterator.  It has its own copy of the match_results, and checks the TextSnapshot before it
+ *  reads anything from the text.
+ */
+template <class CharTraitsT>
+class IteratedRegexMatch : public Match
+{
+public:
+    typedef typename CharTraitsT::text_iterator_type text_iterator_type;
+    typedef boost::match_results<text_iterator_type> results_type;
+
+    /** fullPrefixStart is where a search has to start from for the prefix ($`) to be complete, or -1 if the results already have
+     *  the complete prefix (see RegexMatchFinder::isPrefixShortened())
+     */
+    IteratedRegexMatch(const char *text, int textLength, int startPosition, typename RegexCache<CharTraitsT>::regex_ptr regex,
+                       boost::regex_constants::match_flag_type matchFlags, const results_type& results, int fullPrefixStart,
+                       boost::shared_ptr<TextSnapshot> snapshot)
+		: m_text(text),
+          m_textLength(textLength),
+          m_startPosition(startPosition),
+          m_regex(regex),
+          m_matchFlags(matchFlags),
+          m_results(results),
+          m_fullPrefixStart(fullPrefixStart),
+          m_snapshot(snapshot)
+	{}
+
+    virtual int groupCount() { return m_results.size(); }
+
+    virtual bool group(int groupNo, GroupDetail& groupDetail) { return BoostRegexMatch<CharTraitsT>(m_text, &m_results).group(groupNo, groupDetail); }
+
+    virtual bool groupName(const char *groupName, GroupDetail& groupDetail) { return group(groupIndexFromName(groupName), groupDetail); }
+
+    virtual int groupIndexFromName(const char *groupName) { return BoostRegexMatch<CharTraitsT>(m_text, &m_results).groupIndexFromName(groupName); }
+
+    virtual std::string getTextForGroup(const GroupDetail& groupDetail)
+	{
+        m_snapshot->check();
+        return std::string(m_text + groupDetail.start(), m_text + groupDetail.end());
+	}
+
+    virtual void expand(const char* format, char **result, int *resultLength)
+	{
+        m_snapshot->check();
+        if (-1 != m_fullPrefixStart && (strstr(format, "$`") || strstr(format, "PREMATCH")))
+		{
+            results_type fullResults;
+            boost::regex_search(text_iterator_type(m_text, m_fullPrefixStart, m_textLength), text_iterator_type(m_text, m_textLength, m_textLength),
+                                fullResults, *m_regex, m_matchFlags, text_iterator_type(m_text, m_startPosition, m_textLength));
+            BoostRegexMatch<CharTraitsT>(m_text, &fullResults).expand(format, result, resultLength);
+            return;
+		}
+        BoostRegexMatch<CharTraitsT>(m_text, &m_results).expand(format, result, resultLength);
+	}
+
+private:
+    const char *m_text;
+    const int m_textLength;
+    const int m_startPosition;
+    const typename RegexCache<CharTraitsT>::regex_ptr m_regex;
+    const boost::regex_constants::match_flag_type m_matchFlags;
+    results_type m_results;
+    const int m_fullPrefixStart;
+    boost::shared_ptr<TextSnapshot> m_snapshot;
+};
+
+
+/** Finds the matches of a regex with a RegexMatchFinder, so the matches are exactly the ones Replacer::search() gives, in the same order.
+ */
+template <class CharTraitsT>
+class RegexMatchIterator : public MatchIterator
+{
+public:
+    RegexMatchIterator(const char *text, int textLength, int startPosition, const char *search, python_re_flags flags, boost::shared_ptr<TextSnapshot> snapshot)
+		: m_text(text),
+          m_textLength(textLength),
+          m_startPosition(startPosition),
+          m_matchFlags(Replacer<CharTraitsT>::getMatchFlags(flags)),
+          m_regex(RegexCache<CharTraitsT>::getInstance().get(search, Replacer<CharTraitsT>::getSyntaxFlags(flags))),
+          m_finder(text, textLength, startPosition, search, flags, *m_regex, m_matchFlags, m_stats),
+          m_snapshot(snapshot),
+          m_finished(false)
+	{}
+
+    virtual boost::shared_ptr<Match> next()
+	{
+        m_snapshot->check();
+
+        typename RegexMatchFinder<CharTraitsT>::results_type results;
+        if (m_finished || !m_finder.next(results))
+		{
+            m_finished = true;
+            return boost::shared_ptr<Match>();
+		}
+
+        ++m_stats.matches;
+        const int fullPrefixStart = m_finder.isPrefixShortened(results) ? m_finder.fullPrefixStart() : -1;
+        return boost::shared_ptr<Match>(new IteratedRegexMatch<CharTraitsT>(m_text, m_textLength, m_startPosition, m_regex, m_matchFlags,
+                                                                             results, fullPrefixStart, m_snapshot));
+	}
+
+    /** The counters of the search so far
+     */
+    const SearchStats& getStats() const { return m_stats; }
+
+private:
+    const char *m_text;
+    const int m_textLength;
+    const int m_startPosition;
+    const boost::regex_constants::match_flag_type m_matchFlags;
+    SearchStats m_stats;
+
+    // The finder keeps references to the regex and the stats, so they are declared (and constructed) first
+    typename RegexCache<CharTraitsT>::regex_ptr m_regex;
+    RegexMatchFinder<CharTraitsT> m_finder;
+    boost::shared_ptr<TextSnapshot> m_snapshot;
+    bool m_finished;
+};
+
+}
+
+#endif // MATCHITERATOR_20140510_H
@@ -2,9 +2,26 @@
 #include "stdafx.h"
 #include "MatchPython.h"
 #include "Match.h"
+#include "MatchIterator.h"
 #include "NotSupportedException.h"
 
 
+static boost::python::object matchIteratorIter(boost::python::object iterator)
+{
+    return iterator;
+}
+
+static boost::shared_ptr<NppPythonScript::Match> matchIteratorNext(NppPythonScript::MatchIterator& iterator)
+{
+    boost::shared_ptr<NppPythonScript::Match> match = iterator.next();
+    if (!match)
+	{
+        PyErr_SetNone(PyExc_StopIteration);
+        boost::python::throw_error_already_set();
+	}
+    return match;
+}
+
 
 void export_match()
 {
@@ -33,5 +50,13 @@ void export_match()
 
         // See: http://docs.python.org/2/library/re.html#match-objects
 		;
+
+	// Matches from a finditer() are owned by Python
+	boost::python::register_ptr_to_python<boost::shared_ptr<NppPythonScript::Match> >();
+
+	boost::python::class_<NppPythonScript::MatchIterator, boost::shared_ptr<NppPythonScript::MatchIterator>, boost::noncopyable>("NppReMatchIterator", boost::python::no_init)
+		.def("__iter__", &matchIteratorIter)
+		.def("next", &matchIteratorNext, "Returns the next match, or raises StopIteration if there are no more")
+		;
 	//lint +e1793
 }
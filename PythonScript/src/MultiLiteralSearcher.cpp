@@ -0,0 +1,549 @@
+#include "stdafx.h"
+
+#include "MultiLiteralSearcher.h"
+#include "UnicodeTables.h"
+
+namespace NppPythonScript
+{
+
+MultiLiteralSearcher::MultiLiteralSearcher(const std::vector<std::string>& keywords, bool ignoreCase, LiteralEncoding encoding)
+	: m_decodeUtf8(ignoreCase && LITERAL_ENCODING_UTF8 == encoding),
+      m_classCount(1),
+      m_maxKeywordLength(0)
+{
+    // The same folding as the IgnoreCaseLiteralSearcher
+    if (!ignoreCase)
+	{
+        for (int i = 0; i < 256; ++i)
+		{
+            m_byteFold[i] = static_cast<unsigned char>(i);
+		}
+	}
+    else if (LITERAL_ENCODING_UTF8 == encoding)
+	{
+        for (int i = 0; i < 256; ++i)
+		{
+            m_byteFold[i] = static_cast<unsigned char>(i < 0x80 ? UnicodeTables::foldCase(i) : i);
+		}
+	}
+    else
+	{
+        boost::regex::traits_type traits;
+        for (int i = 0; i < 256; ++i)
+		{
+            m_byteFold[i] = static_cast<unsigned char>(traits.translate_nocase(static_cast<char>(i)));
+		}
+	}
+
+    for (int i = 0; i < 256; ++i)
+	{
+        m_byteClass[i] = 0;
+	}
+
+    // The (folded) characters of each keyword, and their classes
+    std::vector<std::vector<int> > keywordClasses(keywords.size());
+    for (size_t keyword = 0; keyword < keywords.size(); ++keyword)
+	{
+        const std::string& text = keywords[keyword];
+        if (m_decodeUtf8)
+		{
+            UtfConversion::Utf8Decoder decoder(text.c_str(), static_cast<unsigned int>(text.size()));
+            while (!decoder.isEnd())
+			{
+                keywordClasses[keyword].push_back(classOf(UnicodeTables::foldCase(decoder.decodedChar())));
+                decoder.advanceToNext();
+			}
+		}
+        else
+		{
+            for (size_t i = 0; i < text.size(); ++i)
+			{
+                keywordClasses[keyword].push_back(classOf(m_byteFold[static_cast<unsigned char>(text[i])]));
+			}
+		}
+	}
+
+    // Each byte takes the class of what it folds to.  For UTF-8 ignoring case, the bytes from 0x80 up are decoded instead.
+    int foldedClass[256];
+    for (int i = 0; i < 256; ++i)
+	{
+        foldedClass[i] = m_byteClass[i];
+	}
+    for (int i = 0; i < (m_decodeUtf8 ? 0x80 : 256); ++i)
+	{
+        m_byteClass[i] = foldedClass[m_byteFold[i]];
+	}
+
+    // The start state, then the trie of the keywords
+    m_transitions.assign(m_classCount, -1);
+    m_firstKeyword.push_back(-1);
+    m_stateDepth.push_back(0);
+    for (size_t keyword = 0; keyword < keywords.size(); ++keyword)
+	{
+        addKeyword(static_cast<int>(keyword), keywordClasses[keyword]);
+	}
+
+    buildTransitions();
+}
+
+
+/** Returns the class of a (folded) character of a keyword, giving it a new class if it doesn't have one yet.
+ *  Until all the keywords have been classified, m_byteClass is indexed by the folded byte.
+ */
+int MultiLiteralSearcher::classOf(U32 character)
+{
+    if (!m_decodeUtf8 || character < 0x80)
+	{
+        int& byteClass = m_byteClass[character];
+        if (0 == byteClass)
+		{
+            byteClass = m_classCount++;
+		}
+        return byteClass;
+	}
+
+    std::map<U32, int>::iterator found = m_codePointClass.find(character);
+    if (found != m_codePointClass.end())
+	{
+        return found->second;
+	}
+    m_codePointClass[character] = m_classCount;
+    return m_classCount++;
+}
+
+
+/** Adds the keyword (as the classes of its characters) to the trie.  The transitions are only the edges of the trie until buildTransitions().
+ */
+void MultiLiteralSearcher::addKeyword(int keyword, const std::vector<int>& characterClasses)
+{
+    m_keywordLengths.push_back(static_cast<int>(characterClasses.size()));
+    m_nextKeyword.push_back(-1);
+    if (characterClasses.empty())
+	{
+        return;
+	}
+    m_maxKeywordLength = (std::max)(m_maxKeywordLength, static_cast<int>(characterClasses.size()));
+
+    int state = 0;
+    for (std::vector<int>::const_iterator it = characterClasses.begin(); it != characterClasses.end(); ++it)
+	{
+        int next = m_transitions[state * m_classCount + *it];
+        if (-1 == next)
+		{
+            next = static_cast<int>(m_firstKeyword.size());
+            m_transitions[state * m_classCount + *it] = next;
+            m_firstKeyword.push_back(-1);
+            m_stateDepth.push_back(m_stateDepth[state] + 1);
+            m_transitions.resize(m_transitions.size() + m_classCount, -1);
+		}
+        state = next;
+	}
+
+    // Keywords with the same text are chained, in order
+    if (-1 == m_firstKeyword[state])
+	{
+        m_firstKeyword[state] = keyword;
+	}
+    else
+	{
+        int last = m_firstKeyword[state];
+        while (-1 != m_nextKeyword[last])
+		{
+            last = m_nextKeyword[last];
+		}
+        m_nextKeyword[last] = keyword;
+	}
+}
+
+
+/** Turns the trie into the complete DFA: a breadth first walk sets the failure link of each state (the longest proper
+ *  suffix that is also in the trie), and fills in each missing transition from the failure state's.
+ */
+void MultiLiteralSearcher::buildTransitions()
+{
+    const int stateCount = static_cast<int>(m_firstKeyword.size());
+    std::vector<int> failure(stateCount, 0);
+    m_outputLink.assign(stateCount, 0);
+
+    // Anything that isn't the start of a keyword (including class 0) goes back to the start
+    std::vector<int> queue;
+    queue.reserve(stateCount);
+    for (int characterClass = 0; characterClass < m_classCount; ++characterClass)
+	{
+        int& next = m_transitions[characterClass];
+        if (-1 == next)
+		{
+            next = 0;
+		}
+        else
+		{
+            queue.push_back(next);
+		}
+	}
+
+    for (size_t index = 0; index < queue.size(); ++index)
+	{
+        const int state = queue[index];
+        const int stateFailure = failure[state];
+        for (int characterClass = 0; characterClass < m_classCount; ++characterClass)
+		{
+            int& next = m_transitions[state * m_classCount + characterClass];
+            if (-1 == next)
+			{
+                next = m_transitions[stateFailure * m_classCount + characterClass];
+			}
+            else
+			{
+                const int nextFailure = m_transitions[stateFailure * m_classCount + characterClass];
+                failure[next] = nextFailure;
+                m_outputLink[next] = (-1 != m_firstKeyword[nextFailure]) ? nextFailure : m_outputLink[nextFailure];
+                queue.push_back(next);
+			}
+		}
+	}
+}
+
+
+/** Bytes, looked up in m_byteClass
+ */
+struct MultiLiteralSearcher::ByteClassifier
+{
+    explicit ByteClassifier(const MultiLiteralSearcher& searcher) : m_searcher(searcher) {}
+
+    int next(const char *text, int& position, int /* end */) const
+	{
+        return m_searcher.m_byteClass[static_cast<unsigned char>(text[position++])];
+	}
+
+    const MultiLiteralSearcher& m_searcher;
+};
+
+
+/** Folded code points of UTF-8 text, with the ASCII bytes looked up directly
+ */
+struct MultiLiteralSearcher::Utf8FoldingClassifier
+{
+    explicit Utf8FoldingClassifier(const MultiLiteralSearcher& searcher) : m_searcher(searcher) {}
+
+    int next(const char *text, int& position, int end) const
+	{
+        const unsigned char byte = static_cast<unsigned char>(text[position]);
+        if (byte < 0x80)
+		{
+            ++position;
+            return m_searcher.m_byteClass[byte];
+		}
+
+        UtfConversion::Utf8Decoder decoder(text + position, static_cast<unsigned int>(end - position));
+        position += static_cast<int>(decoder.decodedLength());
+        const U32 folded = UnicodeTables::foldCase(decoder.decodedChar());
+        if (folded < 0x80)
+		{
+            // e.g. KELVIN SIGN, which folds to 'k'
+            return m_searcher.m_byteClass[folded];
+		}
+        std::map<U32, int>::const_iterator found = m_searcher.m_codePointClass.find(folded);
+        return (found == m_searcher.m_codePointClass.end()) ? 0 : found->second;
+	}
+
+    const MultiLiteralSearcher& m_searcher;
+};
+
+
+/** Reports each occurrence that doesn't overlap the last reported occurrence of the same keyword
+ */
+class MultiLiteralSearcher::AllOccurrences
+{
+public:
+    AllOccurrences(int keywordCount, int start, occurrenceHandler handler, void *handlerState)
+		: m_lastEnd(keywordCount, start),
+          m_handler(handler),
+          m_handlerState(handlerState)
+	{}
+
+    bool found(int keyword, int start, int end)
+	{
+        if (start < m_lastEnd[keyword])
+		{
+            return true;
+		}
+        m_lastEnd[keyword] = end;
+        return m_handler(keyword, start, end, m_handlerState);
+	}
+
+    bool needsEarliestStart() const { return false; }
+    bool advance(int /* earliestStart */) { return true; }
+    bool finish() { return true; }
+
+private:
+    std::vector<int> m_lastEnd;
+    occurrenceHandler m_handler;
+    void *m_handlerState;
+};
+
+
+/** Holds back the occurrences until no occurrence that starts earlier (or at the same place and is longer) can still be found,
+ *  then reports the leftmost-longest of them.  The scan tells it the earliest start any occurrence found later can have, 
+ *  which is the start of the text that the current state of the automaton stands for.
+ */
+class MultiLiteralSearcher::LeftmostLongest
+{
+public:
+    LeftmostLongest(int start, occurrenceHandler handler, void *handlerState)
+		: m_lastEnd(start),
+          m_handler(handler),
+          m_handlerState(handlerState)
+	{}
+
+    bool found(int keyword, int start, int end)
+	{
+        if (start >= m_lastEnd)
+		{
+            Occurrence occurrence;
+            occurrence.keyword = keyword;
+            occurrence.start = start;
+            occurrence.end = end;
+            m_pending.push_back(occurrence);
+		}
+        return true;
+	}
+
+    bool needsEarliestStart() const { return !m_pending.empty(); }
+
+    bool advance(int earliestStart)
+	{
+        return reportStartingBefore(earliestStart);
+	}
+
+    bool finish()
+	{
+        return reportStartingBefore(INT_MAX);
+	}
+
+private:
+    struct Occurrence
+	{
+        int keyword;
+        int start;
+        int end;
+	};
+
+    static bool isBetter(const Occurrence& candidate, const Occurrence& best)
+	{
+        if (candidate.start != best.start)
+		{
+            return candidate.start < best.start;
+		}
+        if (candidate.end != best.end)
+		{
+            return candidate.end > best.end;
+		}
+        return candidate.keyword < best.keyword;
+	}
+
+    /** Reports the leftmost-longest occurrences out of the pending ones that start before the given position.  There are
+     *  only ever a few pending occurrences (the ones that end in the last m_maxKeywordLength characters), so each one
+     *  is just a walk through them.
+     */
+    bool reportStartingBefore(int before)
+	{
+        for (;;)
+		{
+            int best = -1;
+            for (int index = 0; index < static_cast<int>(m_pending.size()); ++index)
+			{
+                const Occurrence& occurrence = m_pending[index];
+                if (occurrence.start >= m_lastEnd && occurrence.start < before 
+                    && (-1 == best || isBetter(occurrence, m_pending[best])))
+				{
+                    best = index;
+				}
+			}
+
+            if (-1 == best)
+			{
+                break;
+			}
+
+            const Occurrence chosen = m_pending[best];
+            m_lastEnd = chosen.end;
+            if (!m_handler(chosen.keyword, chosen.start, chosen.end, m_handlerState))
+			{
+                return false;
+			}
+		}
+
+        // Everything that starts before the end of the last one reported can't be reported any more
+        size_t kept = 0;
+        for (size_t index = 0; index < m_pending.size(); ++index)
+		{
+            if (m_pending[index].start >= m_lastEnd)
+			{
+                m_pending[kept++] = m_pending[index];
+			}
+		}
+        m_pending.resize(kept);
+        return true;
+	}
+
+    std::vector<Occurrence> m_pending;
+    int m_lastEnd;
+    occurrenceHandler m_handler;
+    void *m_handlerState;
+};
+
+
+void MultiLiteralSearcher::findAll(const char *text, int start, int end, occurrenceHandler handler, void *state) const
+{
+    AllOccurrences collector(keywordCount(), start, handler, state);
+    scan(text, start, end, collector);
+}
+
+
+void MultiLiteralSearcher::findLeftmostLongest(const char *text, int start, int end, occurrenceHandler handler, void *state) const
+{
+    LeftmostLongest collector(start, handler, state);
+    scan(text, start, end, collector);
+}
+
+
+template <class CollectorT>
+void MultiLiteralSearcher::scan(const char *text, int start, int end, CollectorT& collector) const
+{
+    if (0 == m_maxKeywordLength)
+	{
+        return;
+	}
+
+    if (m_decodeUtf8)
+	{
+        Utf8FoldingClassifier classifier(*this);
+        scan(text, start, end, classifier, collector);
+	}
+    else
+	{
+        ByteClassifier classifier(*this);
+        scan(text, start, end, classifier, collector);
+	}
+}
+
+
+template <class ClassifierT, class CollectorT>
+void MultiLiteralSearcher::scan(const char *text, int start, int end, const ClassifierT& classifier, CollectorT& collector) const
+{
+    // The start of each of the last m_maxKeywordLength characters, to find where a match starts when a character
+    // can be more than one byte.  For bytes, the start is just the end less the length.
+    unsigned int ringSize = 1;
+    while (ringSize <= static_cast<unsigned int>(m_maxKeywordLength))
+	{
+        ringSize <<= 1;
+	}
+    const unsigned int ringMask = ringSize - 1;
+    std::vector<int> characterStarts(m_decodeUtf8 ? ringSize : 0);
+
+    int state = 0;
+    int position = start;
+    for (unsigned int characterIndex = 0; position < end; ++characterIndex)
+	{
+        if (m_decodeUtf8)
+		{
+            characterStarts[characterIndex & ringMask] = position;
+		}
+
+        state = m_transitions[state * m_classCount + classifier.next(text, position, end)];
+
+        for (int output = (-1 != m_firstKeyword[state]) ? state : m_outputLink[state]; 0 != output; output = m_outputLink[output])
+		{
+            for (int keyword = m_firstKeyword[output]; -1 != keyword; keyword = m_nextKeyword[keyword])
+			{
+                const int length = m_keywordLengths[keyword];
+                const int matchStart = m_decodeUtf8 ? characterStarts[(characterIndex + 1 - length) & ringMask] : position - length;
+                if (!collector.found(keyword, matchStart, position))
+				{
+                    return;
+				}
+			}
+		}
+
+        if (collector.needsEarliestStart())
+		{
+            const int depth = m_stateDepth[state];
+            int earliestStart = position;
+            if (depth > 0)
+			{
+                earliestStart = m_decodeUtf8 ? characterStarts[(characterIndex + 1 - depth) & ringMask] : position - depth;
+			}
+            if (!collector.advance(earliestStart))
+			{
+                return;
+			}
+		}
+	}
+
+    collector.finish();
+}
+
+
+/** A small LRU cache of the automatons, keyed by the keywords (in order), whether case is ignored and the encoding
+ */
+class MultiLiteralSearcherCache
+{
+public:
+    MultiLiteralSearcherCache() { ::InitializeCriticalSection(&m_lock); }
+    ~MultiLiteralSearcherCache() { ::DeleteCriticalSection(&m_lock); }
+
+    boost::shared_ptr<const MultiLiteralSearcher> get(const std::vector<std::string>& keywords, bool ignoreCase, LiteralEncoding encoding)
+	{
+        const int flags = (ignoreCase ? 1 : 0) | (LITERAL_ENCODING_UTF8 == encoding ? 2 : 0);
+
+        ::EnterCriticalSection(&m_lock);
+        for (entry_list_type::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+		{
+            if (it->flags == flags && it->keywords == keywords)
+			{
+                m_entries.splice(m_entries.begin(), m_entries, it);
+                boost::shared_ptr<const MultiLiteralSearcher> result = m_entries.front().searcher;
+                ::LeaveCriticalSection(&m_lock);
+                return result;
+			}
+		}
+        ::LeaveCriticalSection(&m_lock);
+
+        // Built outside the lock, as for the RegexCache
+        Entry entry;
+        entry.keywords = keywords;
+        entry.flags = flags;
+        entry.searcher.reset(new MultiLiteralSearcher(keywords, ignoreCase, encoding));
+
+        ::EnterCriticalSection(&m_lock);
+        m_entries.push_front(entry);
+        if (m_entries.size() > MultiLiteralSearcher::CACHE_CAPACITY)
+		{
+            m_entries.pop_back();
+		}
+        ::LeaveCriticalSection(&m_lock);
+
+        return entry.searcher;
+	}
+
+private:
+    struct Entry
+	{
+        std::vector<std::string> keywords;
+        int flags;
+        boost::shared_ptr<const MultiLiteralSearcher> searcher;
+	};
+    typedef std::list<Entry> entry_list_type;
+
+    CRITICAL_SECTION m_lock;
+    entry_list_type m_entries;     // Most recently used at the front
+};
+
+static MultiLiteralSearcherCache s_cache;
+
+boost::shared_ptr<const MultiLiteralSearcher> MultiLiteralSearcher::get(const std::vector<std::string>& keywords, bool ignoreCase, LiteralEncoding encoding)
+{
+    return s_cache.get(keywords, ignoreCase, encoding);
+}
+
+}
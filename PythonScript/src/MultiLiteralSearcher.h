@@ -0,0 +1,87 @@
+#ifndef MULTILITERALSEARCHER_20140511_H
+#define MULTILITERALSEARCHER_20140511_H
+
+#include "LiteralSearcher.h"
+
+namespace NppPythonScript
+{
+    /** Finds all the occurrences of a list of literals (keywords) in one pass over the text, with an Aho-Corasick automaton.
+     *
+     *  The automaton is built as a complete DFA, so each character of the text is one table lookup.  To keep the table small,
+     *  the characters are first mapped to classes: each character that appears in a keyword has its own class, and every
+     *  other character is class 0 (which always goes back to the start).
+     *
+     *  Without ignoreCase (and for ANSI text with it) the characters are bytes, folded with the same table as the
+     *  IgnoreCaseLiteralSearcher when ignoring case.  For UTF-8 text ignoring case, the characters are code points, folded with
+     *  UnicodeTables::foldCase(), so a match can be a different number of bytes to the keyword (as for the IgnoreCaseLiteralSearcher).
+     *
+     *  The automaton doesn't change once it is built, so one instance can be used by several searches (and threads) at once.
+     */
+    class MultiLiteralSearcher
+	{
+	public:
+        typedef bool (*occurrenceHandler)(int keyword, int start, int end, void *state);
+
+        MultiLiteralSearcher(const std::vector<std::string>& keywords, bool ignoreCase, LiteralEncoding encoding);
+
+        /** Calls handler for each occurrence of each keyword that lies completely within [start, end) of text, in the order
+         *  of where the occurrences end (the longest first, where several end at the same place), until handler returns false.
+         *
+         *  As with a separate search for each keyword, the occurrences of one keyword don't overlap each other - an occurrence
+         *  that starts before the end of the last one of the same keyword is skipped.  Occurrences of different keywords can overlap.
+         *  Empty keywords never match.
+         */
+        void findAll(const char *text, int start, int end, occurrenceHandler handler, void *state) const;
+
+        /** Calls handler for the occurrences that lie completely within [start, end) of text that don't overlap each other,
+         *  choosing leftmost-longest: from where the last one ended, the occurrence that starts first, and the longest of the ones
+         *  that start there (or the first keyword, if several keywords have the same text).  The occurrences are reported in 
+         *  document order, until handler returns false.
+         */
+        void findLeftmostLongest(const char *text, int start, int end, occurrenceHandler handler, void *state) const;
+
+        int keywordCount() const { return static_cast<int>(m_keywordLengths.size()); }
+        int stateCount() const { return static_cast<int>(m_firstKeyword.size()); }
+
+        /** Returns the automaton for the keywords, from a small cache of the ones built most recently, building it if it isn't there.
+         */
+        static boost::shared_ptr<const MultiLiteralSearcher> get(const std::vector<std::string>& keywords, bool ignoreCase, LiteralEncoding encoding);
+
+        static const size_t CACHE_CAPACITY = 8;
+
+	private:
+        MultiLiteralSearcher(const MultiLiteralSearcher&);              // copy constructor disabled
+        MultiLiteralSearcher& operator = (const MultiLiteralSearcher&); // assignment operator disabled
+
+        struct ByteClassifier;
+        struct Utf8FoldingClassifier;
+        class AllOccurrences;
+        class LeftmostLongest;
+
+        int classOf(U32 character);
+        void addKeyword(int keyword, const std::vector<int>& characterClasses);
+        void buildTransitions();
+
+        template <class CollectorT>
+        void scan(const char *text, int start, int end, CollectorT& collector) const;
+        template <class ClassifierT, class CollectorT>
+        void scan(const char *text, int start, int end, const ClassifierT& classifier, CollectorT& collector) const;
+
+        bool m_decodeUtf8;                     // The characters are folded code points rather than bytes
+        unsigned char m_byteFold[256];
+        int m_byteClass[256];                  // Class of each (folded) byte - for UTF-8 ignoring case, only the ASCII bytes
+        std::map<U32, int> m_codePointClass;   // Class of each non-ASCII code point in a keyword, for UTF-8 ignoring case
+        int m_classCount;
+
+        std::vector<int> m_transitions;        // m_classCount entries for each state
+        std::vector<int> m_firstKeyword;       // The first keyword that ends at each state, or -1
+        std::vector<int> m_nextKeyword;        // The next keyword with the same text as each keyword, or -1
+        std::vector<int> m_outputLink;         // The longest proper suffix of each state that has a keyword, or 0 (the start) if none does
+        std::vector<int> m_stateDepth;         // The number of characters from the start to each state
+        std::vector<int> m_keywordLengths;     // In characters
+        int m_maxKeywordLength;
+	};
+
+}
+
+#endif // MULTILITERALSEARCHER_20140511_H
@@ -0,0 +1,103 @@
+#include "stdafx.h"
+
+#include "NotificationFilter.h"
+#include "Scintilla.h"
+
+namespace NppPythonScript
+{
+
+NotificationFilter::NotificationFilter()
+	: m_modificationTypes(0),
+      m_hasLines(false),
+      m_startLine(0),
+      m_endLine(0),
+      m_minLength(0)
+{
+}
+
+void NotificationFilter::setLines(int startLine, int endLine)
+{
+    m_hasLines = true;
+    m_startLine = startLine;
+    m_endLine = endLine;
+}
+
+void NotificationFilter::setCharacters(const std::vector<int>& characters)
+{
+    m_characters = characters;
+    std::sort(m_characters.begin(), m_characters.end());
+}
+
+bool NotificationFilter::isEmpty() const
+{
+    return 0 == m_modificationTypes && !m_hasLines && 0 == m_minLength && m_characters.empty();
+}
+
+bool NotificationFilter::needsLine(const SCNotification *notifyCode) const
+{
+    return m_hasLines && hasPosition(notifyCode->nmhdr.code) && notifyCode->position >= 0;
+}
+
+bool NotificationFilter::matches(const SCNotification *notifyCode, int line) const
+{
+    const int code = notifyCode->nmhdr.code;
+    if (SCN_MODIFIED == code && m_modificationTypes && 0 == (notifyCode->modificationType & m_modificationTypes))
+	{
+        return false;
+	}
+
+    if (m_minLength && hasLength(code) && notifyCode->length < m_minLength)
+	{
+        return false;
+	}
+
+    if (SCN_CHARADDED == code && !m_characters.empty() && !std::binary_search(m_characters.begin(), m_characters.end(), notifyCode->ch))
+	{
+        return false;
+	}
+
+    if (m_hasLines && hasPosition(code))
+	{
+        // An inserted line break adds lines after the one the position is on
+        const int lastLine = (SCN_MODIFIED == code && notifyCode->linesAdded > 0) ? line + notifyCode->linesAdded : line;
+        if (line < 0 || lastLine < m_startLine || line > m_endLine)
+		{
+            return false;
+		}
+	}
+
+    return true;
+}
+
+bool NotificationFilter::hasPosition(int code)
+{
+    switch (code)
+	{
+	case SCN_STYLENEEDED:
+	case SCN_DOUBLECLICK:
+	case SCN_MODIFIED:
+	case SCN_MARGINCLICK:
+	case SCN_NEEDSHOWN:
+	case SCN_USERLISTSELECTION:
+	case SCN_DWELLSTART:
+	case SCN_DWELLEND:
+	case SCN_HOTSPOTCLICK:
+	case SCN_HOTSPOTDOUBLECLICK:
+	case SCN_HOTSPOTRELEASECLICK:
+	case SCN_INDICATORCLICK:
+	case SCN_INDICATORRELEASE:
+	case SCN_AUTOCSELECTION:
+        return true;
+
+	default:
+        // SCN_CALLTIPCLICK's position is which arrow was clicked
+        return false;
+	}
+}
+
+bool NotificationFilter::hasLength(int code)
+{
+    return SCN_MODIFIED == code || SCN_NEEDSHOWN == code;
+}
+
+}
@@ -0,0 +1,55 @@
+#ifndef NOTIFICATIONFILTER_20140511_H
+#define NOTIFICATIONFILTER_20140511_H
+
+struct SCNotification;
+
+namespace NppPythonScript
+{
+    /** Which notifications a callback wants, checked by ScintillaWrapper::notify() before it takes the GIL or makes the
+     *  args for the callback (editor.callback(..., filter={...})).
+     *
+     *  Each part of the filter only applies to the notifications that have the field it looks at, so a callback registered
+     *  for SCN_MODIFIED and SCN_CHARADDED with a modificationType mask still gets every SCN_CHARADDED:
+     *   - modificationType: SCN_MODIFIED, if any of the flags in the mask are set
+     *   - lines: notifications with a position, if its line is in [startLine, endLine] - or for SCN_MODIFIED, if any of
+     *     the lines the modification added are
+     *   - minLength: SCN_MODIFIED and SCN_NEEDSHOWN, if the length is at least minLength
+     *   - characters: SCN_CHARADDED, if ch is one of them
+     */
+    class NotificationFilter
+	{
+	public:
+        NotificationFilter();
+
+        void setModificationTypes(int mask) { m_modificationTypes = mask; }
+        void setLines(int startLine, int endLine);
+        void setMinLength(int minLength) { m_minLength = minLength; }
+        void setCharacters(const std::vector<int>& characters);
+
+        /** True if every notification matches
+         */
+        bool isEmpty() const;
+
+        /** True if matches() needs the line of the notification's position (which takes a call to Scintilla), rather than
+         *  ignoring it
+         */
+        bool needsLine(const SCNotification *notifyCode) const;
+
+        /** line is the line of notifyCode->position, or -1 if needsLine() is false
+         */
+        bool matches(const SCNotification *notifyCode, int line) const;
+
+        static bool hasPosition(int code);
+        static bool hasLength(int code);
+
+	private:
+        int m_modificationTypes;       // 0 for any
+        bool m_hasLines;
+        int m_startLine;
+        int m_endLine;
+        int m_minLength;
+        std::vector<int> m_characters; // Sorted, or empty for any
+	};
+}
+
+#endif // NOTIFICATIONFILTER_20140511_H
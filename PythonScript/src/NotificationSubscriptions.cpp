@@ -0,0 +1,35 @@
+#include "stdafx.h"
+
+#include "NotificationSubscriptions.h"
+
+namespace NppPythonScript
+{
+
+NotificationSubscriptions::NotificationSubscriptions()
+	: m_otherCodes(0)
+{
+    for (int word = 0; word < WORD_COUNT; ++word)
+	{
+        m_bits[word] = 0;
+	}
+}
+
+void NotificationSubscriptions::clear()
+{
+    LONG bits[WORD_COUNT] = { 0 };
+    publish(bits, 0);
+}
+
+/** Each word is swapped on its own, so a notification at the same time as an update sees each code either before or after it,
+ *  the same as if it had come just before or just after
+ */
+void NotificationSubscriptions::publish(const LONG *bits, LONG otherCodes)
+{
+    for (int word = 0; word < WORD_COUNT; ++word)
+	{
+        ::InterlockedExchange(&m_bits[word], bits[word]);
+	}
+    ::InterlockedExchange(&m_otherCodes, otherCodes);
+}
+
+}
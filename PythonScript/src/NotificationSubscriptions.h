@@ -0,0 +1,70 @@
+#ifndef NOTIFICATIONSUBSCRIPTIONS_20140511_H
+#define NOTIFICATIONSUBSCRIPTIONS_20140511_H
+
+namespace NppPythonScript
+{
+    /** Which notification codes have a callback registered, as a bitmap that can be read without the GIL or any lock.
+     *
+     *  ScintillaWrapper::notify() is called for every Scintilla notification (SCN_UPDATEUI, SCN_PAINTED and SCN_MODIFIED
+     *  several times for each key press), and most of them have no callback.  isSubscribed() lets it return for those before
+     *  it takes the GIL and the callback mutex.  The list of callbacks is still the real record - the bitmap is rebuilt from
+     *  its codes with update() whenever it changes (under the callback mutex, so only one update() runs at a time).
+     *
+     *  Each code from FIRST_CODE (SCN_STYLENEEDED) has a bit.  Any other code is subscribed if a callback has been registered
+     *  for any code outside that range, so notify() looks those up in the list as before.
+     */
+    class NotificationSubscriptions
+	{
+	public:
+        static const int FIRST_CODE = 2000;
+        static const int CODE_COUNT = 64;
+
+        NotificationSubscriptions();
+
+        bool isSubscribed(int code) const
+		{
+            const int bit = code - FIRST_CODE;
+            if (bit >= 0 && bit < CODE_COUNT)
+			{
+                return 0 != (m_bits[bit / BITS_PER_WORD] & mask(bit));
+			}
+            return 0 != m_otherCodes;
+		}
+
+        /** Sets the subscribed codes to the ones in [first, last) - the keys of the callback map, which may repeat
+         */
+        template <class IteratorT>
+        void update(IteratorT first, IteratorT last)
+		{
+            LONG bits[WORD_COUNT] = { 0 };
+            LONG otherCodes = 0;
+            for (; first != last; ++first)
+			{
+                const int bit = first->first - FIRST_CODE;
+                if (bit >= 0 && bit < CODE_COUNT)
+				{
+                    bits[bit / BITS_PER_WORD] |= mask(bit);
+				}
+                else
+				{
+                    otherCodes = 1;
+				}
+			}
+            publish(bits, otherCodes);
+		}
+
+        void clear();
+
+	private:
+        static const int BITS_PER_WORD = 32;
+        static const int WORD_COUNT = CODE_COUNT / BITS_PER_WORD;
+
+        static LONG mask(int bit) { return static_cast<LONG>(1UL << (bit % BITS_PER_WORD)); }
+        void publish(const LONG *bits, LONG otherCodes);
+
+        volatile LONG m_bits[WORD_COUNT];
+        volatile LONG m_otherCodes;
+	};
+}
+
+#endif // NOTIFICATIONSUBSCRIPTIONS_20140511_H
@@ -0,0 +1,287 @@
+#include "stdafx.h"
+
+#include "ParallelSearch.h"
+
+namespace NppPythonScript
+{
+
+int ParallelSearchBase::s_threshold = ParallelSearchBase::DEFAULT_THRESHOLD;
+
+bool ParallelSearchBase::canSearch(int searchLength, const char *pattern, python_re_flags flags)
+{
+    return s_threshold > 0
+        && searchLength >= s_threshold
+        && processorCount() > 1
+        && 0 == (flags & (python_re_flag_literal | python_re_flag_dotall | python_re_flag_wholedoc | python_re_flag_lines))
+        && isLineLocal(pattern);
+}
+
+bool ParallelSearchBase::canSearchLinesTogether(const char *text, int startPosition, int textLength, const char *pattern, python_re_flags flags)
+{
+    return 0 == (flags & (python_re_flag_includelineendings | python_re_flag_dotall | python_re_flag_wholedoc))
+        && isLineLocal(pattern)
+        && NULL == memchr(text + startPosition, '\r', static_cast<size_t>(textLength - startPosition));
+}
+
+/** Escapes that can't match a newline, or look past one: word and digit classes, non-space, horizontal space,
+ *  word boundaries and single characters other than \\n (in a set, the boundaries don't mean anything, but they're not allowed there anyway).
+ */
+static bool isLineLocalEscape(char escaped, bool inSet)
+{
+    if ('\0' == escaped)
+	{
+        return false;
+	}
+
+    if (strchr("wdSht", escaped) || (!inSet && strchr("bB<>", escaped)))
+	{
+        return true;
+	}
+
+    // \r is fine, as the chunks are only split after a \n
+    if ('r' == escaped || 'a' == escaped || 'e' == escaped || 'f' == escaped)
+	{
+        return true;
+	}
+
+    // Escaped punctuation is just the character, apart from \` and \' (the start and end of the text)
+    return escaped > ' ' && escaped < 0x7F && !isalnum(static_cast<unsigned char>(escaped)) && '`' != escaped && '\'' != escaped;
+}
+
+/** Skips over the set (bracket expression) starting at position, and returns the position of its closing ']',
+ *  or NULL if the set could match a newline.
+ */
+static const char *skipLineLocalSet(const char *position)
+{
+    ++position;
+    if ('^' == *position)
+	{
+        // A negated set matches a newline, unless it excludes one - which needs an escape that isn't allowed anyway
+        return NULL;
+	}
+
+    bool previousIsRangeStart = false;    // The previous item was a plain character, so can start a range
+    bool first = true;
+    for (; '\0' != *position; ++position, first = false)
+	{
+        unsigned char current = static_cast<unsigned char>(*position);
+        if (']' == current && !first)
+		{
+            return position;
+		}
+
+        if ('-' == current && !first && ']' != position[1])
+		{
+            // A range between two plain characters (which are all at least a space) can't include a newline
+            if (!previousIsRangeStart || '\\' == position[1] || '[' == position[1] || static_cast<unsigned char>(position[1]) < ' ')
+			{
+                return NULL;
+			}
+            ++position;
+            previousIsRangeStart = false;
+            continue;
+		}
+
+        if ('\\' == current)
+		{
+            ++position;
+            if (!isLineLocalEscape(*position, true))
+			{
+                return NULL;
+			}
+            previousIsRangeStart = false;
+            continue;
+		}
+
+        if ('[' == current && (':' == position[1] || '=' == position[1] || '.' == position[1]))
+		{
+            static const char *lineLocalClasses[] = { "alpha", "alnum", "digit", "upper", "lower", "punct", "xdigit", "word", "graph" };
+
+            if (':' != position[1])
+			{
+                return NULL;
+			}
+            const char *nameEnd = strstr(position + 2, ":]");
+            if (NULL == nameEnd)
+			{
+                return NULL;
+			}
+            std::string name(position + 2, nameEnd);
+            bool known = false;
+            for (size_t i = 0; i < sizeof(lineLocalClasses) / sizeof(lineLocalClasses[0]); ++i)
+			{
+                known = known || name == lineLocalClasses[i];
+			}
+            if (!known)
+			{
+                return NULL;
+			}
+            position = nameEnd + 1;
+            previousIsRangeStart = false;
+            continue;
+		}
+
+        if (current < ' ')
+		{
+            return NULL;
+		}
+        previousIsRangeStart = true;
+	}
+
+    // Unterminated - the regex won't compile anyway
+    return NULL;
+}
+
+bool ParallelSearchBase::isLineLocal(const char *pattern)
+{
+    for (const char *position = pattern; '\0' != *position; ++position)
+	{
+        switch (*position)
+		{
+            case '\n':
+                return false;
+
+            case '\\':
+                ++position;
+                if ('\0' == *position)
+				{
+                    return false;
+				}
+                if (*position >= '1' && *position <= '9')
+				{
+                    // A back reference - the group it refers to is checked where it is.  \\10 and up could be octal.
+                    if (position[1] >= '0' && position[1] <= '9')
+					{
+                        return false;
+					}
+                    break;
+				}
+                if (!isLineLocalEscape(*position, false))
+				{
+                    return false;
+				}
+                break;
+
+            case '[':
+                position = skipLineLocalSet(position);
+                if (NULL == position)
+				{
+                    return false;
+				}
+                break;
+
+            case '(':
+                if ('*' == position[1])
+				{
+                    // Verbs
+                    return false;
+				}
+                if ('?' == position[1])
+				{
+                    // Groups, look-arounds, named groups and conditions are fine - their contents are checked as usual.
+                    // Inline modifiers (e.g. (?s) or (?x)), comments and recursion are not.
+                    if (NULL == strchr(":=!><|P'(", position[2]) || '\0' == position[2])
+					{
+                        return false;
+					}
+                    ++position;
+				}
+                break;
+
+            default:
+                break;
+		}
+	}
+    return true;
+}
+
+std::vector<int> ParallelSearchBase::splitAtLines(const char *text, int start, int end, int chunkSize)
+{
+    std::vector<int> boundaries;
+    boundaries.push_back(start);
+
+    int chunkStart = start;
+    while (end - chunkStart > chunkSize)
+	{
+        const char *newline = static_cast<const char *>(memchr(text + chunkStart + chunkSize, '\n', end - chunkStart - chunkSize));
+        if (NULL == newline || newline + 1 == text + end)
+		{
+            break;
+		}
+        chunkStart = static_cast<int>(newline - text) + 1;
+        boundaries.push_back(chunkStart);
+	}
+
+    boundaries.push_back(end);
+    return boundaries;
+}
+
+int ParallelSearchBase::processorCount()
+{
+    SYSTEM_INFO systemInfo;
+    ::GetSystemInfo(&systemInfo);
+    return static_cast<int>(systemInfo.dwNumberOfProcessors);
+}
+
+
+/** Shared by the worker threads of one runOnWorkers() - each worker takes the next chunk until there are none left
+ */
+struct WorkerState
+{
+    volatile LONG nextChunk;
+    int chunkCount;
+    void (*function)(int, void *);
+    void *state;
+};
+
+static DWORD WINAPI workerThread(LPVOID param)
+{
+    WorkerState *workerState = reinterpret_cast<WorkerState*>(param);
+    for (;;)
+	{
+        int chunk = static_cast<int>(InterlockedIncrement(&workerState->nextChunk)) - 1;
+        if (chunk >= workerState->chunkCount)
+		{
+            break;
+		}
+        workerState->function(chunk, workerState->state);
+	}
+    return 0;
+}
+
+void ParallelSearchBase::runOnWorkers(int chunkCount, int threadCount, chunkFunction function, void *state)
+{
+    WorkerState workerState;
+    workerState.nextChunk = 0;
+    workerState.chunkCount = chunkCount;
+    workerState.function = function;
+    workerState.state = state;
+
+    // The calling thread is one of the workers.  WaitForMultipleObjects can only wait for MAXIMUM_WAIT_OBJECTS threads.
+    threadCount = (std::min)(threadCount, chunkCount);
+    threadCount = (std::min)(threadCount, static_cast<int>(MAXIMUM_WAIT_OBJECTS) + 1);
+
+    std::vector<HANDLE> threads;
+    for (int i = 1; i < threadCount; ++i)
+	{
+        DWORD threadId;
+        HANDLE thread = CreateThread(NULL, 0, workerThread, &workerState, 0, &threadId);
+        if (NULL != thread)
+		{
+            threads.push_back(thread);
+		}
+	}
+
+    workerThread(&workerState);
+
+    if (!threads.empty())
+	{
+        WaitForMultipleObjects(static_cast<DWORD>(threads.size()), &threads[0], TRUE, INFINITE);
+        for (std::vector<HANDLE>::iterator it = threads.begin(); it != threads.end(); ++it)
+		{
+            CloseHandle(*it);
+		}
+	}
+}
+
+}
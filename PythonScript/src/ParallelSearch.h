@@ -0,0 +1,411 @@
+#ifndef PARALLELSEARCH_20140503_H
+#define PARALLELSEARCH_20140503_H
+
+#include "Replacer.h"
+
+namespace NppPythonScript
+{
+
+/** The parts of ParallelSearch that don't depend on the encoding of the text.
+ */
+class ParallelSearchBase
+{
+public:
+    /** Searches over at least this many bytes are split over the processors, if the pattern allows it (see canSearch())
+     *  Zero turns off parallel searching.
+     */
+    static const int DEFAULT_THRESHOLD = 4 * 1024 * 1024;
+
+    // Chunks are at least this big, so each worker has enough to do for the overhead not to matter
+    static const int MIN_CHUNK_SIZE = 256 * 1024;
+
+    static void setThreshold(int threshold) { s_threshold = threshold; }
+    static int getThreshold() { return s_threshold; }
+
+    /** True if a search of searchLength bytes for pattern is big enough to split over the processors, and the pattern can
+     *  be searched for one chunk of lines at a time (see isLineLocal()).
+     */
+    static bool canSearch(int searchLength, const char *pattern, python_re_flags flags);
+
+    /** True if no match of pattern can contain a newline, and no assertion in it (look-aheads, look-behinds, \\z etc) can see
+     *  past one.  Searching a chunk of whole lines on its own then gives exactly the same matches as searching the whole text.
+     *
+     *  Like the RequiredLiteralParser, this is deliberately cautious: anything that is not known to stay within a line
+     *  (\\s, \\W, [^...], \\x0a, inline modifiers etc) makes the pattern not line local.
+     */
+    static bool isLineLocal(const char *pattern);
+
+    /** True if a python_re_flag_lines search of [startPosition, textLength) of text for pattern finds the same matches as a
+     *  search of it all at once, so the flag can be dropped (and the search split over the processors).  That needs a line
+     *  local pattern, the line endings left out, and no \r in the text, so that every line ends where the regex sees it end.
+     */
+    static bool canSearchLinesTogether(const char *text, int startPosition, int textLength, const char *pattern, python_re_flags flags);
+
+    /** Returns the chunk boundaries for [start, end) of text, each chunk being at least chunkSize bytes and ending just after
+     *  a '\\n' (apart from the last one).  The first boundary is start, and the last is end.
+     */
+    static std::vector<int> splitAtLines(const char *text, int start, int end, int chunkSize);
+
+    static int processorCount();
+
+protected:
+    typedef void (*chunkFunction)(int chunk, void *state);
+
+    /** Calls function for each chunk from 0 to chunkCount - 1, on threadCount threads (including the calling thread),
+     *  and returns once all the chunks are done.
+     */
+    static void runOnWorkers(int chunkCount, int threadCount, chunkFunction function, void *state);
+
+private:
+    static int s_threshold;
+};
+
+
+/** A match found on a worker thread of a ParallelSearch, and handed to the result handler afterwards on the calling thread.
+ *  The groups are copied when the match is found.  Anything that needs the match_results (named groups and expand())
+ *  finds the match again, with the same search that the regex_iterator of a single threaded search would have made
+ *  (i.e. from the end of the previous match), so the prefix and everything else come out the same.
+ */
+template <class CharTraitsT>
+class StoredRegexMatch : public Match
+{
+public:
+    typedef typename CharTraitsT::text_iterator_type text_iterator_type;
+    typedef boost::match_results<text_iterator_type> results_type;
+
+    StoredRegexMatch(const char *text, int textLength, int startPosition, const typename CharTraitsT::regex_type& regex, boost::regex_constants::match_flag_type matchFlags)
+		: m_text(text),
+          m_textLength(textLength),
+          m_startPosition(startPosition),
+          m_regex(regex),
+          m_matchFlags(matchFlags),
+          m_groups(NULL),
+          m_groupCount(0),
+          m_searchFrom(startPosition),
+          m_afterEmptyMatch(false),
+          m_resultsFound(false)
+	{}
+
+    /** groups are the groupCount groups of the match, searchFrom is the end of the previous match (or the start of the search),
+     *  and afterEmptyMatch is true if the previous match was empty.
+     */
+    void setMatch(const GroupDetail *groups, int groupCount, int searchFrom, bool afterEmptyMatch)
+	{
+        m_groups = groups;
+        m_groupCount = groupCount;
+        m_searchFrom = searchFrom;
+        m_afterEmptyMatch = afterEmptyMatch;
+        m_resultsFound = false;
+	}
+
+    virtual int groupCount() { return m_groupCount; }
+
+    virtual bool group(int groupNo, GroupDetail& groupDetail)
+	{
+        if (groupNo < 0 || groupNo >= m_groupCount)
+		{
+            return false;
+		}
+        groupDetail = m_groups[groupNo];
+        return true;
+	}
+
+    virtual bool groupName(const char *groupName, GroupDetail& groupDetail) { return group(groupIndexFromName(groupName), groupDetail); }
+
+    virtual std::string getTextForGroup(const GroupDetail& groupDetail) { return std::string(m_text + groupDetail.start(), m_text + groupDetail.end()); }
+
+    virtual void expand(const char* format, char **result, int *resultLength)
+	{
+        BoostRegexMatch<CharTraitsT> match(m_text, &findResults());
+        match.expand(format, result, resultLength);
+	}
+
+    virtual int groupIndexFromName(const char *groupName)
+	{
+        BoostRegexMatch<CharTraitsT> match(m_text, &findResults());
+        return match.groupIndexFromName(groupName);
+	}
+
+private:
+    results_type& findResults()
+	{
+        if (!m_resultsFound)
+		{
+            boost::regex_constants::match_flag_type flags = m_matchFlags;
+            if (m_afterEmptyMatch)
+			{
+                flags |= boost::regex_constants::match_not_initial_null;
+			}
+            boost::regex_search(text_iterator_type(m_text, m_searchFrom, m_textLength), text_iterator_type(m_text, m_textLength, m_textLength),
+                                m_results, m_regex, flags, text_iterator_type(m_text, m_startPosition, m_textLength));
+            m_resultsFound = true;
+		}
+        return m_results;
+	}
+
+    const char *m_text;
+    const int m_textLength;
+    const int m_startPosition;
+    const typename CharTraitsT::regex_type& m_regex;
+    const boost::regex_constants::match_flag_type m_matchFlags;
+
+    const GroupDetail *m_groups;
+    int m_groupCount;
+    int m_searchFrom;
+    bool m_afterEmptyMatch;
+
+    results_type m_results;
+    bool m_resultsFound;
+};
+
+
+/** Searches a large text on all the processors.  The text is split into chunks of whole lines, and each chunk is searched
+ *  with its own Replacer on a worker thread, which only collects the groups of the matches.  reportMatches() then gives
+ *  the matches to the result handler in document order, on the calling thread, so the handler doesn't need to be thread
+ *  safe (and can be Python).
+ *
+ *  This only gives the same matches as a search of the whole text if the pattern is line local (see ParallelSearchBase::isLineLocal()),
+ *  and the flags don't include wholedoc (where ^ is only the start of the text) or dotall - canSearch() checks all of that.
+ *
+ *  Each chunk is searched as if it were the whole text, starting from the start of its first line, which is exactly what a
+ *  single search arrives at: no match can run over the newline at the end of the previous chunk, and neither ^ nor \\b
+ *  can tell the start of the text from the start of a line.
+ */
+template <class CharTraitsT>
+class ParallelSearch : public ParallelSearchBase
+{
+public:
+    /** With collectGroups false, the matches are only counted (in getStats().matches), and there is nothing for reportMatches()
+     */
+    ParallelSearch(const char *text, int textLength, int startPosition, int maxCount, const char *search, python_re_flags flags, bool collectGroups = true);
+
+    /** Searches all the chunks, on processorCount() threads.  This doesn't call anything in Python, so it can (and should)
+     *  be run without the GIL.
+     *  If the regex took more steps than RegexComplexity::getStepLimit() in any chunk, this throws the RegexTooComplexException 
+     *  straight away, rather than leave an ordinary search to take as long again to give up.
+     *  Returns false if the search of any chunk failed in any other way, in which case the caller should
+     *  fall back to an ordinary search, which fails in the same way as it always has.
+     *  The chunks share one SearchBudget, started when the ParallelSearch was created.  If it stops any chunk, getStats().stopReason
+     *  says why, and there are no matches for reportMatches().
+     */
+    bool run() { return run(processorCount(), (std::max)(MIN_CHUNK_SIZE, (m_textLength - m_startPosition) / (processorCount() * 8))); }
+
+    bool run(int threadCount, int chunkSize);
+
+    /** Calls resultHandler for each match, in order, until it returns false or maxCount matches have been reported.
+     */
+    void reportMatches(searchResultHandler resultHandler, void *resultHandlerState);
+
+    /** The counters of all the chunks together
+     */
+    const SearchStats& getStats() const { return m_stats; }
+
+private:
+    struct ChunkResult
+	{
+        ChunkResult()
+			: start(0), end(0), isLast(false), textLength(0), collectGroups(true), matchCount(0), groupCount(0), failed(false), tooComplex(false)
+		{}
+
+        int start;
+        int end;
+        bool isLast;
+        int textLength;
+        bool collectGroups;
+        long matchCount;
+        int groupCount;
+        std::vector<GroupDetail> groups;    // groupCount entries for each match
+        SearchStats stats;
+        bool failed;
+        bool tooComplex;
+	};
+
+    static void searchChunk(int chunk, void *state);
+    static bool collectMatch(const char *text, Match *match, void *state);
+
+    const char *m_text;
+    const int m_textLength;
+    const int m_startPosition;
+    const int m_maxCount;
+    const char *m_search;
+    const python_re_flags m_flags;
+    const bool m_collectGroups;
+    typename RegexCache<CharTraitsT>::regex_ptr m_regex;
+    std::vector<ChunkResult> m_chunks;
+    SearchStats m_stats;
+    SearchBudget m_budget;
+};
+
+template <class CharTraitsT>
+ParallelSearch<CharTraitsT>::ParallelSearch(const char *text, int textLength, int startPosition, int maxCount, const char *search, python_re_flags flags, bool collectGroups)
+	: m_text(text),
+      m_textLength(textLength),
+      m_startPosition(startPosition),
+      m_maxCount(maxCount),
+      m_search(search),
+      m_flags(flags),
+      m_collectGroups(collectGroups)
+{
+    // Compiled here, so that a bad pattern is reported on the calling thread.  The workers get the same regex from the cache.
+    m_regex = RegexCache<CharTraitsT>::getInstance().get(search, Replacer<CharTraitsT>::getSyntaxFlags(flags));
+}
+
+template <class CharTraitsT>
+bool ParallelSearch<CharTraitsT>::run(int threadCount, int chunkSize)
+{
+    std::vector<int> boundaries = splitAtLines(m_text, m_startPosition, m_textLength, chunkSize);
+
+    m_chunks.clear();
+    m_chunks.resize(boundaries.size() - 1);
+    for (size_t chunk = 0; chunk < m_chunks.size(); ++chunk)
+	{
+        m_chunks[chunk].start = boundaries[chunk];
+        m_chunks[chunk].end = boundaries[chunk + 1];
+        m_chunks[chunk].isLast = (chunk + 1 == m_chunks.size());
+        m_chunks[chunk].textLength = m_textLength;
+        m_chunks[chunk].collectGroups = m_collectGroups;
+	}
+
+    runOnWorkers(static_cast<int>(m_chunks.size()), threadCount, searchChunk, this);
+
+    m_stats = SearchStats();
+    m_stats.parallelChunks = static_cast<long>(m_chunks.size());
+    long foundMatches = 0;
+    for (typename std::vector<ChunkResult>::const_iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+	{
+        if (it->tooComplex)
+		{
+            throw RegexTooComplexException(m_search, RegexComplexity::getStepLimit());
+		}
+	}
+
+    for (typename std::vector<ChunkResult>::const_iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+	{
+        if (it->failed)
+		{
+            return false;
+		}
+        m_stats.prefilterUsed = it->stats.prefilterUsed;
+        m_stats.prefilterLiteral = it->stats.prefilterLiteral;
+        m_stats.literalCandidates += it->stats.literalCandidates;
+        m_stats.regexRuns += it->stats.regexRuns;
+        m_stats.slowestRegexRun = (std::max)(m_stats.slowestRegexRun, it->stats.slowestRegexRun);
+        foundMatches += it->matchCount;
+
+        // The chunks before the first one that was stopped all finished, so the search got as far as that one did
+        if (SEARCH_NOT_STOPPED != it->stats.stopReason && SEARCH_NOT_STOPPED == m_stats.stopReason)
+		{
+            m_stats.stopReason = it->stats.stopReason;
+            m_stats.stoppedAt = it->stats.stoppedAt;
+		}
+	}
+
+    // The matches are only counted here if they're not reported, or won't be because the search was stopped
+    if (!m_collectGroups || SEARCH_NOT_STOPPED != m_stats.stopReason)
+	{
+        m_stats.matches = foundMatches;
+	}
+
+    if (SEARCH_NOT_STOPPED != m_stats.stopReason)
+	{
+        m_chunks.clear();
+	}
+
+    if (m_maxCount > 0 && m_stats.matches > m_maxCount)
+	{
+        m_stats.matches = m_maxCount;
+	}
+
+    return true;
+}
+
+template <class CharTraitsT>
+void ParallelSearch<CharTraitsT>::searchChunk(int chunk, void *state)
+{
+    ParallelSearch *search = reinterpret_cast<ParallelSearch*>(state);
+    ChunkResult& result = search->m_chunks[chunk];
+
+    // The chunk is searched as though the text ended at the end of the chunk.  No chunk needs more than maxCount matches.
+    try
+	{
+        Replacer<CharTraitsT> replacer;
+        replacer.setBudget(search->m_budget);
+        replacer.search(search->m_text, result.end, result.start, search->m_maxCount, search->m_search, collectMatch, &result, search->m_flags);
+        result.stats = replacer.getStats();
+	}
+    catch (RegexTooComplexException&)
+	{
+        result.tooComplex = true;
+	}
+    catch (...)
+	{
+        result.failed = true;
+	}
+}
+
+template <class CharTraitsT>
+bool ParallelSearch<CharTraitsT>::collectMatch(const char * /* text */, Match *match, void *state)
+{
+    ChunkResult *result = reinterpret_cast<ChunkResult*>(state);
+    GroupDetail fullMatch;
+    match->group(0, fullMatch);
+
+    // An empty match at the end of the chunk is at the start of the next one, and is found there
+    if (!result->isLast && fullMatch.start() >= result->end)
+	{
+        return false;
+	}
+
+    ++result->matchCount;
+    if (!result->collectGroups)
+	{
+        return true;
+	}
+
+    result->groupCount = match->groupCount();
+    result->groups.push_back(fullMatch);
+    for (int groupNo = 1; groupNo < result->groupCount; ++groupNo)
+	{
+        GroupDetail groupDetail;
+        match->group(groupNo, groupDetail);
+
+        // Groups that didn't match are at the end of what was searched, which is the end of the whole text for a single search
+        if (!groupDetail.matched())
+		{
+            groupDetail = GroupDetail(result->textLength, result->textLength, false);
+		}
+        result->groups.push_back(groupDetail);
+	}
+    return true;
+}
+
+template <class CharTraitsT>
+void ParallelSearch<CharTraitsT>::reportMatches(searchResultHandler resultHandler, void *resultHandlerState)
+{
+    StoredRegexMatch<CharTraitsT> match(m_text, m_textLength, m_startPosition, *m_regex, Replacer<CharTraitsT>::getMatchFlags(m_flags));
+
+    int searchFrom = m_startPosition;
+    bool afterEmptyMatch = false;
+    for (typename std::vector<ChunkResult>::const_iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+	{
+        const int groupCount = it->groupCount;
+        for (size_t index = 0; index < it->groups.size(); index += groupCount)
+		{
+            const GroupDetail& fullMatch = it->groups[index];
+            match.setMatch(&it->groups[index], groupCount, searchFrom, afterEmptyMatch);
+            searchFrom = fullMatch.end();
+            afterEmptyMatch = (fullMatch.start() == fullMatch.end());
+
+            ++m_stats.matches;
+            bool shouldContinue = resultHandler(m_text, &match, resultHandlerState);
+            if (!shouldContinue || (m_maxCount > 0 && m_stats.matches >= m_maxCount))
+			{
+                return;
+			}
+		}
+	}
+}
+
+}
+
+#endif // PARALLELSEARCH_20140503_H
@@ -1,15 +1,29 @@
 #ifndef _PYPRODUCER_H
 #define _PYPRODUCER_H
 #include "DebugTrace.h"
+#include "BoundedQueue.h"
+#include "GILManager.h"
 
 namespace NppPythonScript
 {
 
+/** Runs consume() for each item produce()d, one at a time, on a thread of its own.
+ *
+ *  The items are held in a BoundedQueue, so a produce() doesn't take a lock, and only the one that finds the queue empty
+ *  sets the event to wake the consumer.  When the queue is full, the QueueOverflow says whether produce() waits for room,
+ *  or which item is thrown away - by default the new one, so produce() never waits, and returns false for the caller to
+ *  report.  The script and console statement queues only fill up if thousands of them are waiting.  QUEUE_BLOCK is only
+ *  safe where the consumer can't be waiting for the producing thread - an async Scintilla callback that changes the text
+ *  waits for the GUI thread, which is the one producing the callbacks, so the editor doesn't allow it.  A producer that
+ *  holds the GIL gives it up while it waits, as the consumer needs it.
+ */
 template<typename DataT>
 class PyProducerConsumer
 {
 public:
-	PyProducerConsumer();
+    static const long DEFAULT_QUEUE_CAPACITY = 4096;
+
+	PyProducerConsumer(long queueCapacity = DEFAULT_QUEUE_CAPACITY, QueueOverflow overflow = QUEUE_DROP_NEWEST);
 	virtual ~PyProducerConsumer();
 
 	void startConsumer();
@@ -17,6 +31,10 @@ public:
 
 	bool consumerBusy();
 
+    void setQueueOverflow(QueueOverflow overflow) { m_overflow = overflow; }
+    QueueOverflow getQueueOverflow() const { return m_overflow; }
+    QueueStats getQueueStats() const { return m_queue.getStats(); }
+
 protected:
 	bool produce(std::shared_ptr<DataT> data);
 	virtual void consume(std::shared_ptr<DataT> data) = 0;
@@ -27,10 +45,14 @@ private:
     PyProducerConsumer(const PyProducerConsumer& copy);
     PyProducerConsumer& operator = (const PyProducerConsumer& assign);
 
-	HANDLE m_queueMutex;
+    static const DWORD BLOCKED_RETRY_MS = 10;    // In case the consumer made room just before a producer started waiting
+
 	HANDLE m_dataAvailable;
+	HANDLE m_spaceAvailable;
 	HANDLE m_shutdown;
-	std::queue<std::shared_ptr<DataT> > m_queue;
+	BoundedQueue<std::shared_ptr<DataT> > m_queue;
+    QueueOverflow m_overflow;
+    volatile LONG m_blockedProducers;
 	DWORD m_dwThreadId;
 	HANDLE m_hConsumerThread;
 	bool m_consuming;
@@ -42,10 +64,13 @@ private:
 };
 
 template <typename DataT>
-PyProducerConsumer<DataT>::PyProducerConsumer() : 
-	m_queueMutex(CreateMutex(NULL, FALSE, NULL)),
-	m_dataAvailable(CreateEvent(NULL, TRUE, FALSE, NULL)),
+PyProducerConsumer<DataT>::PyProducerConsumer(long queueCapacity /* = DEFAULT_QUEUE_CAPACITY */, QueueOverflow overflow /* = QUEUE_DROP_NEWEST */) : 
+	m_dataAvailable(CreateEvent(NULL, FALSE, FALSE, NULL)),
+	m_spaceAvailable(CreateEvent(NULL, FALSE, FALSE, NULL)),
 	m_shutdown(CreateEvent(NULL, TRUE, FALSE, NULL)),
+	m_queue(queueCapacity),
+	m_overflow(overflow),
+	m_blockedProducers(0),
 	m_dwThreadId(NULL),
 	m_hConsumerThread(NULL),
 	m_consuming(false)
@@ -57,12 +82,12 @@ PyProducerConsumer<DataT>::~PyProducerConsumer()
 {
 	stopConsumer();
 	
-	CloseHandle(m_queueMutex);
-	m_queueMutex = NULL;
-
 	CloseHandle(m_dataAvailable);
 	m_dataAvailable = NULL;
 
+	CloseHandle(m_spaceAvailable);
+	m_spaceAvailable = NULL;
+
 	CloseHandle(m_shutdown);
 	m_shutdown = NULL;
 }
@@ -82,28 +107,44 @@ void PyProducerConsumer<DataT>::stopConsumer()
 template <typename DataT>
 bool PyProducerConsumer<DataT>::produce(std::shared_ptr<DataT> data)
 {
-	bool retVal = false;
-	DWORD mutexResult = WaitForSingleObject(m_queueMutex, INFINITE);
-
-	
-	if (mutexResult == WAIT_OBJECT_0)
+    bool blocked = false;
+    for (;;)
 	{
-		try
+        switch (m_queue.push(data, m_overflow))
 		{
-			m_queue.push(data);
-			retVal = true;
-		}
-		catch(...)
-		{
-			
-		}
+		case BoundedQueue<std::shared_ptr<DataT> >::PUSHED_TO_EMPTY:
+            SetEvent(m_dataAvailable);
+            return true;
 
-		ReleaseMutex(m_queueMutex);
+		case BoundedQueue<std::shared_ptr<DataT> >::PUSHED:
+            return true;
 
-		SetEvent(m_dataAvailable);
-	}
+		case BoundedQueue<std::shared_ptr<DataT> >::DROPPED:
+            return false;
 
-	return retVal;
+		default:   // QUEUE_FULL
+			{
+                if (!blocked)
+				{
+                    m_queue.countBlocked();
+                    blocked = true;
+				}
+                InterlockedIncrement(&m_blockedProducers);
+                HANDLE waitHandles[] = {m_spaceAvailable, m_shutdown};
+                DWORD waitResult;
+				{
+                    GILRelease release;
+                    waitResult = WaitForMultipleObjects(2, waitHandles, FALSE, BLOCKED_RETRY_MS);
+				}
+                InterlockedDecrement(&m_blockedProducers);
+                if (waitResult == WAIT_OBJECT_0 + 1)
+				{
+                    return false;
+				}
+			}
+            break;
+		}
+	}
 }
 
 template<typename DataT>
@@ -126,7 +167,6 @@ template<typename DataT>
 void PyProducerConsumer<DataT>::consumer()
 {
 	HANDLE waitHandles[] = {m_dataAvailable, m_shutdown};
-	bool queueEmpty;
 	for(;;)
 	{
 		
@@ -141,21 +181,22 @@ void PyProducerConsumer<DataT>::consumer()
 		}
 		m_consuming = true;
 
-		DWORD queueAvailable = WaitForSingleObject(m_queueMutex, INFINITE);
-
-		if (queueAvailable == WAIT_OBJECT_0)
+		// The event is only set by the produce() that finds the queue empty, so take everything that's there
+		bool consumed = false;
+		while (!m_queue.isEmpty())
 		{
-            DEBUG_TRACE(L"Popping Queue\n"); 
-			queueEmpty = false;
-			std::shared_ptr<DataT> data = m_queue.front();
-			m_queue.pop();
-			if (m_queue.empty())
+			std::shared_ptr<DataT> data;
+			if (!m_queue.pop(data))
 			{
-				queueEmpty = true;
-				ResetEvent(m_dataAvailable);
+				// A produce() has started but not finished storing its item
+				Sleep(0);
+				continue;
 			}
 
-			ReleaseMutex(m_queueMutex);
+			if (m_blockedProducers > 0)
+			{
+				SetEvent(m_spaceAvailable);
+			}
 
 			try {
                 DEBUG_TRACE(L"Consuming...\n");
@@ -163,22 +204,20 @@ void PyProducerConsumer<DataT>::consumer()
                 DEBUG_TRACE(L"End Consume\n");
 			}
             catch(...) {
-                queueEmpty = queueEmpty;
 			}
+			consumed = true;
 
-
-			if (queueEmpty)
+			if (WaitForSingleObject(m_shutdown, 0) == WAIT_OBJECT_0)
 			{
-                DEBUG_TRACE(L"Waiting for dataAvailable\n");
-				waitResult = WaitForSingleObject(m_dataAvailable, 0);
-                DEBUG_TRACE(L"dataAvailable signalled\n");
-				if (waitResult != WAIT_OBJECT_0)
-				{
-					m_consuming = false;
-					queueComplete();
-				}
+				return;
 			}
 		}
+
+		m_consuming = false;
+		if (consumed)
+		{
+			queueComplete();
+		}
 	}
 }
 
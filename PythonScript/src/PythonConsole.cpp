@@ -258,7 +258,11 @@ void PythonConsole::runStatement(const char *statement)
 		startConsumer();
 	}
 
-	produce(std::shared_ptr<std::string>(new std::string(statement)));
+	if (!produce(std::shared_ptr<std::string>(new std::string(statement))) && mp_consoleDlg)
+	{
+		const char *msg = "Too many statements are waiting to run, this one was ignored\n";
+		mp_consoleDlg->writeError(strlen(msg), msg);
+	}
 }
 
 void PythonConsole::queueComplete()
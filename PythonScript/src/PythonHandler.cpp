@@ -10,6 +10,7 @@
 #include "MenuManager.h"
 #include "WcharMbcsConverter.h"
 #include "GILManager.h"
+#include "SearchBudget.h"
 #include "ConfigFile.h"
 
 namespace NppPythonScript
@@ -228,7 +229,7 @@ void PythonHandler::runStartupScripts()
 
 }
 
-bool PythonHandler::runScript(const std::string& scriptFile, 
+RunScriptResult PythonHandler::runScript(const std::string& scriptFile, 
 							  bool synchronous /* = false */, 
 							  bool allowQueuing /* = false */,
 							  HANDLE completedEvent /* = NULL */,
@@ -237,17 +238,17 @@ bool PythonHandler::runScript(const std::string& scriptFile,
 	return runScript(scriptFile.c_str(), synchronous, allowQueuing, completedEvent, isStatement);
 }
 
-bool PythonHandler::runScript(const char *filename, 
+RunScriptResult PythonHandler::runScript(const char *filename, 
 							  bool synchronous /* = false */, 
 							  bool allowQueuing /* = false */,
 							  HANDLE completedEvent /* = NULL */,
 							  bool isStatement /* = false */)
 {
-	bool retVal;
+	RunScriptResult retVal;
 
 	if (!allowQueuing && consumerBusy())
 	{
-		retVal = false;
+		retVal = RUN_SCRIPT_BUSY;
 	}
 	else
 	{
@@ -261,7 +262,7 @@ bool PythonHandler::runScript(const char *filename,
 
 		if (!synchronous)
 		{
-			retVal = produce(args);
+			retVal = produce(args) ? RUN_SCRIPT_STARTED : RUN_SCRIPT_QUEUE_FULL;
 			if (!m_consumerStarted)
 			{
 				startConsumer();
@@ -270,7 +271,7 @@ bool PythonHandler::runScript(const char *filename,
 		else
 		{
 			runScriptWorker(args);
-			retVal = true;
+			retVal = RUN_SCRIPT_STARTED;
 		}
 	}
 	return retVal;
@@ -285,6 +286,9 @@ void PythonHandler::runScriptWorker(const std::shared_ptr<RunScriptArgs>& args)
 {
 
     GILLock gilLock;
+
+    // A "Stop script" for the last script doesn't stop the searches in this one
+    SearchBudget::clearCancel();
 	
 	if (args->m_isStatement)
 	{
@@ -305,6 +309,8 @@ void PythonHandler::runScriptWorker(const std::shared_ptr<RunScriptArgs>& args)
 			Py_DECREF(pyFile);			
 		}
 	}
+
+    SearchBudget::clearCancel();
 	
 	if (NULL != args->m_completedEvent)
 	{
@@ -350,9 +356,16 @@ void PythonHandler::stopScript()
 
 void PythonHandler::stopScriptWorker(PythonHandler *handler)
 {
+    // The KeyboardInterrupt is only noticed when the script gets back to Python, so a search or replace that is running
+    // (maybe still holding the GIL) is stopped straight away, and raises the KeyboardInterrupt itself
+    SearchBudget::cancelThread(handler->getExecutingThreadID());
+
     GILLock gilLock;
 	
-	PyThreadState_SetAsyncExc((long)handler->getExecutingThreadID(), PyExc_KeyboardInterrupt);
+    if (!SearchBudget::isCancelReported())
+	{
+        PyThreadState_SetAsyncExc((long)handler->getExecutingThreadID(), PyExc_KeyboardInterrupt);
+	}
 	
 }
 
@@ -44,6 +44,12 @@ private:
 	RunScriptArgs(); // default constructor disabled
 };
 
+enum RunScriptResult
+{
+	RUN_SCRIPT_STARTED,
+	RUN_SCRIPT_BUSY,          // Another script is running, and queuing wasn't allowed
+	RUN_SCRIPT_QUEUE_FULL     // Too many scripts are waiting to run, so this one was thrown away
+};
 
 
 class PythonHandler : public PyProducerConsumer<RunScriptArgs>
@@ -52,8 +58,8 @@ public:
 	PythonHandler::PythonHandler(TCHAR *pluginsDir, TCHAR *configDir, HINSTANCE hInst, HWND nppHandle, HWND scintilla1Handle, HWND scintilla2Handle, boost::shared_ptr<PythonConsole> pythonConsole);
 	~PythonHandler();
 
-	bool runScript(const char *filename, bool synchronous = false, bool allowQueuing = false, HANDLE completedEvent = NULL, bool isStatement = false);
-	bool runScript(const std::string& filename, bool synchronous = false, bool allowQueuing = false, HANDLE completedEvent = NULL, bool isStatement = false);
+	RunScriptResult runScript(const char *filename, bool synchronous = false, bool allowQueuing = false, HANDLE completedEvent = NULL, bool isStatement = false);
+	RunScriptResult runScript(const std::string& filename, bool synchronous = false, bool allowQueuing = false, HANDLE completedEvent = NULL, bool isStatement = false);
 	
 	void runScriptWorker(const std::shared_ptr<RunScriptArgs>& args);
 
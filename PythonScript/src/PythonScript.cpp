@@ -18,6 +18,7 @@
 #include "GILManager.h"
 #include "MainThread.h"
 #include "ScintillaCallbackCounter.h"
+#include "RegexComplexity.h"
 #include "MutexHolder.h"
 
 #define CHECK_INITIALISED()  if (!g_initialised) initialisePython()
@@ -64,6 +65,7 @@ static void stopScript();
 static void runScript(idx_t number);
 static void runScript(const char *script, bool synchronous, HANDLE completedEvent = NULL, bool allowQueuing = false);
 static void runStatement(const char *statement, bool synchronous, HANDLE completedEvent = NULL, bool allowQueuing = false);
+static void showRunScriptError(RunScriptResult result);
 static void shutdown(void *);
 static void doHelp();
 static void previousScript();
@@ -231,6 +233,12 @@ static void initialise()
 	menuManager->stopScriptEnabled(false);
 	menuManager->initPreviousScript();
 
+	// SETTING/REGEXSTEPLIMIT/<steps> in the startup config replaces RegexComplexity::DEFAULT_STEP_LIMIT for the regex engine
+	const long regexStepLimit = _ttol(ConfigFile::getInstance()->getSetting(_T("REGEXSTEPLIMIT")).c_str());
+	if (regexStepLimit > 0)
+	{
+		NppPythonScript::RegexComplexity::setStepLimit(regexStepLimit);
+	}
 	
 	
 }
@@ -499,11 +507,24 @@ static void runStatement(const char *statement, bool synchronous, HANDLE complet
 {
 	CHECK_INITIALISED();
 	MenuManager::getInstance()->stopScriptEnabled(true);
-	if (!pythonHandler->runScript(statement, synchronous, allowQueuing, completedEvent, true))
+	showRunScriptError(pythonHandler->runScript(statement, synchronous, allowQueuing, completedEvent, true));
+}
+
+static void showRunScriptError(RunScriptResult result)
+{
+	switch(result)
 	{
-		MessageBox(NULL, _T("Another script is currently running.  Running two scripts at the same time could produce unpredicable results, and is therefore disabled."), _T("Python Script"), 0);
-	}
+		case RUN_SCRIPT_BUSY:
+			MessageBox(NULL, _T("Another script is currently running.  Running two scripts at the same time could produce unpredicable results, and is therefore disabled."), _T("Python Script"), 0);
+			break;
 
+		case RUN_SCRIPT_QUEUE_FULL:
+			MessageBox(NULL, _T("Too many scripts are waiting to run, so this one was not run."), _T("Python Script"), 0);
+			break;
+
+		default:
+			break;
+	}
 }
 
 static void updatePreviousScript(const char *filename)
@@ -552,10 +573,7 @@ static void runScript(const char *filename, bool synchronous, HANDLE completedEv
 		// TODO: Really need to not change this if it's a MSGTOPLUGIN run
 		updatePreviousScript(filename);
 
-		if (!pythonHandler->runScript(filename, synchronous, allowQueuing, completedEvent))
-		{
-			MessageBox(NULL, _T("Another script is currently running.  Running two scripts at the same time could produce unpredicable results, and is therefore disabled."), _T("Python Script"), 0);
-		}
+		showRunScriptError(pythonHandler->runScript(filename, synchronous, allowQueuing, completedEvent));
 	}
 
 	MenuManager::s_menuItemClicked = false;
@@ -0,0 +1,191 @@
+#ifndef REGEXCACHE_20140412_H
+#define REGEXCACHE_20140412_H
+
+#include "ConstString.h"
+#include "UtfConversion.h"
+
+namespace NppPythonScript
+{
+    /** Snapshot of the counters of a RegexCache.
+     */
+    struct RegexCacheStats
+	{
+        RegexCacheStats()
+			: hits(0),
+              misses(0),
+              evictions(0),
+              size(0),
+              capacity(0)
+		{}
+
+        long hits;
+        long misses;
+        long evictions;
+        long size;
+        long capacity;
+	};
+
+    /** Bounded LRU cache of compiled regular expressions.
+     *  There is one cache per CharTraitsT, so the char traits type is implicitly part of the key.
+     *  The rest of the key is the pattern (as raw bytes) and the syntax flags used to compile it.
+     *
+     *  The compiled regex is handed out as a shared_ptr, so an entry that is evicted (or cleared) whilst
+     *  a search is still using it stays alive until that search completes.  boost::basic_regex objects are
+     *  immutable once constructed, so one compiled object can safely be used by several threads at once.
+     */
+    template <class CharTraitsT>
+    class RegexCache
+	{
+	public:
+        typedef typename CharTraitsT::regex_type regex_type;
+        typedef boost::shared_ptr<const regex_type> regex_ptr;
+
+        static const size_t DEFAULT_CAPACITY = 64;
+
+        static RegexCache& getInstance() { return s_instance; }
+
+        /** Returns the compiled regex for the given pattern and syntax flags, compiling (and caching) it if necessary.
+         *  Throws whatever the boost::regex constructor throws for an invalid pattern - invalid patterns are not cached.
+         */
+        regex_ptr get(const char *pattern, boost::regex_constants::syntax_option_type syntaxFlags);
+
+        void clear();
+        void setCapacity(size_t capacity);
+        RegexCacheStats getStats();
+
+	private:
+        RegexCache();
+        ~RegexCache();
+        RegexCache(const RegexCache&);             // copy constructor disabled
+        RegexCache& operator = (const RegexCache&); // assignment operator disabled
+
+        typedef std::pair<std::string, boost::regex_constants::syntax_option_type> key_type;
+        typedef std::pair<key_type, regex_ptr> entry_type;
+        typedef std::list<entry_type> lru_list_type;
+        typedef std::map<key_type, typename lru_list_type::iterator> index_type;
+
+        void evictToCapacity();
+
+        static RegexCache s_instance;
+
+        CRITICAL_SECTION m_lock;
+        lru_list_type m_entries;     // Most recently used at the front
+        index_type m_index;
+        size_t m_capacity;
+
+        long m_hits;
+        long m_misses;
+        long m_evictions;
+	};
+
+    template <class CharTraitsT>
+    RegexCache<CharTraitsT> RegexCache<CharTraitsT>::s_instance;
+
+    template <class CharTraitsT>
+    RegexCache<CharTraitsT>::RegexCache()
+		: m_capacity(DEFAULT_CAPACITY),
+          m_hits(0),
+          m_misses(0),
+          m_evictions(0)
+	{
+        ::InitializeCriticalSection(&m_lock);
+	}
+
+    template <class CharTraitsT>
+    RegexCache<CharTraitsT>::~RegexCache()
+	{
+        ::DeleteCriticalSection(&m_lock);
+	}
+
+    template <class CharTraitsT>
+    typename RegexCache<CharTraitsT>::regex_ptr RegexCache<CharTraitsT>::get(const char *pattern, boost::regex_constants::syntax_option_type syntaxFlags)
+	{
+        key_type key(std::string(pattern), syntaxFlags);
+
+        ::EnterCriticalSection(&m_lock);
+        typename index_type::iterator found = m_index.find(key);
+        if (found != m_index.end())
+		{
+            // Move to the front of the LRU list - splice doesn't invalidate the iterator held in the index
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            regex_ptr result = found->second->second;
+            ++m_hits;
+            ::LeaveCriticalSection(&m_lock);
+            return result;
+		}
+        ++m_misses;
+        ::LeaveCriticalSection(&m_lock);
+
+        // Compile outside of the lock, as this is the slow part.  If two threads compile the same pattern
+        // at the same time, the second one to finish simply replaces the first in the cache.
+        regex_ptr compiled(new regex_type(UtfConversion::toStringType<typename CharTraitsT::string_type>(ConstString<char>(pattern)), syntaxFlags));
+
+        ::EnterCriticalSection(&m_lock);
+        found = m_index.find(key);
+        if (found != m_index.end())
+		{
+            m_entries.erase(found->second);
+            m_index.erase(found);
+		}
+
+        if (m_capacity > 0)
+		{
+            m_entries.push_front(entry_type(key, compiled));
+            m_index[key] = m_entries.begin();
+            evictToCapacity();
+		}
+        ::LeaveCriticalSection(&m_lock);
+
+        return compiled;
+	}
+
+    // The lock must be held when calling this method
+    template <class CharTraitsT>
+    void RegexCache<CharTraitsT>::evictToCapacity()
+	{
+        while (m_entries.size() > m_capacity)
+		{
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+            ++m_evictions;
+		}
+	}
+
+    template <class CharTraitsT>
+    void RegexCache<CharTraitsT>::clear()
+	{
+        ::EnterCriticalSection(&m_lock);
+        m_index.clear();
+        m_entries.clear();
+        m_hits = 0;
+        m_misses = 0;
+        m_evictions = 0;
+        ::LeaveCriticalSection(&m_lock);
+	}
+
+    template <class CharTraitsT>
+    void RegexCache<CharTraitsT>::setCapacity(size_t capacity)
+	{
+        ::EnterCriticalSection(&m_lock);
+        m_capacity = capacity;
+        evictToCapacity();
+        ::LeaveCriticalSection(&m_lock);
+	}
+
+    template <class CharTraitsT>
+    RegexCacheStats RegexCache<CharTraitsT>::getStats()
+	{
+        RegexCacheStats stats;
+        ::EnterCriticalSection(&m_lock);
+        stats.hits = m_hits;
+        stats.misses = m_misses;
+        stats.evictions = m_evictions;
+        stats.size = static_cast<long>(m_entries.size());
+        stats.capacity = static_cast<long>(m_capacity);
+        ::LeaveCriticalSection(&m_lock);
+        return stats;
+	}
+
+}
+
+#endif // REGEXCACHE_20140412_H
@@ -0,0 +1,84 @@
+#include "stdafx.h"
+
+#include "RegexComplexity.h"
+
+namespace NppPythonScript
+{
+
+long regexStepLimit()
+{
+    return RegexComplexity::getStepLimit();
+}
+
+volatile LONG RegexComplexity::s_stepLimit = RegexComplexity::DEFAULT_STEP_LIMIT;
+volatile LONG RegexComplexity::s_slowestRun = 0;
+
+
+/** The rest of the RegexComplexityStats, which are only changed rarely (when a run is slower than any before, or gives up)
+ */
+class RegexComplexityRecord
+{
+public:
+    RegexComplexityRecord() { ::InitializeCriticalSection(&m_lock); }
+    ~RegexComplexityRecord() { ::DeleteCriticalSection(&m_lock); }
+
+    /** slowestRun is the copy that RegexComplexity::recordRun() checks without the lock, and is only changed with it
+     */
+    void slowRun(DWORD ticks, const char *pattern, volatile LONG *slowestRun)
+	{
+        ::EnterCriticalSection(&m_lock);
+        if (ticks > m_stats.slowestRun)
+		{
+            m_stats.slowestRun = ticks;
+            m_stats.slowestRunPattern = pattern;
+            ::InterlockedExchange(slowestRun, static_cast<LONG>(ticks));
+		}
+        ::LeaveCriticalSection(&m_lock);
+	}
+
+    void limitExceeded(const char *pattern)
+	{
+        ::EnterCriticalSection(&m_lock);
+        ++m_stats.limitExceeded;
+        m_stats.lastExceededPattern = pattern;
+        ::LeaveCriticalSection(&m_lock);
+	}
+
+    RegexComplexityStats get()
+	{
+        ::EnterCriticalSection(&m_lock);
+        RegexComplexityStats stats(m_stats);
+        ::LeaveCriticalSection(&m_lock);
+        return stats;
+	}
+
+private:
+    CRITICAL_SECTION m_lock;
+    RegexComplexityStats m_stats;
+};
+
+static RegexComplexityRecord s_record;
+
+
+void RegexComplexity::setStepLimit(long steps)
+{
+    ::InterlockedExchange(&s_stepLimit, steps);
+}
+
+void RegexComplexity::recordSlowRun(DWORD ticks, const char *pattern)
+{
+    s_record.slowRun(ticks, pattern, &s_slowestRun);
+}
+
+void RegexComplexity::limitExceeded(const char *pattern)
+{
+    s_record.limitExceeded(pattern);
+    throw RegexTooComplexException(pattern, getStepLimit());
+}
+
+RegexComplexityStats RegexComplexity::getStats()
+{
+    return s_record.get();
+}
+
+}
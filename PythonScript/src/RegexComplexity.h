@@ -0,0 +1,68 @@
+#ifndef REGEXCOMPLEXITY_20140511_H
+#define REGEXCOMPLEXITY_20140511_H
+
+#include "RegexTooComplexException.h"
+
+namespace NppPythonScript
+{
+    /** Totals of RegexComplexity::recordRun() and limitExceeded() since Notepad++ started
+     */
+    struct RegexComplexityStats
+	{
+        RegexComplexityStats()
+			: limitExceeded(0),
+              slowestRun(0)
+		{}
+
+        long limitExceeded;                // The number of runs of the regex engine that gave up at the step limit
+        std::string lastExceededPattern;
+        DWORD slowestRun;                  // The longest any one run of the regex engine took, in milliseconds
+        std::string slowestRunPattern;
+	};
+
+    /** The limit on how many steps one run of boost's regex engine can take before it gives up, so a pattern that backtracks 
+     *  catastrophically (e.g. (a+)+$ on a long line) fails with a RegexTooComplexException, rather than hanging Notepad++.
+     *
+     *  Boost only has a compile time limit (BOOST_REGEX_MAX_STATE_COUNT), which stdafx.h defines as regexStepLimit(), so that
+     *  it is read each time the engine starts.  The steps count from where a run starts looking for a match to where it finds
+     *  it (or gives up), so a run that has to look through a lot of text before its match also takes a lot of steps.
+     *
+     *  The slowest run (and its pattern) is kept as well, to find the scripts whose expressions are getting close to the limit.
+     */
+    class RegexComplexity
+	{
+	public:
+        /** Boost's own limit is 100000000, which lets (a+)+$ in a large document run for seconds before it gives up.  Boost's
+         *  engine takes roughly 20 to 70 million steps a second, so this gives up within about a second even on slow hardware.
+         *  The REGEXSTEPLIMIT setting in the startup config replaces it.
+         */
+        static const long DEFAULT_STEP_LIMIT = 10000000;
+
+        static void setStepLimit(long steps);
+        static long getStepLimit() { return s_stepLimit; }
+
+        /** Records how long one run of the regex engine for pattern took, for getStats().slowestRun
+         */
+        static void recordRun(DWORD ticks, const char *pattern)
+		{
+            if (ticks > static_cast<DWORD>(s_slowestRun))
+			{
+                recordSlowRun(ticks, pattern);
+			}
+		}
+
+        /** Counts a run of the regex engine for pattern that gave up at the limit, and throws the RegexTooComplexException for it
+         */
+        static void limitExceeded(const char *pattern);
+
+        static RegexComplexityStats getStats();
+
+	private:
+        static void recordSlowRun(DWORD ticks, const char *pattern);
+
+        static volatile LONG s_stepLimit;
+        static volatile LONG s_slowestRun;
+	};
+}
+
+#endif // REGEXCOMPLEXITY_20140511_H
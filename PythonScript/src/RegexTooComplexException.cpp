@@ -0,0 +1,15 @@
+#include "stdafx.h"
+
+#include "RegexTooComplexException.h"
+
+
+namespace NppPythonScript
+{
+
+
+void translateRegexTooComplexException(const RegexTooComplexException &e)
+{
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+}
+
+}
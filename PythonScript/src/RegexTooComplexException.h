@@ -0,0 +1,40 @@
+#ifndef REGEXTOOCOMPLEXEXCEPTION_20140511_H
+#define REGEXTOOCOMPLEXEXCEPTION_20140511_H
+
+namespace NppPythonScript
+{
+
+/** Thrown when a run of the regex engine took more steps than RegexComplexity::getStepLimit() (e.g. catastrophic backtracking 
+ *  with a pattern like (a+)+$), instead of boost's own error, which doesn't say which pattern it was
+ */
+class RegexTooComplexException
+{
+public:
+	RegexTooComplexException(const char *pattern, long stepLimit)
+		: m_pattern(pattern)
+		{
+            std::ostringstream desc;
+            desc << "matching the regular expression \"" << pattern << "\" took more than " << stepLimit 
+                 << " steps - make each choice in the expression unambiguous, or raise the limit with editor.setRegexStepLimit()";
+            m_desc = desc.str();
+		};
+
+	const char *what() const
+	{ return m_desc.c_str();
+	}
+
+	const std::string& pattern() const { return m_pattern; }
+
+private:
+	RegexTooComplexException(); // default constructor disabled
+
+	std::string m_pattern;
+	std::string m_desc;
+};
+
+
+void translateRegexTooComplexException(const RegexTooComplexException &e);
+
+}
+
+#endif // REGEXTOOCOMPLEXEXCEPTION_20140511_H
@@ -0,0 +1,96 @@
+#ifndef REPLACEMENTBATCH_20140419_H
+#define REPLACEMENTBATCH_20140419_H
+
+namespace NppPythonScript
+{
+
+/** One replacement in a ReplacementBatch.  The replacement text is held in the batch's arena.
+ */
+struct ReplacementRecord
+{
+    int start;      // Start of the match in the document
+    int end;        // End of the match in the document
+    int offset;     // Offset of the replacement text in the arena
+    int length;     // Length of the replacement text
+};
+
+/** The replacements found by the Replacer, in document order.
+ *  The records are held in one vector, and all the replacement texts in one growable byte arena, so building
+ *  a batch of n replacements only does O(log n) allocations, and running through the replacements is a linear
+ *  walk through memory.
+ *
+ *  Each replacement text is followed by a '\0' in the arena, so getReplacement() can also be used as a C string 
+ *  (as long as the replacement itself doesn't contain a '\0').
+ *  Pointers returned from getReplacement() are only valid until the next call to add(), appendText() or clear().
+ *
+ *  A replacement can also be built up in place with appendText(), and then recorded with commitReplacement(), 
+ *  which saves building it in a temporary buffer first.
+ */
+class ReplacementBatch
+{
+public:
+    typedef std::vector<ReplacementRecord>::const_iterator const_iterator;
+
+    ReplacementBatch()
+		: m_pendingOffset(0)
+	{}
+
+    void add(int start, int end, const char *replacement, int replacementLength)
+	{
+        appendText(replacement, replacementLength);
+        commitReplacement(start, end);
+	}
+
+    /** Appends text to the replacement that is being built up
+     */
+    void appendText(const char *text, int length)
+	{
+        m_arena.insert(m_arena.end(), text, text + length);
+	}
+
+    /** Records the text appended since the last replacement as the replacement for [start, end) of the document
+     */
+    void commitReplacement(int start, int end)
+	{
+        ReplacementRecord record;
+        record.start = start;
+        record.end = end;
+        record.offset = m_pendingOffset;
+        record.length = static_cast<int>(m_arena.size()) - m_pendingOffset;
+
+        m_arena.push_back('\0');
+        m_records.push_back(record);
+        m_pendingOffset = static_cast<int>(m_arena.size());
+	}
+
+    void clear()
+	{
+        m_records.clear();
+        m_arena.clear();
+        m_pendingOffset = 0;
+	}
+
+    size_t size() const { return m_records.size(); }
+    bool empty() const { return m_records.empty(); }
+
+    const_iterator begin() const { return m_records.begin(); }
+    const_iterator end() const { return m_records.end(); }
+
+    const ReplacementRecord& operator[](size_t index) const { return m_records[index]; }
+    const ReplacementRecord& front() const { return m_records.front(); }
+    const ReplacementRecord& back() const { return m_records.back(); }
+
+    const char *getReplacement(const ReplacementRecord& record) const { return &m_arena[record.offset]; }
+
+private:
+    ReplacementBatch(const ReplacementBatch&);               // copy constructor disabled
+    ReplacementBatch& operator = (const ReplacementBatch&);  // assignment operator disabled
+
+    std::vector<ReplacementRecord> m_records;
+    std::vector<char> m_arena;
+    int m_pendingOffset;   // Offset in the arena of the replacement being built up
+};
+
+}
+
+#endif // REPLACEMENTBATCH_20140419_H
@@ -2,26 +2,54 @@
 
 #include "ReplacementContainer.h"
 #include "ScintillaWrapper.h"
-#include "ReplaceEntry.h"
+#include "ReplacementBatch.h"
+#include "BulkReplacement.h"
 #include "Scintilla.h"
 
 namespace NppPythonScript
 {
 
+int ReplacementContainer::s_bulkThreshold = ReplacementContainer::DEFAULT_BULK_THRESHOLD;
+
 void ReplacementContainer::runReplacements()
 {
-    std::list<ReplaceEntry*>::iterator endIterator = m_replacements->end();
+    // Each SCI_REPLACETARGET moves the gap in Scintilla's buffer and adds an undo record, so for a lot of replacements 
+    // it is quicker to rebuild the whole span once.  For a few replacements in a large document, the span can be much
+    // larger than the text actually replaced, so it is quicker to replace them individually.
+    if (s_bulkThreshold > 0 && m_replacements->size() >= static_cast<size_t>(s_bulkThreshold))
+	{
+        runReplacementsBulk();
+	}
+    else
+	{
+        runReplacementsPerMatch();
+	}
+}
+
+void ReplacementContainer::runReplacementsPerMatch()
+{
+    ReplacementBatch::const_iterator endIterator = m_replacements->end();
     int offset = 0;
-    for(std::list<ReplaceEntry*>::iterator it = m_replacements->begin(); it != endIterator; ++it)
+    for(ReplacementBatch::const_iterator it = m_replacements->begin(); it != endIterator; ++it)
 	{
-        int start = (*it)->getStart();
-        int end = (*it)->getLength();
+        int start = it->start;
+        int end = it->end;
 
         m_scintillaWrapper->setTarget(offset + start, offset + end);
-        int replacementLength = m_scintillaWrapper->callScintilla(SCI_REPLACETARGET, (*it)->getReplacementLength(), reinterpret_cast<LPARAM>((*it)->getReplacement()));
+        int replacementLength = m_scintillaWrapper->callScintilla(SCI_REPLACETARGET, it->length, reinterpret_cast<LPARAM>(m_replacements->getReplacement(*it)));
         offset = offset + (replacementLength - (end - start));
 	}
 
 }
 
+void ReplacementContainer::runReplacementsBulk()
+{
+    // The replacements were found in the current document text, which hasn't changed since
+    const char *text = reinterpret_cast<const char *>(m_scintillaWrapper->callScintilla(SCI_GETCHARACTERPOINTER));
+    BulkReplacement bulkReplacement(text, *m_replacements);
+
+    m_scintillaWrapper->setTarget(bulkReplacement.spanStart(), bulkReplacement.spanEnd());
+    m_scintillaWrapper->callScintilla(SCI_REPLACETARGET, bulkReplacement.replacedLength(), reinterpret_cast<LPARAM>(bulkReplacement.replacedText()));
+}
+
 }
\ No newline at end of file
@@ -3,22 +3,36 @@
 
 namespace NppPythonScript
 {
-class ReplaceEntry;
+class ReplacementBatch;
 class ScintillaWrapper;
 
 class ReplacementContainer
 {
 public:
-    ReplacementContainer(std::list<ReplaceEntry*>* replacements, ScintillaWrapper* scintillaWrapper)
+    ReplacementContainer(ReplacementBatch* replacements, ScintillaWrapper* scintillaWrapper)
 		: m_replacements(replacements),
           m_scintillaWrapper(scintillaWrapper)
 	{}
 
     void runReplacements();
 
+    /** Replacement lists with at least this many entries are applied with a single replace of the whole span 
+     *  they cover (see BulkReplacement), shorter lists are applied one replacement at a time. 
+     *  Zero turns off the bulk mode.
+     */
+    static const int DEFAULT_BULK_THRESHOLD = 1000;
+
+    static void setBulkThreshold(int threshold) { s_bulkThreshold = threshold; }
+    static int getBulkThreshold() { return s_bulkThreshold; }
+
 private:
-    std::list<ReplaceEntry*> *m_replacements;
+    void runReplacementsPerMatch();
+    void runReplacementsBulk();
+
+    ReplacementBatch *m_replacements;
     ScintillaWrapper *m_scintillaWrapper;
+
+    static int s_bulkThreshold;
 };
 
 
@@ -0,0 +1,624 @@
+#include "stdafx.h"
+
+#include "ReplacementTemplate.h"
+#include "ReplacementBatch.h"
+#include "Match.h"
+
+namespace NppPythonScript
+{
+
+/** Thrown by the parser when the format uses something that can't be expanded from a template
+ */
+class UnsupportedFormat
+{
+};
+
+/** Builds the pieces of a ReplacementTemplate.  This follows boost's basic_regex_formatter (format_all, format_perl,
+ *  format_escape and format_conditional) step for step, so that every format is split up in the same way as boost would 
+ *  split it, including the odd cases (e.g. an unmatched ')' ends the format).
+ *  Where boost would stop writing the output (the branch of a conditional that isn't taken), the pieces are 
+ *  recorded as a branch of a PIECE_CONDITIONAL instead.
+ */
+class ReplacementTemplateParser
+{
+public:
+    ReplacementTemplateParser(const char *format, LiteralEncoding encoding, ReplacementTemplate& replacementTemplate)
+		: m_position(format),
+          m_end(format + strlen(format)),
+          m_encoding(encoding),
+          m_haveConditional(false),
+          m_template(replacementTemplate),
+          m_mergeFrom(0)
+	{}
+
+    void parse() { parseAll(); }
+
+private:
+    void parseAll();
+    void parseUntilScopeEnd();
+    void parseConditional();
+    void parsePerl();
+    bool parsePerlVerb(bool haveBrace);
+    void parseEscape();
+    int toi(const char *end, int radix);
+
+    void putChar(char c);
+    void putCharacter(int c);
+    void putPiece(ReplacementTemplate::PieceType type, int value);
+    void endBranch();
+
+    const char *limit(int length) const { return (m_end - m_position) < length ? m_end : m_position + length; }
+
+    const char *m_position;
+    const char *m_end;
+    LiteralEncoding m_encoding;
+    bool m_haveConditional;
+    ReplacementTemplate& m_template;
+    int m_mergeFrom;   // Literals can only be merged into a literal piece at or after this index
+};
+
+
+void ReplacementTemplateParser::parseAll()
+{
+    while (m_position != m_end)
+	{
+        switch (*m_position)
+		{
+            case '\\':
+                parseEscape();
+                break;
+
+            case '(':
+			{
+                ++m_position;
+                bool haveConditional = m_haveConditional;
+                m_haveConditional = false;
+                parseUntilScopeEnd();
+                m_haveConditional = haveConditional;
+                if (m_position == m_end)
+				{
+                    return;
+				}
+                ++m_position;  // skip the closing ')'
+                break;
+			}
+
+            case ')':
+                return;
+
+            case ':':
+                if (m_haveConditional)
+				{
+                    return;
+				}
+                putChar(*m_position++);
+                break;
+
+            case '?':
+                ++m_position;
+                parseConditional();
+                break;
+
+            case '$':
+                parsePerl();
+                break;
+
+            default:
+                putChar(*m_position++);
+                break;
+		}
+	}
+}
+
+void ReplacementTemplateParser::parseUntilScopeEnd()
+{
+    do
+	{
+        parseAll();
+        if (m_position == m_end || ')' == *m_position)
+		{
+            return;
+		}
+        putChar(*m_position++);
+	} while (m_position != m_end);
+}
+
+void ReplacementTemplateParser::parseConditional()
+{
+    if (m_position == m_end)
+	{
+        putChar('?');
+        return;
+	}
+
+    int groupNumber;
+    if ('{' == *m_position)
+	{
+        const char *base = m_position;
+        ++m_position;
+        groupNumber = toi(m_end, 10);
+        if (groupNumber < 0)
+		{
+            // ?{name} - whether this is a conditional at all depends on the names in the regex
+            throw UnsupportedFormat();
+		}
+        if (m_position == m_end || '}' != *m_position)
+		{
+            m_position = base;
+            putChar('?');
+            return;
+		}
+        ++m_position;
+	}
+    else
+	{
+        groupNumber = toi(limit(2), 10);
+	}
+
+    if (groupNumber < 0)
+	{
+        putChar('?');
+        return;
+	}
+
+    // Boost parses both branches whether the group matched or not (and just discards the output of one), so they 
+    // can both be recorded here
+    int conditional = static_cast<int>(m_template.m_pieces.size());
+    putPiece(ReplacementTemplate::PIECE_CONDITIONAL, groupNumber);
+
+    m_haveConditional = true;
+    parseAll();
+    m_haveConditional = false;
+
+    endBranch();
+    m_template.m_pieces[conditional].elseStart = static_cast<int>(m_template.m_pieces.size());
+    if (m_position != m_end && ':' == *m_position)
+	{
+        ++m_position;
+        parseUntilScopeEnd();
+	}
+
+    endBranch();
+    m_template.m_pieces[conditional].end = static_cast<int>(m_template.m_pieces.size());
+}
+
+void ReplacementTemplateParser::parsePerl()
+{
+    // On entry m_position points to the '$'
+    if (++m_position == m_end)
+	{
+        putChar('$');
+        return;
+	}
+
+    bool haveBrace = false;
+    const char *savePosition = m_position;
+    switch (*m_position)
+	{
+        case '&':
+            ++m_position;
+            putPiece(ReplacementTemplate::PIECE_GROUP, 0);
+            break;
+
+        case '`':
+        case '\'':
+            // The prefix and suffix aren't available from the Match
+            throw UnsupportedFormat();
+
+        case '$':
+            putChar(*m_position++);
+            break;
+
+        case '+':
+            if (++m_position != m_end && '{' == *m_position)
+			{
+                const char *base = ++m_position;
+                while (m_position != m_end && '}' != *m_position)
+				{
+                    ++m_position;
+				}
+                if (m_position != m_end)
+				{
+                    if (base == m_position)
+					{
+                        throw UnsupportedFormat();
+					}
+                    putPiece(ReplacementTemplate::PIECE_NAMED_GROUP, static_cast<int>(m_template.m_names.size()));
+                    m_template.m_names.push_back(std::string(base, m_position));
+                    ++m_position;
+                    break;
+				}
+                m_position = --base;
+			}
+            putPiece(ReplacementTemplate::PIECE_LAST_GROUP, 0);
+            break;
+
+        case '{':
+            haveBrace = true;
+            ++m_position;
+            // fall through
+
+        default:
+		{
+            int groupNumber = toi(m_end, 10);
+            if (groupNumber < 0 || (haveBrace && (m_position == m_end || '}' != *m_position)))
+			{
+                if (!parsePerlVerb(haveBrace))
+				{
+                    // Not a group reference, so the '$' is just a character
+                    m_position = --savePosition;
+                    putChar(*m_position++);
+				}
+                break;
+			}
+
+            putPiece(ReplacementTemplate::PIECE_GROUP, groupNumber);
+            if (haveBrace)
+			{
+                ++m_position;
+			}
+            break;
+		}
+	}
+}
+
+bool ReplacementTemplateParser::parsePerlVerb(bool haveBrace)
+{
+    enum VerbAction { VERB_MATCH, VERB_LAST_PAREN_MATCH, VERB_UNSUPPORTED };
+    static const struct { const char *name; VerbAction action; } verbs[] = {
+        { "MATCH",                VERB_MATCH },
+        { "PREMATCH",             VERB_UNSUPPORTED },
+        { "POSTMATCH",            VERB_UNSUPPORTED },
+        { "LAST_PAREN_MATCH",     VERB_LAST_PAREN_MATCH },
+        { "LAST_SUBMATCH_RESULT", VERB_UNSUPPORTED },
+        { "^N",                   VERB_UNSUPPORTED }
+	};
+
+    if (m_position == m_end)
+	{
+        return false;
+	}
+    if (haveBrace && '^' == *m_position)
+	{
+        ++m_position;
+	}
+
+    for (size_t i = 0; i < sizeof(verbs) / sizeof(verbs[0]); ++i)
+	{
+        int length = static_cast<int>(strlen(verbs[i].name));
+        if (m_end - m_position < length || 0 != memcmp(m_position, verbs[i].name, length))
+		{
+            continue;
+		}
+
+        m_position += length;
+        if (haveBrace)
+		{
+            if (m_position == m_end || '}' != *m_position)
+			{
+                return false;
+			}
+            ++m_position;
+		}
+
+        switch (verbs[i].action)
+		{
+            case VERB_MATCH:
+                putPiece(ReplacementTemplate::PIECE_GROUP, 0);
+                break;
+            case VERB_LAST_PAREN_MATCH:
+                putPiece(ReplacementTemplate::PIECE_LAST_GROUP, 0);
+                break;
+            default:
+                throw UnsupportedFormat();
+		}
+        return true;
+	}
+
+    return false;
+}
+
+void ReplacementTemplateParser::parseEscape()
+{
+    // skip the escape and check for trailing escape
+    if (++m_position == m_end)
+	{
+        putChar('\\');
+        return;
+	}
+
+    switch (*m_position)
+	{
+        case 'a': putChar('\a'); ++m_position; break;
+        case 'f': putChar('\f'); ++m_position; break;
+        case 'n': putChar('\n'); ++m_position; break;
+        case 'r': putChar('\r'); ++m_position; break;
+        case 't': putChar('\t'); ++m_position; break;
+        case 'v': putChar('\v'); ++m_position; break;
+        case 'e': putChar(27);   ++m_position; break;
+
+        case 'x':
+            if (++m_position == m_end)
+			{
+                putChar('x');
+                return;
+			}
+            if ('{' == *m_position)
+			{
+                ++m_position;
+                int value = toi(m_end, 16);
+                if (value < 0)
+				{
+                    putChar('x');
+                    putChar('{');
+                    return;
+				}
+                if (m_position == m_end || '}' != *m_position)
+				{
+                    // Not terminated, so the 'x' is just a character
+                    --m_position;
+                    while ('\\' != *m_position)
+					{
+                        --m_position;
+					}
+                    ++m_position;
+                    putChar(*m_position++);
+                    return;
+				}
+                ++m_position;
+                putCharacter(value);
+                return;
+			}
+            else
+			{
+                int value = toi(limit(2), 16);
+                if (value < 0)
+				{
+                    --m_position;
+                    putChar(*m_position++);
+                    return;
+				}
+                putCharacter(value);
+			}
+            break;
+
+        case 'c':
+            if (++m_position == m_end)
+			{
+                --m_position;
+                putChar(*m_position++);
+                return;
+			}
+            if (LITERAL_ENCODING_UTF8 == m_encoding && static_cast<unsigned char>(*m_position) >= 0x80)
+			{
+                throw UnsupportedFormat();
+			}
+            // The character type of the ANSI regex is a (signed) char, so this is what boost gives for bytes >= 0x80
+            putChar(static_cast<char>(static_cast<signed char>(*m_position++) % 32));
+            break;
+
+        case 'l':
+        case 'L':
+        case 'u':
+        case 'U':
+        case 'E':
+            // Case conversion changes the text of the groups, so they can't just be copied
+            throw UnsupportedFormat();
+
+        default:
+		{
+            // \N (a single digit) sed style group reference
+            int value = toi(limit(1), 10);
+            if (value > 0)
+			{
+                putPiece(ReplacementTemplate::PIECE_GROUP, value);
+                break;
+			}
+            else if (0 == value)
+			{
+                // octal escape sequence
+                --m_position;
+                value = toi(limit(4), 8);
+                putCharacter(value);
+                break;
+			}
+            putChar(*m_position++);
+            break;
+		}
+	}
+}
+
+/** Reads a number from m_position (advancing it), in the same way as boost's global_toi.  Returns -1 if there's no number.
+ */
+int ReplacementTemplateParser::toi(const char *end, int radix)
+{
+    int result = -1;
+    int digits = 0;
+    while (m_position != end)
+	{
+        char c = *m_position;
+        int value;
+        if (c >= '0' && c <= '9')
+            value = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            value = 10 + (c - 'a');
+        else if (c >= 'A' && c <= 'F')
+            value = 10 + (c - 'A');
+        else
+            break;
+
+        if (value >= radix)
+		{
+            break;
+		}
+
+        // Boost versions differ in how they handle overflow, so just don't go there
+        if (++digits > 6)
+		{
+            throw UnsupportedFormat();
+		}
+
+        result = (result < 0 ? 0 : result) * radix + value;
+        ++m_position;
+	}
+    return result;
+}
+
+void ReplacementTemplateParser::putChar(char c)
+{
+    std::vector<ReplacementTemplate::Piece>& pieces = m_template.m_pieces;
+    int last = static_cast<int>(pieces.size()) - 1;
+    if (last >= m_mergeFrom && ReplacementTemplate::PIECE_LITERAL == pieces[last].type)
+	{
+        ++pieces[last].length;
+	}
+    else
+	{
+        ReplacementTemplate::Piece piece;
+        piece.type = ReplacementTemplate::PIECE_LITERAL;
+        piece.value = static_cast<int>(m_template.m_literals.size());
+        piece.length = 1;
+        piece.elseStart = piece.end = 0;
+        pieces.push_back(piece);
+	}
+    m_template.m_literals.push_back(c);
+}
+
+/** Puts a character given by number (\x, octal), which is a code point for UTF-8, and a byte for ANSI
+ */
+void ReplacementTemplateParser::putCharacter(int c)
+{
+    if (LITERAL_ENCODING_ANSI == m_encoding || c < 0x80)
+	{
+        putChar(static_cast<char>(c));
+        return;
+	}
+
+    if (!UtfConversion::isValidCodepoint(c))
+	{
+        throw UnsupportedFormat();
+	}
+
+    U32 codePoint = c;
+    std::string encoded(UtfConversion::toUtf8(ConstString<U32>(&codePoint, 1)));
+    for (std::string::const_iterator it = encoded.begin(); it != encoded.end(); ++it)
+	{
+        putChar(*it);
+	}
+}
+
+void ReplacementTemplateParser::putPiece(ReplacementTemplate::PieceType type, int value)
+{
+    ReplacementTemplate::Piece piece;
+    piece.type = type;
+    piece.value = value;
+    piece.length = 0;
+    piece.elseStart = piece.end = 0;
+    m_template.m_pieces.push_back(piece);
+}
+
+/** The literal at the end of a branch mustn't be extended by the literal that starts the next branch
+ */
+void ReplacementTemplateParser::endBranch()
+{
+    m_mergeFrom = static_cast<int>(m_template.m_pieces.size());
+}
+
+
+ReplacementTemplate::ReplacementTemplate(const char *format, LiteralEncoding encoding)
+	: m_supported(true)
+{
+    if (LITERAL_ENCODING_UTF8 == encoding)
+	{
+        // Invalid UTF-8 doesn't survive boost's round trip through UTF-32 unchanged, so leave that to boost
+        UtfConversion::Utf8Decoder decoder(format, static_cast<unsigned int>(strlen(format)));
+        while (!decoder.isEnd())
+		{
+            if (UtfConversion::isInvalidUtf8(decoder.decodedChar()))
+			{
+                m_supported = false;
+                return;
+			}
+            decoder.advanceToNext();
+		}
+	}
+
+    try
+	{
+        ReplacementTemplateParser parser(format, encoding, *this);
+        parser.parse();
+	}
+    catch (UnsupportedFormat&)
+	{
+        m_supported = false;
+        m_pieces.clear();
+        m_literals.clear();
+        m_names.clear();
+	}
+}
+
+void ReplacementTemplate::expand(const char *text, Match *match, ReplacementBatch& replacements) const
+{
+    expandPieces(0, static_cast<int>(m_pieces.size()), text, match, replacements);
+}
+
+void ReplacementTemplate::expandPieces(int from, int to, const char *text, Match *match, ReplacementBatch& replacements) const
+{
+    for (int index = from; index < to; )
+	{
+        const Piece& piece = m_pieces[index];
+        switch (piece.type)
+		{
+            case PIECE_LITERAL:
+                replacements.appendText(m_literals.data() + piece.value, piece.length);
+                ++index;
+                break;
+
+            case PIECE_GROUP:
+                appendGroup(piece.value, text, match, replacements);
+                ++index;
+                break;
+
+            case PIECE_NAMED_GROUP:
+                // Looked up for every match, as with duplicate names it's the first group of that name that matched
+                appendGroup(match->groupIndexFromName(m_names[piece.value].c_str()), text, match, replacements);
+                ++index;
+                break;
+
+            case PIECE_LAST_GROUP:
+			{
+                int groupCount = match->groupCount();
+                appendGroup(groupCount > 1 ? groupCount - 1 : 1, text, match, replacements);
+                ++index;
+                break;
+			}
+
+            case PIECE_CONDITIONAL:
+			{
+                GroupDetail groupDetail;
+                if (match->group(piece.value, groupDetail) && groupDetail.matched())
+				{
+                    expandPieces(index + 1, piece.elseStart, text, match, replacements);
+				}
+                else
+				{
+                    expandPieces(piece.elseStart, piece.end, text, match, replacements);
+				}
+                index = piece.end;
+                break;
+			}
+		}
+	}
+}
+
+void ReplacementTemplate::appendGroup(int groupNumber, const char *text, Match *match, ReplacementBatch& replacements) const
+{
+    // Groups that don't exist or didn't match are empty
+    GroupDetail groupDetail;
+    if (match->group(groupNumber, groupDetail) && groupDetail.matched())
+	{
+        replacements.appendText(text + groupDetail.start(), groupDetail.end() - groupDetail.start());
+	}
+}
+
+}
@@ -0,0 +1,64 @@
+#ifndef REPLACEMENTTEMPLATE_20140421_H
+#define REPLACEMENTTEMPLATE_20140421_H
+
+#include "LiteralSearcher.h"
+
+namespace NppPythonScript
+{
+class Match;
+class ReplacementBatch;
+
+/** A replacement format (e.g. "x$1\\n(?2y:z)"), parsed once into literal byte runs and group references, 
+ *  so that each match can be expanded by copying byte ranges straight from the document, rather than converting 
+ *  the format and the result to and from UTF-32 and running boost's formatter for every match.
+ *
+ *  The format is parsed exactly as boost parses it with format_all.  The specifiers are all ASCII, so the parsing 
+ *  works on the bytes for both UTF-8 and ANSI.  A few things can't be expanded by copying (case conversion with \\l\\u\\L\\U, 
+ *  the prefix and suffix, named conditionals) - if the format uses any of these, isSupported() returns false, and the
+ *  caller must use Match::expand() instead.
+ */
+class ReplacementTemplate
+{
+public:
+    ReplacementTemplate(const char *format, LiteralEncoding encoding);
+
+    bool isSupported() const { return m_supported; }
+
+    /** Appends the replacement for match to the pending replacement of the batch (see ReplacementBatch::appendText())
+     *  text is the text the match was found in.
+     */
+    void expand(const char *text, Match *match, ReplacementBatch& replacements) const;
+
+    enum PieceType
+	{
+        PIECE_LITERAL,       // value is the offset of the text in m_literals
+        PIECE_GROUP,         // value is the group number
+        PIECE_NAMED_GROUP,   // value is the index of the name in m_names
+        PIECE_LAST_GROUP,    // $+, the highest numbered group
+        PIECE_CONDITIONAL    // value is the group number.  The pieces for when it matched follow this one, up to elseStart.
+	};
+
+    struct Piece
+	{
+        PieceType type;
+        int value;
+        int length;      // Literal only
+        int elseStart;   // Conditional only - index of the first piece for when the group didn't match
+        int end;         // Conditional only - index of the first piece after the conditional
+	};
+
+private:
+    friend class ReplacementTemplateParser;
+
+    void expandPieces(int from, int to, const char *text, Match *match, ReplacementBatch& replacements) const;
+    void appendGroup(int groupNumber, const char *text, Match *match, ReplacementBatch& replacements) const;
+
+    bool m_supported;
+    std::vector<Piece> m_pieces;
+    std::string m_literals;
+    std::vector<std::string> m_names;
+};
+
+}
+
+#endif // REPLACEMENTTEMPLATE_20140421_H
@@ -5,7 +5,7 @@
 
 
 #include "Replacer.h"
-#include "ReplaceEntry.h"
+#include "ReplacementBatch.h"
 #include "UTF8Iterator.h"
 #include "ConstString.h"
 #include "UtfConversion.h"
@@ -1,16 +1,24 @@
 #ifndef REPLACER_20140209_H
 #define REPLACER_20140209_H
-#include "ReplaceEntry.h"
+#include "ReplacementBatch.h"
 #include "Match.h"
 #include "UTF8Iterator.h"
 #include "ANSIIterator.h"
 #include "ConstString.h"
 #include "UtfConversion.h"
+#include "RegexCache.h"
+#include "LiteralSearcher.h"
+#include "MultiLiteralSearcher.h"
+#include "ReplacementTemplate.h"
+#include "RequiredLiteral.h"
+#include "SearchBudget.h"
+#include "RegexComplexity.h"
 
 namespace NppPythonScript 
 {
-    typedef ReplaceEntry* (*matchConverter)(const char *, Match *, void *state);
+    typedef void (*matchConverter)(const char *, Match *, void *state, ReplacementBatch& replacements);
     typedef bool (*searchResultHandler)(const char *, Match *, void *state);
+    typedef bool (*keywordResultHandler)(const char *, int keyword, Match *, void *state);
     
     using UtfConversion::toStringType;
 
@@ -22,64 +30,71 @@ namespace NppPythonScript
         python_re_flag_locale = 4,
         python_re_flag_multiline = 8,
         python_re_flag_dotall = 16,
+        python_re_flag_includelineendings = 0x10000,    // With python_re_flag_lines, each line's ending is part of the line
         python_re_flag_wholedoc = 0x10000000,    // This flag is the opposite of python_re_flag_multiline, which is the default
                                                  // Multiline is always true, except when this flag is specified
         // Internal flags
+        python_re_flag_lines = 0x20000000,       // Each line is searched on its own, as pyreplace() and pysearch() do
         python_re_flag_literal = 0x80000000
 	} python_re_flags;
 
 
-    
-template <class CharTraitsT>
-class BoostRegexGroupDetail : public GroupDetail
-{
-public:
-    BoostRegexGroupDetail(const boost::sub_match<typename CharTraitsT::text_iterator_type>& subMatch)
-		: m_subMatch(subMatch)
-	{}
-	int start() const { return  m_subMatch.first.pos(); }
-	int end() const { return m_subMatch.second.pos(); }
-	bool matched() const { return m_subMatch.matched; }
-
-private:
-    boost::sub_match<typename CharTraitsT::text_iterator_type> m_subMatch;
-};
+    /** Counters for one search (or replace), see Replacer::getStats()
+     */
+    struct SearchStats
+	{
+        SearchStats()
+			: prefilterUsed(false),
+              literalCandidates(0),
+              regexRuns(0),
+              matches(0),
+              parallelChunks(0),
+              stopReason(SEARCH_NOT_STOPPED),
+              stoppedAt(0),
+              slowestRegexRun(0)
+		{}
+
+        bool prefilterUsed;            // The regex engine was only run near the occurrences of prefilterLiteral
+        std::string prefilterLiteral;
+        long literalCandidates;        // The occurrences of prefilterLiteral that were looked at
+        long regexRuns;                // The number of times the regex engine was run
+        long matches;
+        long parallelChunks;           // The number of chunks searched on worker threads (see ParallelSearch), 0 if it wasn't split
+        SearchStopReason stopReason;   // Why the SearchBudget stopped the search part way through, if it did
+        int stoppedAt;                 // Where a stopped search had got to - every match before this was found
+        DWORD slowestRegexRun;         // The longest any one run of the regex engine took, in milliseconds
+	};
 
+template<class CharTraitsT>
+class RegexMatchFinder;
+    
 template<class CharTraitsT>
 class BoostRegexMatch : public Match
 {
 public:
     BoostRegexMatch(const char *text, boost::match_results<typename CharTraitsT::text_iterator_type>* match)
 		: m_text(text),
-          m_match(match)
+          m_match(match),
+          m_finder(NULL)
 	{}
 
     BoostRegexMatch(const char *text)
 		: m_text(text),
-          m_match(NULL)
+          m_match(NULL),
+          m_finder(NULL)
 	{}
 
-    virtual ~BoostRegexMatch();
-    BoostRegexMatch& operator= (BoostRegexMatch& rhs) {
-        m_text = rhs.m_text;
-        m_match = rhs.m_match;
-
-        /* We explicitely don't copy the list, as the allocatedGroupDetails will simply be destructed when this object gets destroyed.
-         * In theory, this would be bad, as we would delete the allocated GroupDetail objects when this object is deleted, 
-         * even though the various groups may still be in use.  
-         * In practice however, these GroupDetails don't actually live as long as this object, as we've created a ReplaceEntry 
-         * by the time this object gets destroyed, and have no need for the allocated GroupDetails any more.
-         */ 
-	}
-    
 	void setMatchResults(boost::match_results<typename CharTraitsT::text_iterator_type>* match) { m_match = match; }
 
+    // The finder the match results came from, so the prefix can be recovered if it is needed by expand()
+    void setFinder(RegexMatchFinder<CharTraitsT> *finder) { m_finder = finder; }
+
 	virtual int groupCount() { return m_match->size(); }
 
-    virtual GroupDetail* group(int groupNo);
-    virtual GroupDetail* groupName(const char *groupName);
+    virtual bool group(int groupNo, GroupDetail& groupDetail);
+    virtual bool groupName(const char *groupName, GroupDetail& groupDetail);
 
-    virtual std::string getTextForGroup(GroupDetail* group);
+    virtual std::string getTextForGroup(const GroupDetail& group);
 
     virtual void expand(const char* format, char **result, int *resultLength);
 
@@ -88,44 +103,28 @@ public:
 private: 
     const char *m_text;
     boost::match_results<typename CharTraitsT::text_iterator_type>* m_match;
-    std::list<BoostRegexGroupDetail<CharTraitsT>* > m_allocatedGroupDetails;
-
-    static void deleteEntry(BoostRegexGroupDetail<CharTraitsT>*);
+    RegexMatchFinder<CharTraitsT> *m_finder;
 };
 
 
-
-template <class CharTraitsT>
-void BoostRegexMatch<CharTraitsT>::deleteEntry(BoostRegexGroupDetail<CharTraitsT>* entry)
-{
-    delete entry;
-}
-
-template <class CharTraitsT>
-BoostRegexMatch<CharTraitsT>::~BoostRegexMatch() 
-{
-    for_each(m_allocatedGroupDetails.begin(), m_allocatedGroupDetails.end(), deleteEntry);
-}
-
 template <class CharTraitsT>
-GroupDetail* BoostRegexMatch<CharTraitsT>::group(int groupNo) 
+bool BoostRegexMatch<CharTraitsT>::group(int groupNo, GroupDetail& groupDetail) 
 {
     if (groupNo < 0 || groupNo >= static_cast<int>(m_match->size()))
 	{
-        return NULL;
+        return false;
 	}
 
-    BoostRegexGroupDetail<CharTraitsT>* groupDetail = new BoostRegexGroupDetail<CharTraitsT>((*m_match)[groupNo]);
-    m_allocatedGroupDetails.push_back(groupDetail);
-    return groupDetail;
+    // The positions are read straight from the match_results, so nothing is allocated
+    const boost::sub_match<typename CharTraitsT::text_iterator_type>& subMatch = (*m_match)[groupNo];
+    groupDetail = GroupDetail(subMatch.first.pos(), subMatch.second.pos(), subMatch.matched);
+    return true;
 }
 
 template <class CharTraitsT>
-GroupDetail* BoostRegexMatch<CharTraitsT>::groupName(const char *groupName) 
+bool BoostRegexMatch<CharTraitsT>::groupName(const char *groupName, GroupDetail& groupDetail) 
 {
-    CharTraitsT::string_type groupNameU32 = toStringType<CharTraitsT::string_type>(ConstString<char>(groupName));
-    int groupIndex = m_match->named_subexpression_index(groupNameU32.c_str(), groupNameU32.c_str() + groupNameU32.size());
-    return group(groupIndex);
+    return group(groupIndexFromName(groupName), groupDetail);
 }
 
 template <class CharTraitsT>
@@ -138,6 +137,18 @@ int BoostRegexMatch<CharTraitsT>::groupIndexFromName(const char *groupName)
 template <class CharTraitsT>
 void BoostRegexMatch<CharTraitsT>::expand(const char *format, char **result, int *resultLength)
 {
+    if (m_finder && m_finder->isPrefixShortened(*m_match) && (strstr(format, "$`") || strstr(format, "PREMATCH")))
+	{
+        // The prefix ($`) runs from the end of the previous match, so the results from a search that started
+        // later than that (see RegexMatchFinder) have to be found again, with a search from there
+        boost::match_results<typename CharTraitsT::text_iterator_type> fullResults;
+        m_finder->searchWithFullPrefix(fullResults);
+
+        BoostRegexMatch<CharTraitsT> match(m_text, &fullResults);
+        match.expand(format, result, resultLength);
+        return;
+	}
+
     CharTraitsT::string_type formatString = CharTraitsT::fromChars(format);
     CharTraitsT::string_type resultString = m_match->format(formatString, boost::regex_constants::format_all);
 
@@ -150,9 +161,9 @@ void BoostRegexMatch<CharTraitsT>::expand(const char *format, char **result, int
 }
 
 template <class CharTraitsT>
-typename std::string BoostRegexMatch<CharTraitsT>::getTextForGroup(GroupDetail* groupDetail)
+typename std::string BoostRegexMatch<CharTraitsT>::getTextForGroup(const GroupDetail& groupDetail)
 {
-    return std::string(m_text + groupDetail->start(), m_text + groupDetail->end());
+    return std::string(m_text + groupDetail.start(), m_text + groupDetail.end());
 }
 
     class Utf8CharTraits {
@@ -171,6 +182,21 @@ typename std::string BoostRegexMatch<CharTraitsT>::getTextForGroup(GroupDetail*
         static string_type fromChars(const char *source) {
             return string_type(UtfConversion::toUtf32(ConstString<U8>(source)));
 		}
+
+        /** A literal can be searched for byte by byte if it is valid UTF-8, as the bytes of each character
+         *  then determine its length, so a byte match is always a character match, starting and ending on character boundaries.
+         */
+        static bool isLiteralSearchable(const char *literal, int length) {
+            UtfConversion::Utf8Decoder decoder(literal, length);
+            while (!decoder.isEnd()) {
+                if (UtfConversion::isInvalidUtf8(decoder.decodedChar()))
+                    return false;
+                decoder.advanceToNext();
+			}
+            return true;
+		}
+
+        static const LiteralEncoding literalEncoding = LITERAL_ENCODING_UTF8;
 	};
 
     class AnsiCharTraits {
@@ -187,46 +213,539 @@ typename std::string BoostRegexMatch<CharTraitsT>::getTextForGroup(GroupDetail*
         static string_type fromChars(const char *source) {
             return string_type(source);
 		}
+
+        static bool isLiteralSearchable(const char * /* literal */, int /* length */) {
+            return true;
+		}
+
+        static const LiteralEncoding literalEncoding = LITERAL_ENCODING_ANSI;
 	};
 
+/** Returns true if the replacement format has anything that is expanded when formatting a match, 
+ *  false if the format is just copied as it is.
+ */
+inline bool formatHasSpecifiers(const char *format)
+{
+    // These are the characters that boost's format_all treats specially (':' is only special after a '?')
+    return NULL != strpbrk(format, "$\\()?");
+}
+
+/** Match found by the LiteralSearcher. There is only one group, the whole match.
+ */
+template <class CharTraitsT>
+class LiteralMatch : public Match
+{
+public:
+    LiteralMatch(const char *text, int textLength, const char *search, boost::regex_constants::syntax_option_type syntaxFlags)
+		: m_text(text),
+          m_textLength(textLength),
+          m_search(search),
+          m_syntaxFlags(syntaxFlags),
+          m_searchStart(0)
+	{}
+
+    // searchStart is where the search for this match started from, i.e. the end of the previous match
+    void setMatch(int searchStart, int start, int end) { m_searchStart = searchStart; m_group = GroupDetail(start, end, true); }
+
+	virtual int groupCount() { return 1; }
+    virtual bool group(int groupNo, GroupDetail& groupDetail)
+	{
+        if (0 != groupNo)
+		{
+            return false;
+		}
+        groupDetail = m_group;
+        return true;
+	}
+    virtual bool groupName(const char * /* groupName */, GroupDetail& /* groupDetail */) { return false; }
+    virtual std::string getTextForGroup(const GroupDetail& groupDetail) { return std::string(m_text + groupDetail.start(), m_text + groupDetail.end()); }
+    virtual void expand(const char* format, char **result, int *resultLength);
+    virtual int groupIndexFromName(const char * /* groupName */) { return -1; }
+
+private:
+    const char *m_text;
+    int m_textLength;
+    const char *m_search;
+    boost::regex_constants::syntax_option_type m_syntaxFlags;
+    int m_searchStart;
+    GroupDetail m_group;
+};
+
+template <class CharTraitsT>
+void LiteralMatch<CharTraitsT>::expand(const char *format, char **result, int *resultLength)
+{
+    if (!formatHasSpecifiers(format))
+	{
+        *resultLength = static_cast<int>(strlen(format));
+        *result = new char[(*resultLength) + 1];
+        memcpy(*result, format, (*resultLength) + 1);
+        return;
+	}
+
+    // The format has escapes or group references, so re-run the match with the regex engine (from where this search started, 
+    // so the prefix is the same), and let boost do the formatting exactly as it would have done for a regex match
+    typename RegexCache<CharTraitsT>::regex_ptr r = RegexCache<CharTraitsT>::getInstance().get(m_search, m_syntaxFlags);
+    typename CharTraitsT::text_iterator_type start(m_text, m_searchStart, m_textLength);
+    typename CharTraitsT::text_iterator_type end(m_text, m_textLength, m_textLength);
+    boost::match_results<typename CharTraitsT::text_iterator_type> results;
+    boost::regex_search(start, end, results, *r);
+
+    BoostRegexMatch<CharTraitsT> match(m_text, &results);
+    match.expand(format, result, resultLength);
+}
+
+/** Finds the matches of a regex one after the other, as boost's regex_iterator does.
+ *
+ *  If every match must contain a literal (see RequiredLiteral), the occurrences of the literal are found with a 
+ *  LiteralSearcher (or IgnoreCaseLiteralSearcher), and the regex engine is only run near them, rather than trying a match
+ *  at every position of the text:
+ *  - If the literal is a bounded number of characters into the match, the regex is tried (with match_continuous) 
+ *    at each position a match containing that occurrence could start from.
+ *  - Otherwise the regex engine searches from the end of the last match as usual, but only once the literal is known 
+ *    to be in the rest of the text, so a search with no (more) matches ends after a scan for the literal.
+ *
+ *  The regex is always run with the start of the search as the base, as regex_iterator does, so assertions 
+ *  (^, \b, look-behinds etc) see the same text either way.
+ */
+template <class CharTraitsT>
+class RegexMatchFinder
+{
+public:
+    typedef typename CharTraitsT::text_iterator_type text_iterator_type;
+    typedef boost::match_results<text_iterator_type> results_type;
+
+    // Literals further into the match than this (the difference between the offsets) aren't worth trying every position for
+    static const int MAX_CANDIDATES_PER_LITERAL = 16;
+
+    RegexMatchFinder(const char *text, int textLength, int startPosition, const char *search, python_re_flags flags, 
+                     const typename CharTraitsT::regex_type& regex, boost::regex_constants::match_flag_type matchFlags, SearchStats& stats);
+
+    /** Finds the next match, returns false if there are no more.
+     */
+    bool next(results_type& results);
+
+    /** True if the prefix of results (from next()) starts later than it would have done from a regex_iterator
+     */
+    bool isPrefixShortened(const results_type& results) const;
+
+    /** Finds the match last returned by next() again, with a search from the end of the previous match, so that the prefix is complete.
+     */
+    void searchWithFullPrefix(results_type& results) const;
+
+    /** Where searchWithFullPrefix() searches from, i.e. the end of the match before the one last returned by next()
+     */
+    int fullPrefixStart() const { return m_lastSearchFrom; }
+
+    /** Checks the budget for each run of the regex engine with a prefilter, as there can be lots of runs for each match.
+     *  Once the budget is used up, next() returns false.
+     */
+    void setBudget(SearchBudget *budget) { m_budget = budget; }
+
+private:
+    bool nextUnfiltered(results_type& results);
+    bool nextPrefiltered(results_type& results);
+    bool tryCandidates(int literalPosition, results_type& results);
+    bool runRegex(const text_iterator_type& from, results_type& results, boost::regex_constants::match_flag_type matchFlags);
+    void runFinished(DWORD startTicks);
+    void checkComplexity(const std::runtime_error& error) const;
+    void matchFound(const results_type& results);
+    int findLiteral(int from) const;
+
+    const char *m_text;
+    const int m_textLength;
+    const std::string m_search;   // Kept for the RegexComplexity telemetry and errors
+    const typename CharTraitsT::regex_type& m_regex;
+    const boost::regex_constants::match_flag_type m_matchFlags;
+    const text_iterator_type m_base;
+    const text_iterator_type m_end;
+    SearchStats& m_stats;
+    SearchBudget *m_budget;
+
+    // Without a prefilter
+    typename CharTraitsT::regex_iterator_type m_iterator;
+    bool m_iteratorStarted;
+
+    // With a prefilter
+    bool m_prefiltered;
+    boost::shared_ptr<LiteralSearcher> m_literalSearcher;
+    boost::shared_ptr<IgnoreCaseLiteralSearcher> m_ignoreCaseSearcher;
+    int m_minOffset;
+    int m_maxOffset;
+    int m_searchFrom;        // End of the last match
+    int m_lastSearchFrom;    // m_searchFrom for the last match found
+    int m_literalFrom;       // Where to look for the next occurrence of the literal
+    int m_nextCandidate;     // No match starts before here
+};
+
+template <class CharTraitsT>
+RegexMatchFinder<CharTraitsT>::RegexMatchFinder(const char *text, int textLength, int startPosition, const char *search, python_re_flags flags, 
+        const typename CharTraitsT::regex_type& regex, boost::regex_constants::match_flag_type matchFlags, SearchStats& stats)
+	: m_text(text),
+      m_textLength(textLength),
+      m_search(search),
+      m_regex(regex),
+      m_matchFlags(matchFlags),
+      m_base(text, startPosition, textLength),
+      m_end(text, textLength, textLength),
+      m_stats(stats),
+      m_budget(NULL),
+      m_iteratorStarted(false),
+      m_prefiltered(false),
+      m_minOffset(0),
+      m_maxOffset(0),
+      m_searchFrom(startPosition),
+      m_lastSearchFrom(startPosition),
+      m_literalFrom(startPosition),
+      m_nextCandidate(startPosition)
+{
+    if (flags & python_re_flag_literal)
+	{
+        return;
+	}
+
+    // A single character isn't much of a filter - the regex engine already skips to the characters a match can start with
+    RequiredLiteral required(search, CharTraitsT::literalEncoding);
+    if (!required.isFound() || required.literal().size() < 2)
+	{
+        return;
+	}
+
+    m_prefiltered = true;
+    m_minOffset = required.minOffset();
+    m_maxOffset = required.maxOffset();
+    if (RequiredLiteral::UNBOUNDED != m_maxOffset && m_maxOffset - m_minOffset >= MAX_CANDIDATES_PER_LITERAL)
+	{
+        m_maxOffset = RequiredLiteral::UNBOUNDED;
+	}
+
+    const int literalLength = static_cast<int>(required.literal().size());
+    if (flags & python_re_flag_ignorecase)
+	{
+        m_ignoreCaseSearcher.reset(new IgnoreCaseLiteralSearcher(required.literal().c_str(), literalLength, CharTraitsT::literalEncoding));
+	}
+    else
+	{
+        m_literalSearcher.reset(new LiteralSearcher(required.literal().c_str(), literalLength));
+	}
+
+    m_stats.prefilterUsed = true;
+    m_stats.prefilterLiteral = required.literal();
+}
+
+template <class CharTraitsT>
+bool RegexMatchFinder<CharTraitsT>::next(results_type& results)
+{
+    try
+	{
+        return m_prefiltered ? nextPrefiltered(results) : nextUnfiltered(results);
+	}
+    catch (const std::runtime_error& error)
+	{
+        checkComplexity(error);
+        throw;
+	}
+}
+
+template <class CharTraitsT>
+bool RegexMatchFinder<CharTraitsT>::nextUnfiltered(results_type& results)
+{
+    const DWORD startTicks = ::GetTickCount();
+    if (m_iteratorStarted)
+	{
+        ++m_iterator;
+	}
+    else
+	{
+        m_iterator = typename CharTraitsT::regex_iterator_type(m_base, m_end, m_regex, m_matchFlags);
+        m_iteratorStarted = true;
+	}
+    runFinished(startTicks);
+
+    if (m_iterator == typename CharTraitsT::regex_iterator_type())
+	{
+        return false;
+	}
+
+    ++m_stats.regexRuns;
+    results = *m_iterator;
+    return true;
+}
+
+template <class CharTraitsT>
+bool RegexMatchFinder<CharTraitsT>::nextPrefiltered(results_type& results)
+{
+    while (m_literalFrom < m_textLength)
+	{
+        if (m_budget && m_budget->isExhausted())
+		{
+            break;
+		}
+
+        int literalPosition = findLiteral(m_literalFrom);
+        if (-1 == literalPosition)
+		{
+            break;
+		}
+        ++m_stats.literalCandidates;
+
+        if (RequiredLiteral::UNBOUNDED == m_maxOffset)
+		{
+            // The match could start anywhere before the literal, so leave it to the regex engine to find
+            if (runRegex(text_iterator_type(m_text, m_searchFrom, m_textLength), results, m_matchFlags))
+			{
+                matchFound(results);
+                return true;
+			}
+            break;
+		}
+
+        m_literalFrom = literalPosition + 1;
+        if (tryCandidates(literalPosition, results))
+		{
+            return true;
+		}
+	}
+
+    m_literalFrom = m_textLength;
+    return false;
+}
+
+/** Tries a match at each position that is between m_minOffset and m_maxOffset characters before the literal (and not before m_nextCandidate)
+ */
+template <class CharTraitsT>
+bool RegexMatchFinder<CharTraitsT>::tryCandidates(int literalPosition, results_type& results)
+{
+    text_iterator_type candidate(m_text, literalPosition, m_textLength);
+    for (int offset = 0; offset < m_minOffset; ++offset)
+	{
+        if (candidate.pos() <= m_nextCandidate)
+		{
+            return false;
+		}
+        --candidate;
+	}
+
+    if (candidate.pos() < m_nextCandidate)
+	{
+        return false;
+	}
+
+    const int lastCandidate = candidate.pos();
+    for (int offset = m_minOffset; offset < m_maxOffset && candidate.pos() > m_nextCandidate; ++offset)
+	{
+        --candidate;
+	}
+
+    if (candidate.pos() < m_nextCandidate)
+	{
+        candidate = text_iterator_type(m_text, m_nextCandidate, m_textLength);
+	}
+
+    for (;;)
+	{
+        if (runRegex(candidate, results, m_matchFlags | boost::regex_constants::match_continuous))
+		{
+            matchFound(results);
+            return true;
+		}
+
+        ++candidate;
+        if (candidate.pos() > lastCandidate || (m_budget && m_budget->isExhausted()))
+		{
+            break;
+		}
+	}
+
+    m_nextCandidate = candidate.pos();
+    return false;
+}
+
+template <class CharTraitsT>
+bool RegexMatchFinder<CharTraitsT>::runRegex(const text_iterator_type& from, results_type& results, boost::regex_constants::match_flag_type matchFlags)
+{
+    ++m_stats.regexRuns;
+    const DWORD startTicks = ::GetTickCount();
+    const bool found = boost::regex_search(from, m_end, results, m_regex, matchFlags, m_base);
+    runFinished(startTicks);
+    return found;
+}
+
+/** Records how long a run of the regex engine took, for the search's stats and the RegexComplexity ones
+ */
+template <class CharTraitsT>
+void RegexMatchFinder<CharTraitsT>::runFinished(DWORD startTicks)
+{
+    const DWORD ticks = ::GetTickCount() - startTicks;
+    if (ticks > m_stats.slowestRegexRun)
+	{
+        m_stats.slowestRegexRun = ticks;
+        RegexComplexity::recordRun(ticks, m_search.c_str());
+	}
+}
+
+/** Boost gives up on a run that takes too many steps with a plain runtime_error, which is told apart from the others by its message
+ */
+template <class CharTraitsT>
+void RegexMatchFinder<CharTraitsT>::checkComplexity(const std::runtime_error& error) const
+{
+    if (m_regex.get_traits().error_string(boost::regex_constants::error_complexity) == error.what())
+	{
+        RegexComplexity::limitExceeded(m_search.c_str());
+	}
+}
+
+template <class CharTraitsT>
+void RegexMatchFinder<CharTraitsT>::matchFound(const results_type& results)
+{
+    // Matches always contain the literal, so can't be empty, and the next match can only start after this one
+    m_lastSearchFrom = m_searchFrom;
+    m_searchFrom = results[0].second.pos();
+    m_literalFrom = m_searchFrom;
+    m_nextCandidate = m_searchFrom;
+}
+
+template <class CharTraitsT>
+int RegexMatchFinder<CharTraitsT>::findLiteral(int from) const
+{
+    if (m_ignoreCaseSearcher)
+	{
+        int matchEnd;
+        return m_ignoreCaseSearcher->find(m_text, from, m_textLength, &matchEnd);
+	}
+    return m_literalSearcher->find(m_text, from, m_textLength);
+}
+
+template <class CharTraitsT>
+bool RegexMatchFinder<CharTraitsT>::isPrefixShortened(const results_type& results) const
+{
+    return m_prefiltered && results.prefix().first.pos() != m_lastSearchFrom;
+}
+
+template <class CharTraitsT>
+void RegexMatchFinder<CharTraitsT>::searchWithFullPrefix(results_type& results) const
+{
+    try
+	{
+        boost::regex_search(text_iterator_type(m_text, m_lastSearchFrom, m_textLength), m_end, results, m_regex, m_matchFlags, m_base);
+	}
+    catch (const std::runtime_error& error)
+	{
+        checkComplexity(error);
+        throw;
+	}
+}
+
     template <class CharTraitsT>
 	class Replacer {
 
 	public:
 		Replacer()
+			: m_replaceFormat(NULL),
+              m_replaceTemplate(NULL)
 		{ }
 
 
-        bool startReplace(const char *text, const int textLength, int maxCount, const int startPosition, const char *search, matchConverter converter, void *converterState, python_re_flags flags, std::list<ReplaceEntry*>& replacements);
-        bool startReplace(const char *text, const int textLength, int maxCount, const int startPosition, const char *search, const char *replace, python_re_flags flags, std::list<ReplaceEntry*>& replacements);
-
+        /** Finds the matches in [startPosition, textLength) of text, and adds a replacement for each one to replacements.
+         *
+         *  With python_re_flag_lines, each line is searched as if it were the whole text, so no match runs over a line
+         *  ending, and ^, $, \\A etc match at the start and end of each line.  The lines start at startPosition and after each 
+         *  line ending (\\r\\n, \\r or \\n), and end before their line ending - or after it, with python_re_flag_includelineendings.
+         *  maxCount counts the matches on all the lines.  The empty line after a line ending at textLength is searched, unless
+         *  the line endings are included (so a range of whole lines can be given).
+         */
+        bool startReplace(const char *text, const int textLength, int maxCount, const int startPosition, const char *search, matchConverter converter, void *converterState, python_re_flags flags, ReplacementBatch& replacements);
+        bool startReplace(const char *text, const int textLength, int maxCount, const int startPosition, const char *search, const char *replace, python_re_flags flags, ReplacementBatch& replacements);
+
+        /** Calls resultHandler for each match in [startPosition, textLength) of text, until it returns false.
+         *  python_re_flag_lines searches each line on its own, as for startReplace().
+         */
         void search(const char *text, const int textLength, const int startPosition, int maxCount, const char *search, searchResultHandler resultHandler, void *resultHandlerState, python_re_flags flags);
 
-	private:
-        static ReplaceEntry* matchToReplaceEntry(const char *text, Match *match, void *state);
+        /** Returns the number of matches, with the same engines as search(), but without handing the matches to anything
+         */
+        long count(const char *text, const int textLength, const int startPosition, const char *search, python_re_flags flags);
+
+        /** Finds all the occurrences of all the keywords in one pass (see MultiLiteralSearcher), and calls resultHandler with the
+         *  index of the keyword and the match for each one, until it returns false.  Each match is the same as a plain search() for
+         *  that keyword would have given.  Only python_re_flag_ignorecase has an effect in flags.
+         */
+        void searchMany(const char *text, const int textLength, const int startPosition, const std::vector<std::string>& keywords, keywordResultHandler resultHandler, void *resultHandlerState, python_re_flags flags);
+
+        /** Replaces the occurrences of all the keywords in one pass, choosing leftmost-longest where they overlap 
+         *  (see MultiLiteralSearcher::findLeftmostLongest).  replacements[i] is the text for keyword i, and is used as it is 
+         *  (it's not a format).  Only python_re_flag_ignorecase has an effect in flags.
+         */
+        void startReplaceMany(const char *text, const int textLength, const int startPosition, const std::vector<std::string>& keywords, 
+                              const std::vector<std::string>& replacements, python_re_flags flags, ReplacementBatch& batch);
+
+        /** The counters for the last search() or startReplace()
+         */
+        const SearchStats& getStats() const { return m_stats; }
 
-        boost::regex_constants::match_flag_type getMatchFlags(python_re_flags flags);
-        boost::regex_constants::syntax_option_type getSyntaxFlags(python_re_flags flags); 
+        /** The budget starts when the Replacer is created, and covers everything it does.  A copy of another budget can be
+         *  given instead, e.g. so that the chunks of a ParallelSearch share the budget of the whole search.
+         */
+        void setBudget(const SearchBudget& budget) { m_budget = budget; }
+
+        static boost::regex_constants::match_flag_type getMatchFlags(python_re_flags flags);
+        static boost::regex_constants::syntax_option_type getSyntaxFlags(python_re_flags flags); 
+
+	private:
+        static void matchToReplacement(const char *text, Match *match, void *state, ReplacementBatch& replacements);
+        static bool ignoreMatch(const char * /* text */, Match * /* match */, void * /* state */) { return true; }
+
+        struct SearchManyState;
+        static bool keywordFound(int keyword, int start, int end, void *state);
+        struct ReplaceManyState;
+        static bool keywordToReplacement(int keyword, int start, int end, void *state);
+
+        void recordBudget(int searchedTo);
+        void addLineStats(SearchStats& total) const;
+        static int lineContentEnd(const char *text, int lineStart, int textLength);
+        static int nextLineStart(const char *text, int contentEnd, int textLength);
+        static bool isLastLine(int contentEnd, int nextStart, int textLength, python_re_flags flags);
+        void startReplaceLines(const char *text, const int textLength, const int startPosition, int maxCount, const char *search, matchConverter converter, void *converterState, python_re_flags flags, ReplacementBatch& replacements);
+        void searchLines(const char *text, const int textLength, const int startPosition, int maxCount, const char *search, searchResultHandler resultHandler, void *resultHandlerState, python_re_flags flags);
+        struct LineState;
+        static int lineRangeEnd(int contentEnd, int nextStart, python_re_flags flags, LineState& state);
+        static bool isStartOfNextLine(LineState& state, Match *match);
+        static void lineMatchToReplacement(const char *text, Match *match, void *state, ReplacementBatch& replacements);
+        static bool lineMatchFound(const char *text, Match *match, void *state);
+        bool useLiteralSearch(const char *search, python_re_flags flags);
+        template <class SearcherT>
+        void startReplaceLiteral(const SearcherT& searcher, const char *text, const int textLength, const int startPosition, int maxCount, const char *search, matchConverter converter, void *converterState, python_re_flags flags, ReplacementBatch& replacements);
+        template <class SearcherT>
+        void searchLiteral(const SearcherT& searcher, const char *text, const int textLength, const int startPosition, int maxCount, const char *search, searchResultHandler resultHandler, void *resultHandlerState, python_re_flags flags);
 
         const char *m_replaceFormat;
+        const ReplacementTemplate *m_replaceTemplate;   // m_replaceFormat parsed, valid for the duration of startReplace()
+        SearchStats m_stats;
+        SearchBudget m_budget;
 	};
 
     
 
 template<class CharTraitsT>
-ReplaceEntry* Replacer<CharTraitsT>::matchToReplaceEntry(const char * /* text */, Match *match, void *state)
+void Replacer<CharTraitsT>::matchToReplacement(const char *text, Match *match, void *state, ReplacementBatch& replacements)
 {
-    // TODO: state is replacer instance, and contains the replacement string
-	// need to add format call in here, 
+    // state is the replacer instance, which contains the replacement format
     Replacer *replacer = reinterpret_cast<Replacer*>(state);
+    GroupDetail fullMatch;
+    match->group(0, fullMatch);
+
+    if (replacer->m_replaceTemplate->isSupported())
+	{
+        replacer->m_replaceTemplate->expand(text, match, replacements);
+        replacements.commitReplacement(fullMatch.start(), fullMatch.end());
+        return;
+	}
+
     char *replacement;
     int replacementLength;
 	match->expand(replacer->m_replaceFormat, &replacement, &replacementLength);
 
-    GroupDetail *fullMatch = match->group(0);
-    ReplaceEntry* replaceEntry = new ReplaceEntry(fullMatch->start(), fullMatch->end(), replacement, replacementLength);
+    replacements.add(fullMatch.start(), fullMatch.end(), replacement, replacementLength);
     delete [] replacement;
-    return replaceEntry;
 }
 
 template<class CharTraitsT>
@@ -235,10 +754,13 @@ bool Replacer<CharTraitsT>::startReplace(const char *text, const int textLength,
 	const char *search,
     const char *replace, 
     python_re_flags flags,
-    std::list<ReplaceEntry*>& replacements)
+    ReplacementBatch& replacements)
 {
+    // The format is parsed once here, rather than for every match
+    ReplacementTemplate replaceTemplate(replace, CharTraitsT::literalEncoding);
     m_replaceFormat = replace;
-    return startReplace(text, textLength, startPosition, maxCount, search, matchToReplaceEntry, this, flags, replacements);
+    m_replaceTemplate = &replaceTemplate;
+    return startReplace(text, textLength, startPosition, maxCount, search, matchToReplacement, this, flags, replacements);
 }
 
 template<class CharTraitsT>
@@ -283,6 +805,17 @@ boost::regex_constants::syntax_option_type Replacer<CharTraitsT>::getSyntaxFlags
     return resultBoostFlags;
 }
 
+/** Plain (literal) searches don't need the regex engine, unless the literal can't be matched byte for byte in this encoding.
+ *  With ignorecase, the IgnoreCaseLiteralSearcher is used instead of the LiteralSearcher.
+ */
+template<class CharTraitsT>
+bool Replacer<CharTraitsT>::useLiteralSearch(const char *search, python_re_flags flags)
+{
+    return (flags & python_re_flag_literal)
+        && '\0' != search[0]
+        && CharTraitsT::isLiteralSearchable(search, static_cast<int>(strlen(search)));
+}
+
 template<class CharTraitsT>
 bool Replacer<CharTraitsT>::startReplace(const char *text, const int textLength, 
 	const int startPosition, 
@@ -291,17 +824,40 @@ bool Replacer<CharTraitsT>::startReplace(const char *text, const int textLength,
 	matchConverter converter,
     void *converterState,
     python_re_flags flags,
-	std::list<ReplaceEntry*> &replacements) 
+	ReplacementBatch &replacements) 
 {
+    if (flags & python_re_flag_lines)
+	{
+        startReplaceLines(text, textLength, startPosition, maxCount, search, converter, converterState, flags, replacements);
+        return false;
+	}
+
+    m_stats = SearchStats();
+
+    if (useLiteralSearch(search, flags))
+	{
+        int searchLength = static_cast<int>(strlen(search));
+        if (flags & python_re_flag_ignorecase)
+		{
+            startReplaceLiteral(IgnoreCaseLiteralSearcher(search, searchLength, CharTraitsT::literalEncoding), text, textLength, startPosition, maxCount, search, converter, converterState, flags, replacements);
+		}
+        else
+		{
+            startReplaceLiteral(LiteralSearcher(search, searchLength), text, textLength, startPosition, maxCount, search, converter, converterState, flags, replacements);
+		}
+        return false;
+	}
 
     boost::regex_constants::syntax_option_type syntax_flags = getSyntaxFlags(flags);
 
-    CharTraitsT::regex_type r = CharTraitsT::regex_type(toStringType<CharTraitsT::string_type>(ConstString<char>(search)), syntax_flags);
+    typename RegexCache<CharTraitsT>::regex_ptr compiledRegex = RegexCache<CharTraitsT>::getInstance().get(search, syntax_flags);
+    const typename CharTraitsT::regex_type& r = *compiledRegex;
 
-    CharTraitsT::text_iterator_type start(text, startPosition, textLength);
-    CharTraitsT::text_iterator_type end(text, textLength, textLength);
-    CharTraitsT::regex_iterator_type iteratorEnd;
-    BoostRegexMatch<CharTraitsT> match(text);
+    RegexMatchFinder<CharTraitsT> finder(text, textLength, startPosition, search, flags, r, getMatchFlags(flags), m_stats);
+    finder.setBudget(&m_budget);
+    boost::match_results<CharTraitsT::text_iterator_type> boost_match_results;
+    BoostRegexMatch<CharTraitsT> match(text, &boost_match_results);
+    match.setFinder(&finder);
 
     bool checkCountOfReplaces = false;
     if (maxCount > 0) 
@@ -310,20 +866,19 @@ bool Replacer<CharTraitsT>::startReplace(const char *text, const int textLength,
 	}
 
 
-
-    for(CharTraitsT::regex_iterator_type it(start, end, r, getMatchFlags(flags)); it != iteratorEnd; ++it) 
+    int searchedTo = startPosition;
+    while (finder.next(boost_match_results)) 
 	{
-        boost::match_results<CharTraitsT::text_iterator_type> boost_match_results(*it);
-
-        match.setMatchResults(&boost_match_results); 
-        ReplaceEntry* entry = converter(text, &match, converterState);
-        replacements.push_back(entry);
-        if (checkCountOfReplaces && 0 == --maxCount) 
+        ++m_stats.matches;
+        searchedTo = boost_match_results[0].second.pos();
+        converter(text, &match, converterState, replacements);
+        if ((checkCountOfReplaces && 0 == --maxCount) || m_budget.isExhausted()) 
 		{
             break;
 		}
 	}
 
+    recordBudget(searchedTo);
     return false;
 }
 
@@ -337,15 +892,419 @@ void Replacer<CharTraitsT>::search(const char *text, const int textLength,
     void *resultHandlerState,
     python_re_flags flags) 
 {
+    if (flags & python_re_flag_lines)
+	{
+        searchLines(text, textLength, startPosition, maxCount, search, resultHandler, resultHandlerState, flags);
+        return;
+	}
+
+    m_stats = SearchStats();
+
+    if (useLiteralSearch(search, flags))
+	{
+        int searchLength = static_cast<int>(strlen(search));
+        if (flags & python_re_flag_ignorecase)
+		{
+            searchLiteral(IgnoreCaseLiteralSearcher(search, searchLength, CharTraitsT::literalEncoding), text, textLength, startPosition, maxCount, search, resultHandler, resultHandlerState, flags);
+		}
+        else
+		{
+            searchLiteral(LiteralSearcher(search, searchLength), text, textLength, startPosition, maxCount, search, resultHandler, resultHandlerState, flags);
+		}
+        return;
+	}
 
     boost::regex_constants::syntax_option_type syntax_flags = getSyntaxFlags(flags);
 
-    CharTraitsT::regex_type r = CharTraitsT::regex_type(toStringType<CharTraitsT::string_type>(ConstString<char>(search)), syntax_flags);
+    typename RegexCache<CharTraitsT>::regex_ptr compiledRegex = RegexCache<CharTraitsT>::getInstance().get(search, syntax_flags);
+    const typename CharTraitsT::regex_type& r = *compiledRegex;
+
+    RegexMatchFinder<CharTraitsT> finder(text, textLength, startPosition, search, flags, r, getMatchFlags(flags), m_stats);
+    finder.setBudget(&m_budget);
+    boost::match_results<CharTraitsT::text_iterator_type> boost_match_results;
+    BoostRegexMatch<CharTraitsT> match(text, &boost_match_results);
+    match.setFinder(&finder);
 
-    CharTraitsT::text_iterator_type start(text, startPosition, textLength);
-    CharTraitsT::text_iterator_type end(text, textLength, textLength);
-    CharTraitsT::regex_iterator_type iteratorEnd;
-    BoostRegexMatch<CharTraitsT> match(text);
+    bool checkCountOfSearches = false;
+    if (maxCount > 0) 
+	{
+        checkCountOfSearches = true;
+	}
+
+    int searchedTo = startPosition;
+    while (finder.next(boost_match_results)) 
+	{
+        ++m_stats.matches;
+        searchedTo = boost_match_results[0].second.pos();
+        bool shouldContinue = resultHandler(text, &match, resultHandlerState);
+        if (!shouldContinue || (checkCountOfSearches && 0 == --maxCount) || m_budget.isExhausted()) 
+		{
+            break;
+		}
+	}
+
+    recordBudget(searchedTo);
+}
+
+/** Called when a search loop finishes, to record whether it was the budget that stopped it
+ */
+template<class CharTraitsT>
+void Replacer<CharTraitsT>::recordBudget(int searchedTo)
+{
+    m_stats.stopReason = m_budget.stopReason();
+    if (SEARCH_NOT_STOPPED != m_stats.stopReason)
+	{
+        m_stats.stoppedAt = searchedTo;
+	}
+}
+
+/** Returns the end of the line starting at lineStart, before its line ending
+ */
+template<class CharTraitsT>
+int Replacer<CharTraitsT>::lineContentEnd(const char *text, int lineStart, int textLength)
+{
+    int position = lineStart;
+    while (position < textLength && '\r' != text[position] && '\n' != text[position])
+	{
+        ++position;
+	}
+    return position;
+}
+
+/** Returns the start of the line after the one whose line ending starts at contentEnd
+ */
+template<class CharTraitsT>
+int Replacer<CharTraitsT>::nextLineStart(const char *text, int contentEnd, int textLength)
+{
+    if (contentEnd < textLength && '\r' == text[contentEnd])
+	{
+        ++contentEnd;
+	}
+    if (contentEnd < textLength && '\n' == text[contentEnd])
+	{
+        ++contentEnd;
+	}
+    return contentEnd;
+}
+
+template<class CharTraitsT>
+bool Replacer<CharTraitsT>::isLastLine(int contentEnd, int nextStart, int textLength, python_re_flags flags)
+{
+    return contentEnd == textLength
+        || (nextStart == textLength && (flags & python_re_flag_includelineendings));
+}
+
+/** Adds the counters of the line just searched (in m_stats) to the ones for all the lines
+ */
+template<class CharTraitsT>
+void Replacer<CharTraitsT>::addLineStats(SearchStats& total) const
+{
+    total.prefilterUsed = m_stats.prefilterUsed;
+    total.prefilterLiteral = m_stats.prefilterLiteral;
+    total.literalCandidates += m_stats.literalCandidates;
+    total.regexRuns += m_stats.regexRuns;
+    total.matches += m_stats.matches;
+    total.slowestRegexRun = (std::max)(total.slowestRegexRun, m_stats.slowestRegexRun);
+    total.stopReason = m_stats.stopReason;
+    total.stoppedAt = m_stats.stoppedAt;
+}
+
+/** Passed through startReplace() or search() for each line, to lineMatchToReplacement() or lineMatchFound()
+ */
+template<class CharTraitsT>
+struct Replacer<CharTraitsT>::LineState
+{
+    Replacer *replacer;
+    matchConverter converter;
+    void *converterState;
+    searchResultHandler resultHandler;
+    void *resultHandlerState;
+    int nextLineStart;               // Where the next line starts, if this line includes its line ending, or -1
+    bool stopped;                    // The handler returned false
+};
+
+/** Runs startReplace() on each line in turn, with the line as the whole text.  The matches all go into the one batch.
+ */
+template<class CharTraitsT>
+void Replacer<CharTraitsT>::startReplaceLines(const char *text, const int textLength, const int startPosition, int maxCount, const char *search, 
+    matchConverter converter, void *converterState, python_re_flags flags, ReplacementBatch& replacements)
+{
+    const python_re_flags lineFlags = static_cast<python_re_flags>(flags & ~(python_re_flag_lines | python_re_flag_includelineendings));
+    SearchStats total;
+
+    LineState state;
+    state.replacer = this;
+    state.converter = converter;
+    state.converterState = converterState;
+    state.stopped = false;
+
+    int lineStart = startPosition;
+    for (;;)
+	{
+        const int contentEnd = lineContentEnd(text, lineStart, textLength);
+        const int nextStart = nextLineStart(text, contentEnd, textLength);
+        const int lineEnd = lineRangeEnd(contentEnd, nextStart, flags, state);
+
+        startReplace(text, lineEnd, lineStart, maxCount > 0 ? maxCount - total.matches : 0, search, lineMatchToReplacement, &state, lineFlags, replacements);
+        addLineStats(total);
+
+        if ((maxCount > 0 && total.matches >= maxCount) 
+            || SEARCH_NOT_STOPPED != total.stopReason
+            || isLastLine(contentEnd, nextStart, textLength, flags))
+		{
+            break;
+		}
+        lineStart = nextStart;
+	}
+
+    m_stats = total;
+}
+
+/** As startReplaceLines(), for search()
+ */
+template<class CharTraitsT>
+void Replacer<CharTraitsT>::searchLines(const char *text, const int textLength, const int startPosition, int maxCount, const char *search, 
+    searchResultHandler resultHandler, void *resultHandlerState, python_re_flags flags)
+{
+    const python_re_flags lineFlags = static_cast<python_re_flags>(flags & ~(python_re_flag_lines | python_re_flag_includelineendings));
+    SearchStats total;
+
+    LineState state;
+    state.replacer = this;
+    state.resultHandler = resultHandler;
+    state.resultHandlerState = resultHandlerState;
+    state.stopped = false;
+
+    int lineStart = startPosition;
+    for (;;)
+	{
+        const int contentEnd = lineContentEnd(text, lineStart, textLength);
+        const int nextStart = nextLineStart(text, contentEnd, textLength);
+        const int lineEnd = lineRangeEnd(contentEnd, nextStart, flags, state);
+
+        this->search(text, lineEnd, lineStart, maxCount > 0 ? maxCount - total.matches : 0, search, lineMatchFound, &state, lineFlags);
+        addLineStats(total);
+
+        // A false from the handler stops all the lines, not just this one
+        if (state.stopped
+            || (maxCount > 0 && total.matches >= maxCount) 
+            || SEARCH_NOT_STOPPED != total.stopReason
+            || isLastLine(contentEnd, nextStart, textLength, flags))
+		{
+            break;
+		}
+        lineStart = nextStart;
+	}
+
+    m_stats = total;
+}
+
+/** Returns where the line is searched up to, and sets state.nextLineStart for it
+ */
+template<class CharTraitsT>
+int Replacer<CharTraitsT>::lineRangeEnd(int contentEnd, int nextStart, python_re_flags flags, LineState& state)
+{
+    if ((flags & python_re_flag_includelineendings) && nextStart > contentEnd)
+	{
+        state.nextLineStart = nextStart;
+        return nextStart;
+	}
+
+    state.nextLineStart = -1;
+    return contentEnd;
+}
+
+/** With the line ending included, ^ (and anything else that can match an empty string) also matches after it, at the end of
+ *  the line.  That is the start of the next line, where the same match is found again, so it's dropped (and not counted) here.
+ */
+template<class CharTraitsT>
+bool Replacer<CharTraitsT>::isStartOfNextLine(LineState& state, Match *match)
+{
+    GroupDetail fullMatch;
+    match->group(0, fullMatch);
+    if (fullMatch.start() == state.nextLineStart && fullMatch.end() == fullMatch.start())
+	{
+        --state.replacer->m_stats.matches;
+        return true;
+	}
+    return false;
+}
+
+template<class CharTraitsT>
+void Replacer<CharTraitsT>::lineMatchToReplacement(const char *text, Match *match, void *state, ReplacementBatch& replacements)
+{
+    LineState *lineState = reinterpret_cast<LineState*>(state);
+    if (!isStartOfNextLine(*lineState, match))
+	{
+        lineState->converter(text, match, lineState->converterState, replacements);
+	}
+}
+
+template<class CharTraitsT>
+bool Replacer<CharTraitsT>::lineMatchFound(const char *text, Match *match, void *state)
+{
+    LineState *lineState = reinterpret_cast<LineState*>(state);
+    if (isStartOfNextLine(*lineState, match))
+	{
+        return true;
+	}
+    lineState->stopped = !lineState->resultHandler(text, match, lineState->resultHandlerState);
+    return !lineState->stopped;
+}
+
+template<class CharTraitsT>
+long Replacer<CharTraitsT>::count(const char *text, const int textLength, const int startPosition, const char *search, python_re_flags flags)
+{
+    // search() counts the matches in the stats anyway
+    this->search(text, textLength, startPosition, 0, search, ignoreMatch, NULL, flags);
+    return m_stats.matches;
+}
+
+/** Passed through the MultiLiteralSearcher to keywordFound()
+ */
+template<class CharTraitsT>
+struct Replacer<CharTraitsT>::SearchManyState
+{
+    Replacer *replacer;
+    const char *text;
+    int textLength;
+    const std::vector<std::string> *keywords;
+    boost::regex_constants::syntax_option_type syntaxFlags;
+    std::vector<int> searchFrom;     // The end of the last match of each keyword
+    int searchedTo;                  // The end of the last match of any keyword
+    keywordResultHandler resultHandler;
+    void *resultHandlerState;
+};
+
+template<class CharTraitsT>
+void Replacer<CharTraitsT>::searchMany(const char *text, const int textLength, const int startPosition, const std::vector<std::string>& keywords, 
+    keywordResultHandler resultHandler, void *resultHandlerState, python_re_flags flags)
+{
+    m_stats = SearchStats();
+
+    const bool ignoreCase = 0 != (flags & python_re_flag_ignorecase);
+    boost::shared_ptr<const MultiLiteralSearcher> searcher = MultiLiteralSearcher::get(keywords, ignoreCase, CharTraitsT::literalEncoding);
+
+    SearchManyState state;
+    state.replacer = this;
+    state.text = text;
+    state.textLength = textLength;
+    state.keywords = &keywords;
+    state.syntaxFlags = getSyntaxFlags(static_cast<python_re_flags>(python_re_flag_literal | (flags & python_re_flag_ignorecase)));
+    state.searchFrom.assign(keywords.size(), startPosition);
+    state.searchedTo = startPosition;
+    state.resultHandler = resultHandler;
+    state.resultHandlerState = resultHandlerState;
+
+    searcher->findAll(text, startPosition, textLength, keywordFound, &state);
+    recordBudget(state.searchedTo);
+}
+
+template<class CharTraitsT>
+bool Replacer<CharTraitsT>::keywordFound(int keyword, int start, int end, void *state)
+{
+    SearchManyState *searchState = reinterpret_cast<SearchManyState*>(state);
+
+    // A LiteralMatch, as a plain search for the keyword would have given
+    LiteralMatch<CharTraitsT> match(searchState->text, searchState->textLength, (*searchState->keywords)[keyword].c_str(), searchState->syntaxFlags);
+    match.setMatch(searchState->searchFrom[keyword], start, end);
+    searchState->searchFrom[keyword] = end;
+    searchState->searchedTo = end;
+    ++searchState->replacer->m_stats.matches;
+
+    return searchState->resultHandler(searchState->text, keyword, &match, searchState->resultHandlerState)
+        && !searchState->replacer->m_budget.isExhausted();
+}
+
+/** Passed through the MultiLiteralSearcher to keywordToReplacement()
+ */
+template<class CharTraitsT>
+struct Replacer<CharTraitsT>::ReplaceManyState
+{
+    Replacer *replacer;
+    const std::vector<std::string> *replacements;
+    ReplacementBatch *batch;
+    int searchedTo;                  // The end of the last replacement
+};
+
+template<class CharTraitsT>
+void Replacer<CharTraitsT>::startReplaceMany(const char *text, const int textLength, const int startPosition, const std::vector<std::string>& keywords, 
+    const std::vector<std::string>& replacements, python_re_flags flags, ReplacementBatch& batch)
+{
+    m_stats = SearchStats();
+
+    const bool ignoreCase = 0 != (flags & python_re_flag_ignorecase);
+    boost::shared_ptr<const MultiLiteralSearcher> searcher = MultiLiteralSearcher::get(keywords, ignoreCase, CharTraitsT::literalEncoding);
+
+    ReplaceManyState state;
+    state.replacer = this;
+    state.replacements = &replacements;
+    state.batch = &batch;
+    state.searchedTo = startPosition;
+
+    searcher->findLeftmostLongest(text, startPosition, textLength, keywordToReplacement, &state);
+    recordBudget(state.searchedTo);
+}
+
+template<class CharTraitsT>
+bool Replacer<CharTraitsT>::keywordToReplacement(int keyword, int start, int end, void *state)
+{
+    ReplaceManyState *replaceState = reinterpret_cast<ReplaceManyState*>(state);
+    const std::string& replacement = (*replaceState->replacements)[keyword];
+    replaceState->batch->add(start, end, replacement.c_str(), static_cast<int>(replacement.size()));
+    replaceState->searchedTo = end;
+    ++replaceState->replacer->m_stats.matches;
+    return !replaceState->replacer->m_budget.isExhausted();
+}
+
+template<class CharTraitsT>
+template<class SearcherT>
+void Replacer<CharTraitsT>::startReplaceLiteral(const SearcherT& searcher, const char *text, const int textLength, 
+	const int startPosition, 
+    int maxCount,
+	const char *search, 
+	matchConverter converter,
+    void *converterState,
+    python_re_flags flags,
+	ReplacementBatch &replacements) 
+{
+    LiteralMatch<CharTraitsT> match(text, textLength, search, getSyntaxFlags(flags));
+
+    bool checkCountOfReplaces = false;
+    if (maxCount > 0) 
+	{
+        checkCountOfReplaces = true;
+	}
+
+    int searchFrom = startPosition;
+    int matchEnd;
+    for (int found = searcher.find(text, searchFrom, textLength, &matchEnd); found != -1; found = searcher.find(text, searchFrom, textLength, &matchEnd))
+	{
+        match.setMatch(searchFrom, found, matchEnd);
+        searchFrom = matchEnd;
+        ++m_stats.matches;
+
+        converter(text, &match, converterState, replacements);
+        if ((checkCountOfReplaces && 0 == --maxCount) || m_budget.isExhausted()) 
+		{
+            break;
+		}
+	}
+
+    recordBudget(searchFrom);
+}
+
+template<class CharTraitsT>
+template<class SearcherT>
+void Replacer<CharTraitsT>::searchLiteral(const SearcherT& searcher, const char *text, const int textLength, 
+	const int startPosition, 
+    int maxCount,
+	const char *search, 
+	searchResultHandler resultHandler,
+    void *resultHandlerState,
+    python_re_flags flags) 
+{
+    LiteralMatch<CharTraitsT> match(text, textLength, search, getSyntaxFlags(flags));
 
     bool checkCountOfSearches = false;
     if (maxCount > 0) 
@@ -353,18 +1312,22 @@ void Replacer<CharTraitsT>::search(const char *text, const int textLength,
         checkCountOfSearches = true;
 	}
 
-    for(CharTraitsT::regex_iterator_type it(start, end, r, getMatchFlags(flags)); it != iteratorEnd; ++it) 
+    int searchFrom = startPosition;
+    int matchEnd;
+    for (int found = searcher.find(text, searchFrom, textLength, &matchEnd); found != -1; found = searcher.find(text, searchFrom, textLength, &matchEnd))
 	{
-        boost::match_results<CharTraitsT::text_iterator_type> boost_match_results(*it);
+        match.setMatch(searchFrom, found, matchEnd);
+        searchFrom = matchEnd;
+        ++m_stats.matches;
 
-        match.setMatchResults(&boost_match_results); 
         bool shouldContinue = resultHandler(text, &match, resultHandlerState);
-        if (!shouldContinue || (checkCountOfSearches && 0 == --maxCount)) 
+        if (!shouldContinue || (checkCountOfSearches && 0 == --maxCount) || m_budget.isExhausted()) 
 		{
             break;
 		}
 	}
 
+    recordBudget(searchFrom);
 }
 
 }
@@ -0,0 +1,553 @@
+#include "stdafx.h"
+
+#include "RequiredLiteral.h"
+
+namespace NppPythonScript
+{
+
+/** Thrown by the parser when the pattern has something that it can't safely analyse
+ */
+class UnsupportedPattern
+{
+};
+
+// Offsets beyond this are treated as unbounded
+static const int MAX_BOUNDED_OFFSET = 100000;
+
+/** Walks the top level of a pattern one atom (and the quantifier following it) at a time, keeping track of the range
+ *  of offsets from the start of the match, and of the current run of literal characters.  Groups are skipped over as a 
+ *  whole, as anything inside a group might be optional.
+ *
+ *  Anything that could change how the rest of the pattern is read (inline modifiers, comments), or that could end or 
+ *  restart the match somewhere unexpected (verbs, \\G) makes the whole pattern unsupported.
+ */
+class RequiredLiteralParser
+{
+public:
+    RequiredLiteralParser(const char *pattern, LiteralEncoding encoding, RequiredLiteral& result)
+		: m_position(pattern),
+          m_end(pattern + strlen(pattern)),
+          m_encoding(encoding),
+          m_result(result),
+          m_inQuote(false),
+          m_runMinOffset(0),
+          m_runMaxOffset(0),
+          m_minOffset(0),
+          m_maxOffset(0)
+	{}
+
+    void parse();
+
+private:
+    enum AtomType
+	{
+        ATOM_LITERAL,      // A single character, in m_atom
+        ATOM_SINGLE,       // Matches exactly one character, e.g. "." or "[a-z]"
+        ATOM_ZERO_WIDTH,   // An assertion, e.g. "^" or "\\b", or the start or end of a \\Q..\\E
+        ATOM_GROUP         // Anything in parentheses
+	};
+
+    AtomType parseAtom();
+    AtomType parseEscape();
+    bool parseQuantifier(int& minCount, int& maxCount);
+    int parseCount();
+    void readCharacter();
+    void skipGroup();
+    void skipClass();
+    void skipQuote();
+    void skipEscape();
+    void endRun();
+
+    static int addOffsets(int offset1, int offset2);
+    static int multiplyOffset(int count, int offset);
+
+    const char *m_position;
+    const char *m_end;
+    LiteralEncoding m_encoding;
+    RequiredLiteral& m_result;
+    bool m_inQuote;        // Between \\Q and \\E, where everything is literal
+    std::string m_atom;
+    std::string m_run;     // The literal characters since the last atom that wasn't one
+    int m_runMinOffset;
+    int m_runMaxOffset;
+    int m_minOffset;       // Of the current position in the pattern from the start of the match
+    int m_maxOffset;
+};
+
+
+RequiredLiteral::RequiredLiteral(const char *pattern, LiteralEncoding encoding)
+	: m_minOffset(0),
+      m_maxOffset(0)
+{
+    if (LITERAL_ENCODING_UTF8 == encoding)
+	{
+        // The literal must be valid UTF-8 to be searched for byte by byte
+        UtfConversion::Utf8Decoder decoder(pattern, static_cast<unsigned int>(strlen(pattern)));
+        while (!decoder.isEnd())
+		{
+            if (UtfConversion::isInvalidUtf8(decoder.decodedChar()))
+			{
+                return;
+			}
+            decoder.advanceToNext();
+		}
+	}
+
+    try
+	{
+        RequiredLiteralParser parser(pattern, encoding, *this);
+        parser.parse();
+	}
+    catch (UnsupportedPattern&)
+	{
+        m_literal.clear();
+        m_minOffset = 0;
+        m_maxOffset = 0;
+	}
+}
+
+
+void RequiredLiteralParser::parse()
+{
+    while (m_position < m_end)
+	{
+        AtomType atomType = parseAtom();
+
+        int minCount = 1;
+        int maxCount = 1;
+        bool quantified = !m_inQuote && parseQuantifier(minCount, maxCount);
+
+        switch (atomType)
+		{
+            case ATOM_LITERAL:
+                if (minCount > 0)
+				{
+                    if (m_run.empty())
+					{
+                        m_runMinOffset = m_minOffset;
+                        m_runMaxOffset = m_maxOffset;
+					}
+                    m_run += m_atom;
+				}
+
+                // With a quantifier, the character is only certain to be followed by the next atom if it can't repeat
+                if (quantified)
+				{
+                    endRun();
+				}
+                m_minOffset = addOffsets(m_minOffset, minCount);
+                m_maxOffset = addOffsets(m_maxOffset, multiplyOffset(maxCount, 1));
+                break;
+
+            case ATOM_SINGLE:
+                endRun();
+                m_minOffset = addOffsets(m_minOffset, minCount);
+                m_maxOffset = addOffsets(m_maxOffset, multiplyOffset(maxCount, 1));
+                break;
+
+            case ATOM_ZERO_WIDTH:
+                // Nothing is consumed, so the characters either side are still next to each other
+                if (quantified)
+				{
+                    throw UnsupportedPattern();
+				}
+                break;
+
+            case ATOM_GROUP:
+                endRun();
+                m_maxOffset = addOffsets(m_maxOffset, multiplyOffset(maxCount, RequiredLiteral::UNBOUNDED));
+                break;
+		}
+	}
+
+    endRun();
+}
+
+
+RequiredLiteralParser::AtomType RequiredLiteralParser::parseAtom()
+{
+    if (m_inQuote)
+	{
+        if (m_end - m_position >= 2 && '\\' == m_position[0] && 'E' == m_position[1])
+		{
+            m_position += 2;
+            m_inQuote = false;
+            return ATOM_ZERO_WIDTH;
+		}
+        readCharacter();
+        return ATOM_LITERAL;
+	}
+
+    switch (*m_position)
+	{
+        case '(':
+            skipGroup();
+            return ATOM_GROUP;
+
+        case '[':
+            skipClass();
+            return ATOM_SINGLE;
+
+        case '.':
+            ++m_position;
+            return ATOM_SINGLE;
+
+        case '^':
+        case '$':
+            ++m_position;
+            return ATOM_ZERO_WIDTH;
+
+        case '\\':
+            return parseEscape();
+
+        case '|':
+        case ')':
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+        case '}':
+        case ']':
+            throw UnsupportedPattern();
+
+        default:
+            readCharacter();
+            return ATOM_LITERAL;
+	}
+}
+
+
+RequiredLiteralParser::AtomType RequiredLiteralParser::parseEscape()
+{
+    ++m_position;
+    if (m_position >= m_end)
+	{
+        throw UnsupportedPattern();
+	}
+
+    const unsigned char c = static_cast<unsigned char>(*m_position);
+    ++m_position;
+
+    if (c >= 0x80)
+	{
+        throw UnsupportedPattern();
+	}
+
+    if (!isalnum(c))
+	{
+        // Escaped punctuation is the character itself, apart from these word and buffer boundaries
+        if ('<' == c || '>' == c || '`' == c || '\'' == c)
+		{
+            return ATOM_ZERO_WIDTH;
+		}
+        m_atom.assign(1, static_cast<char>(c));
+        return ATOM_LITERAL;
+	}
+
+    switch (c)
+	{
+        case 'Q':
+            m_inQuote = true;
+            return ATOM_ZERO_WIDTH;
+
+        case 'E':
+        case 'b':
+        case 'B':
+        case 'A':
+        case 'z':
+        case 'Z':
+            return ATOM_ZERO_WIDTH;
+
+        case 'd':
+        case 'D':
+        case 'w':
+        case 'W':
+        case 's':
+        case 'S':
+        case 'h':
+        case 'H':
+        case 'v':
+        case 'V':
+            return ATOM_SINGLE;
+
+        case 'n': m_atom.assign(1, '\n'); return ATOM_LITERAL;
+        case 't': m_atom.assign(1, '\t'); return ATOM_LITERAL;
+        case 'r': m_atom.assign(1, '\r'); return ATOM_LITERAL;
+        case 'f': m_atom.assign(1, '\f'); return ATOM_LITERAL;
+        case 'a': m_atom.assign(1, '\a'); return ATOM_LITERAL;
+        case 'e': m_atom.assign(1, '\x1B'); return ATOM_LITERAL;
+
+        default:
+            // Back references, \\x, \\p{..}, \\G, \\K etc
+            throw UnsupportedPattern();
+	}
+}
+
+
+bool RequiredLiteralParser::parseQuantifier(int& minCount, int& maxCount)
+{
+    if (m_position >= m_end)
+	{
+        return false;
+	}
+
+    switch (*m_position)
+	{
+        case '*':
+            minCount = 0;
+            maxCount = RequiredLiteral::UNBOUNDED;
+            ++m_position;
+            break;
+
+        case '+':
+            minCount = 1;
+            maxCount = RequiredLiteral::UNBOUNDED;
+            ++m_position;
+            break;
+
+        case '?':
+            minCount = 0;
+            maxCount = 1;
+            ++m_position;
+            break;
+
+        case '{':
+            ++m_position;
+            minCount = parseCount();
+            maxCount = minCount;
+            if (m_position < m_end && ',' == *m_position)
+			{
+                ++m_position;
+                maxCount = (m_position < m_end && '}' == *m_position) ? RequiredLiteral::UNBOUNDED : parseCount();
+			}
+            if (m_position >= m_end || '}' != *m_position)
+			{
+                throw UnsupportedPattern();
+			}
+            ++m_position;
+            break;
+
+        default:
+            return false;
+	}
+
+    // Lazy and possessive quantifiers match the same number of times
+    if (m_position < m_end && ('?' == *m_position || '+' == *m_position))
+	{
+        ++m_position;
+	}
+    return true;
+}
+
+
+int RequiredLiteralParser::parseCount()
+{
+    int count = 0;
+    int digits = 0;
+    while (m_position < m_end && *m_position >= '0' && *m_position <= '9')
+	{
+        if (++digits > 6)
+		{
+            throw UnsupportedPattern();
+		}
+        count = count * 10 + (*m_position - '0');
+        ++m_position;
+	}
+    if (0 == digits)
+	{
+        throw UnsupportedPattern();
+	}
+    return count;
+}
+
+
+/** Puts the bytes of the character at m_position in m_atom
+ */
+void RequiredLiteralParser::readCharacter()
+{
+    int length = 1;
+    if (LITERAL_ENCODING_UTF8 == m_encoding)
+	{
+        // The pattern has already been checked to be valid UTF-8
+        UtfConversion::Utf8Decoder decoder(m_position, static_cast<unsigned int>(m_end - m_position));
+        length = static_cast<int>(decoder.decodedLength());
+	}
+    m_atom.assign(m_position, length);
+    m_position += length;
+}
+
+
+void RequiredLiteralParser::skipGroup()
+{
+    int depth = 0;
+    while (m_position < m_end)
+	{
+        switch (*m_position)
+		{
+            case '\\':
+                if (m_position + 1 < m_end && 'Q' == m_position[1])
+				{
+                    m_position += 2;
+                    skipQuote();
+				}
+                else if (m_position + 1 < m_end && 'G' == m_position[1])
+				{
+                    // Matches where the search started, so depends on where the regex engine is run from
+                    throw UnsupportedPattern();
+				}
+                else
+				{
+                    skipEscape();
+				}
+                break;
+
+            case '[':
+                skipClass();
+                break;
+
+            case '(':
+                if (m_position + 1 < m_end && '*' == m_position[1])
+				{
+                    throw UnsupportedPattern();
+				}
+                if (m_position + 2 < m_end && '?' == m_position[1] && NULL != strchr("imsx-^#", m_position[2]))
+				{
+                    throw UnsupportedPattern();
+				}
+                ++depth;
+                ++m_position;
+                break;
+
+            case ')':
+                ++m_position;
+                if (0 == --depth)
+				{
+                    return;
+				}
+                break;
+
+            default:
+                ++m_position;
+                break;
+		}
+	}
+
+    throw UnsupportedPattern();
+}
+
+
+void RequiredLiteralParser::skipClass()
+{
+    ++m_position;
+    if (m_position < m_end && '^' == *m_position)
+	{
+        ++m_position;
+	}
+
+    // A ']' straight after the '[' (or "[^") is part of the class
+    if (m_position < m_end && ']' == *m_position)
+	{
+        ++m_position;
+	}
+
+    while (m_position < m_end)
+	{
+        switch (*m_position)
+		{
+            case ']':
+                ++m_position;
+                return;
+
+            case '\\':
+                if (m_position + 1 < m_end && 'Q' == m_position[1])
+				{
+                    m_position += 2;
+                    skipQuote();
+				}
+                else
+				{
+                    skipEscape();
+				}
+                break;
+
+            case '[':
+                // [:alpha:], [=a=] and [.a.]
+                if (m_position + 1 < m_end && NULL != strchr(":=.", m_position[1]))
+				{
+                    const char terminator[3] = { m_position[1], ']', '\0' };
+                    const char *found = strstr(m_position + 2, terminator);
+                    if (NULL == found)
+					{
+                        throw UnsupportedPattern();
+					}
+                    m_position = found + 2;
+				}
+                else
+				{
+                    ++m_position;
+				}
+                break;
+
+            default:
+                ++m_position;
+                break;
+		}
+	}
+
+    throw UnsupportedPattern();
+}
+
+
+/** Skips a backslash and the character after it
+ */
+void RequiredLiteralParser::skipEscape()
+{
+    m_position += (m_position + 1 < m_end) ? 2 : 1;
+}
+
+
+/** Skips to after the \\E that ends a \\Q, or to the end of the pattern if there isn't one
+ */
+void RequiredLiteralParser::skipQuote()
+{
+    const char *found = strstr(m_position, "\\E");
+    m_position = (NULL == found) ? m_end : found + 2;
+}
+
+
+void RequiredLiteralParser::endRun()
+{
+    if (m_run.size() > m_result.m_literal.size())
+	{
+        m_result.m_literal = m_run;
+        m_result.m_minOffset = m_runMinOffset;
+        m_result.m_maxOffset = m_runMaxOffset;
+	}
+    m_run.clear();
+}
+
+
+int RequiredLiteralParser::addOffsets(int offset1, int offset2)
+{
+    if (RequiredLiteral::UNBOUNDED == offset1 || RequiredLiteral::UNBOUNDED == offset2 || offset1 + offset2 > MAX_BOUNDED_OFFSET)
+	{
+        return RequiredLiteral::UNBOUNDED;
+	}
+    return offset1 + offset2;
+}
+
+
+int RequiredLiteralParser::multiplyOffset(int count, int offset)
+{
+    if (0 == count || 0 == offset)
+	{
+        return 0;
+	}
+    if (RequiredLiteral::UNBOUNDED == count || RequiredLiteral::UNBOUNDED == offset || count > MAX_BOUNDED_OFFSET / offset)
+	{
+        return RequiredLiteral::UNBOUNDED;
+	}
+    return count * offset;
+}
+
+}
@@ -0,0 +1,48 @@
+#ifndef REQUIREDLITERAL_20140426_H
+#define REQUIREDLITERAL_20140426_H
+
+#include "LiteralSearcher.h"
+
+namespace NppPythonScript
+{
+
+/** A literal that every match of a regular expression contains, e.g. "ERROR" for "ERROR\\s+\\d{4}" or "0x" for "\\b0x[0-9a-f]+".
+ *  The search can then jump from one occurrence of the literal to the next with a LiteralSearcher, and only run the 
+ *  regex engine near each occurrence, rather than trying a match at every position of the text.
+ *
+ *  The pattern is only analysed at the top level (i.e. not inside groups), and only as far as it can be done safely - if the 
+ *  pattern has a top level alternation, inline modifiers (e.g. "(?i)"), verbs or escapes that aren't understood here, 
+ *  isFound() is false.  The literal is the longest run of characters that must appear one after the other in every match.
+ *
+ *  The offset of the literal from the start of the match is also worked out (in characters), if everything before the
+ *  literal has a bounded width.
+ */
+class RequiredLiteral
+{
+public:
+    RequiredLiteral(const char *pattern, LiteralEncoding encoding);
+
+    static const int UNBOUNDED = -1;
+
+    bool isFound() const { return !m_literal.empty(); }
+
+    /** The literal, in the same encoding as the pattern */
+    const std::string& literal() const { return m_literal; }
+
+    /** The smallest and largest number of characters between the start of a match and the literal.  
+     *  maxOffset() is UNBOUNDED if the literal can be any distance from the start of the match (e.g. after a "\\w+").
+     */
+    int minOffset() const { return m_minOffset; }
+    int maxOffset() const { return m_maxOffset; }
+
+private:
+    friend class RequiredLiteralParser;
+
+    std::string m_literal;
+    int m_minOffset;
+    int m_maxOffset;
+};
+
+}
+
+#endif // REQUIREDLITERAL_20140426_H
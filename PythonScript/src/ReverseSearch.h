@@ -0,0 +1,200 @@
+#ifndef REVERSESEARCH_20140511_H
+#define REVERSESEARCH_20140511_H
+
+#include "ParallelSearch.h"
+
+namespace NppPythonScript
+{
+
+/** Finds the matches of a regex last first, going backwards from the end of the text (editor.rsearch() in Python).
+ *  The matches are the same ones as Replacer::search() finds, just in the opposite order.
+ *
+ *  Boost can only search forwards, and trying the regex at each position going backwards doesn't give the same matches
+ *  as a forward search (\\w+ would find just the "f" at the end of "def").  For a line local pattern (see
+ *  ParallelSearchBase::isLineLocal()), a forward search from the start of any line is in step with a search of the whole
+ *  text, as for the chunks of a ParallelSearch.  So the text is searched in blocks of whole lines, from the end backwards:
+ *  each block is searched forwards, and its matches reported last first.  The first block is FIRST_BLOCK_SIZE bytes, and
+ *  each one after that is twice the size of the one before, so finding the previous match costs about as much as the
+ *  distance back to it, rather than the length of all the text before it.
+ *
+ *  Any other pattern is searched forwards over the whole text in one block.
+ */
+template <class CharTraitsT>
+class ReverseSearch
+{
+public:
+    static const int FIRST_BLOCK_SIZE = 4096;
+
+    /** Searches [startPosition, textLength) of text - the same as Replacer::search() with the same arguments would
+     */
+    ReverseSearch(const char *text, int textLength, int startPosition, const char *search, python_re_flags flags);
+
+    /** Calls resultHandler for each match, last first, until it returns false or maxCount matches have been reported.
+     *  If the SearchBudget stops the search, getStats().stoppedAt is how far back it had got: every match after that
+     *  has been reported.
+     */
+    void search(int maxCount, searchResultHandler resultHandler, void *resultHandlerState);
+
+    /** False if the pattern isn't line local, so the whole text had to be searched at once
+     */
+    bool isBlockwise() const { return m_blockwise; }
+
+    const SearchStats& getStats() const { return m_stats; }
+
+private:
+    struct Block
+	{
+        Block() : start(0), end(0), isLast(false), textLength(0), groupCount(0) {}
+
+        int start;
+        int end;
+        bool isLast;             // The block at the end of the text
+        int textLength;
+        int groupCount;
+        std::vector<GroupDetail> groups;    // groupCount entries for each match
+	};
+
+    int blockStart(int end, int size) const;
+    static bool collectMatch(const char *text, Match *match, void *state);
+
+    const char *m_text;
+    const int m_textLength;
+    const int m_startPosition;
+    const char *m_search;
+    const python_re_flags m_flags;
+    const bool m_blockwise;
+    typename RegexCache<CharTraitsT>::regex_ptr m_regex;
+    SearchStats m_stats;
+    SearchBudget m_budget;
+};
+
+template <class CharTraitsT>
+ReverseSearch<CharTraitsT>::ReverseSearch(const char *text, int textLength, int startPosition, const char *search, python_re_flags flags)
+	: m_text(text),
+      m_textLength(textLength),
+      m_startPosition(startPosition),
+      m_search(search),
+      m_flags(flags),
+      m_blockwise(0 == (flags & (python_re_flag_dotall | python_re_flag_wholedoc)) && ParallelSearchBase::isLineLocal(search))
+{
+    m_regex = RegexCache<CharTraitsT>::getInstance().get(search, Replacer<CharTraitsT>::getSyntaxFlags(flags));
+}
+
+template <class CharTraitsT>
+void ReverseSearch<CharTraitsT>::search(int maxCount, searchResultHandler resultHandler, void *resultHandlerState)
+{
+    m_stats = SearchStats();
+    StoredRegexMatch<CharTraitsT> match(m_text, m_textLength, m_startPosition, *m_regex, Replacer<CharTraitsT>::getMatchFlags(m_flags));
+
+    int end = m_textLength;
+    int size = FIRST_BLOCK_SIZE;
+    do
+	{
+        Block block;
+        block.start = m_blockwise ? blockStart(end, size) : m_startPosition;
+        block.end = end;
+        block.isLast = (end == m_textLength);
+        block.textLength = m_textLength;
+
+        Replacer<CharTraitsT> replacer;
+        replacer.setBudget(m_budget);
+        replacer.search(m_text, block.end, block.start, 0, m_search, collectMatch, &block, m_flags);
+
+        const SearchStats& blockStats = replacer.getStats();
+        m_stats.prefilterUsed = blockStats.prefilterUsed;
+        m_stats.prefilterLiteral = blockStats.prefilterLiteral;
+        m_stats.literalCandidates += blockStats.literalCandidates;
+        m_stats.regexRuns += blockStats.regexRuns;
+        m_stats.slowestRegexRun = (std::max)(m_stats.slowestRegexRun, blockStats.slowestRegexRun);
+
+        // The block's last matches are the ones that weren't found, so none of it can be reported
+        if (SEARCH_NOT_STOPPED != blockStats.stopReason)
+		{
+            m_stats.stopReason = blockStats.stopReason;
+            m_stats.stoppedAt = block.end;
+            return;
+		}
+
+        const int groupCount = block.groupCount;
+        for (size_t index = block.groups.size(); index > 0; )
+		{
+            index -= groupCount;
+
+            // The match is found again (for expand() etc) from the end of the one before it in the block, as a forward search would
+            int searchFrom = block.start;
+            bool afterEmptyMatch = false;
+            if (index > 0)
+			{
+                const GroupDetail& previous = block.groups[index - groupCount];
+                searchFrom = previous.end();
+                afterEmptyMatch = (previous.start() == previous.end());
+			}
+            match.setMatch(&block.groups[index], groupCount, searchFrom, afterEmptyMatch);
+
+            ++m_stats.matches;
+            bool shouldContinue = resultHandler(m_text, &match, resultHandlerState);
+            if (!shouldContinue || (maxCount > 0 && m_stats.matches >= maxCount))
+			{
+                return;
+			}
+		}
+
+        end = block.start;
+        if (size < INT_MAX / 2)
+		{
+            size *= 2;
+		}
+	} while (end > m_startPosition);
+}
+
+/** Returns the start of the line that the position size bytes before end is in, or m_startPosition if that is later
+ */
+template <class CharTraitsT>
+int ReverseSearch<CharTraitsT>::blockStart(int end, int size) const
+{
+    if (end - m_startPosition <= size)
+	{
+        return m_startPosition;
+	}
+
+    int position = end - size;
+    while (position > m_startPosition && '\n' != m_text[position - 1])
+	{
+        --position;
+	}
+    return position;
+}
+
+template <class CharTraitsT>
+bool ReverseSearch<CharTraitsT>::collectMatch(const char * /* text */, Match *match, void *state)
+{
+    Block *block = reinterpret_cast<Block*>(state);
+    GroupDetail fullMatch;
+    match->group(0, fullMatch);
+
+    // An empty match at the end of the block is at the start of the one after it, and was found there
+    if (!block->isLast && fullMatch.start() >= block->end)
+	{
+        return false;
+	}
+
+    block->groupCount = match->groupCount();
+    block->groups.push_back(fullMatch);
+    for (int groupNo = 1; groupNo < block->groupCount; ++groupNo)
+	{
+        GroupDetail groupDetail;
+        match->group(groupNo, groupDetail);
+
+        // Groups that didn't match are at the end of what was searched, which is the end of the whole text for a single search
+        if (!groupDetail.matched())
+		{
+            groupDetail = GroupDetail(block->textLength, block->textLength, false);
+		}
+        block->groups.push_back(groupDetail);
+	}
+    return true;
+}
+
+}
+
+#endif // REVERSESEARCH_20140511_H
@@ -1,24 +1,52 @@
 #ifndef SCINTILLACALLBACK_20140303_H
 #define SCINTILLACALLBACK_20140303_H
 
+#include "NotificationFilter.h"
+
 namespace NppPythonScript
 {
+    class CallbackExecArgs;
 
     class ScintillaCallback
 	{
 	public:
-        ScintillaCallback(boost::python::object callback, bool isAsync)
+        ScintillaCallback(boost::python::object callback, bool isAsync, bool coalesce = false, const NotificationFilter& filter = NotificationFilter())
 			: m_callback(callback),
-              m_isAsync(isAsync)
+              m_isAsync(isAsync),
+              m_coalesce(coalesce),
+              m_filter(filter),
+              m_delivered(0),
+              m_filtered(0)
 		{}
 
 
 		boost::python::object getCallback() { return m_callback; }
 		bool isAsync() { return m_isAsync; }
+        bool coalesce() { return m_coalesce; }
+
+        /** The call of a coalescing callback that is waiting in the queue, if there is one.  Once it has been dispatched
+         *  (or dropped from a full queue), the next notification needs a new one.
+         */
+        std::weak_ptr<CallbackExecArgs>& pending() { return m_pending; }
+
+        const NotificationFilter& filter() { return m_filter; }
+
+        /** The number of notifications the callback was called for, and the number its filter threw away.  Both are only
+         *  changed and read under the callback mutex.
+         */
+        void countDelivered() { ++m_delivered; }
+        void countFiltered() { ++m_filtered; }
+        int delivered() { return m_delivered; }
+        int filtered() { return m_filtered; }
 
 	private:
 		boost::python::object m_callback;
         bool m_isAsync;
+        bool m_coalesce;
+        std::weak_ptr<CallbackExecArgs> m_pending;
+        NotificationFilter m_filter;
+        int m_delivered;
+        int m_filtered;
 	};
 }
 
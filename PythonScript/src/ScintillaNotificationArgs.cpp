@@ -0,0 +1,272 @@
+#include "stdafx.h"
+
+#include "ScintillaNotificationArgs.h"
+#include "Scintilla.h"
+
+namespace NppPythonScript
+{
+
+const char *ScintillaNotificationArgs::s_fieldNames[NUMBER_OF_FIELDS] = {
+    "code",
+    "position",
+    "ch",
+    "modifiers",
+    "modificationType",
+    "text",
+    "length",
+    "linesAdded",
+    "message",
+    "wParam",
+    "lParam",
+    "line",
+    "foldLevelNow",
+    "foldLevelPrev",
+    "margin",
+    "listType",
+    "x",
+    "y",
+    "token",
+    "annotationLinesAdded",
+    "updated",
+    "idFrom",
+    "hwndFrom",
+    "count"
+};
+
+/** The fields are the same as the ones the dict for each code used to have
+ */
+ScintillaNotificationArgs::ScintillaNotificationArgs(const SCNotification *notifyCode)
+	: m_fields(0),
+      m_borrowedText(NULL),
+      m_textLength(0),
+      m_textOwned(false),
+      m_textIsNone(false),
+      m_changedFields(NULL)
+{
+    set(FIELD_CODE, notifyCode->nmhdr.code);
+
+	switch(notifyCode->nmhdr.code)
+	{
+	case SCN_STYLENEEDED:
+	case SCN_CALLTIPCLICK:
+        set(FIELD_POSITION, notifyCode->position);
+		break;
+
+	case SCN_CHARADDED:
+        set(FIELD_CH, notifyCode->ch);
+		break;
+
+	case SCN_KEY:
+        set(FIELD_CH, notifyCode->ch);
+        set(FIELD_MODIFIERS, notifyCode->modifiers);
+		break;
+
+	case SCN_DOUBLECLICK:
+        set(FIELD_POSITION, notifyCode->position);
+        set(FIELD_MODIFIERS, notifyCode->modifiers);
+        set(FIELD_LINE, notifyCode->line);
+		break;
+
+	case SCN_UPDATEUI:
+        set(FIELD_UPDATED, notifyCode->updated);
+		break;
+
+	case SCN_MODIFIED:
+        set(FIELD_POSITION, notifyCode->position);
+        set(FIELD_MODIFICATIONTYPE, notifyCode->modificationType);
+        // notifyCode->text is not null terminated
+        setText(notifyCode->text ? notifyCode->text : "", notifyCode->text ? notifyCode->length : 0);
+        set(FIELD_LENGTH, notifyCode->length);
+        set(FIELD_LINESADDED, notifyCode->linesAdded);
+        set(FIELD_LINE, notifyCode->line);
+        set(FIELD_FOLDLEVELNOW, notifyCode->foldLevelNow);
+        set(FIELD_FOLDLEVELPREV, notifyCode->foldLevelPrev);
+        set(FIELD_TOKEN, notifyCode->token);
+        set(FIELD_ANNOTATIONLINESADDED, notifyCode->annotationLinesAdded);
+		break;
+
+	case SCN_MACRORECORD:
+        set(FIELD_MESSAGE, notifyCode->message);
+        set(FIELD_WPARAM, static_cast<INT_PTR>(notifyCode->wParam));
+        set(FIELD_LPARAM, notifyCode->lParam);
+		break;
+
+	case SCN_MARGINCLICK:
+        set(FIELD_MARGIN, notifyCode->margin);
+        set(FIELD_POSITION, notifyCode->position);
+        set(FIELD_MODIFIERS, notifyCode->modifiers);
+		break;
+
+	case SCN_NEEDSHOWN:
+        set(FIELD_POSITION, notifyCode->position);
+        set(FIELD_LENGTH, notifyCode->length);
+		break;
+
+	case SCN_USERLISTSELECTION:
+        setText(notifyCode->text, -1);
+        set(FIELD_LISTTYPE, notifyCode->listType);
+        set(FIELD_POSITION, notifyCode->position);
+		break;
+
+	case SCN_URIDROPPED:
+        setText(notifyCode->text, -1);
+		break;
+
+	case SCN_DWELLSTART:
+	case SCN_DWELLEND:
+        set(FIELD_POSITION, notifyCode->position);
+        set(FIELD_X, notifyCode->x);
+        set(FIELD_Y, notifyCode->y);
+		break;
+
+	case SCN_HOTSPOTCLICK:
+	case SCN_HOTSPOTDOUBLECLICK:
+	case SCN_HOTSPOTRELEASECLICK:
+	case SCN_INDICATORCLICK:
+	case SCN_INDICATORRELEASE:
+        set(FIELD_POSITION, notifyCode->position);
+        set(FIELD_MODIFIERS, notifyCode->modifiers);
+		break;
+
+	case SCN_AUTOCSELECTION:
+        setText(notifyCode->text, -1);
+        set(FIELD_POSITION, notifyCode->position);
+		break;
+
+	case SCN_SAVEPOINTREACHED:
+	case SCN_SAVEPOINTLEFT:
+	case SCN_MODIFYATTEMPTRO:
+	case SCN_PAINTED:
+	case SCN_ZOOM:
+	case SCN_AUTOCCANCELLED:
+	case SCN_AUTOCCHARDELETED:
+	case SCN_FOCUSIN:
+	case SCN_FOCUSOUT:
+		break;
+
+	default:
+		// Unknown notification, so just fill in all the parameters.
+        set(FIELD_IDFROM, static_cast<INT_PTR>(notifyCode->nmhdr.idFrom));
+        set(FIELD_HWNDFROM, reinterpret_cast<INT_PTR>(notifyCode->nmhdr.hwndFrom));
+        set(FIELD_POSITION, notifyCode->position);
+        set(FIELD_MODIFICATIONTYPE, notifyCode->modificationType);
+        if (notifyCode->text)
+		{
+            setText(notifyCode->text, notifyCode->length);
+		}
+        set(FIELD_LENGTH, notifyCode->length);
+        set(FIELD_LINESADDED, notifyCode->linesAdded);
+        set(FIELD_LINE, notifyCode->line);
+        set(FIELD_FOLDLEVELNOW, notifyCode->foldLevelNow);
+        set(FIELD_FOLDLEVELPREV, notifyCode->foldLevelPrev);
+        set(FIELD_ANNOTATIONLINESADDED, notifyCode->annotationLinesAdded);
+        set(FIELD_LISTTYPE, notifyCode->listType);
+        set(FIELD_MESSAGE, notifyCode->message);
+        set(FIELD_WPARAM, static_cast<INT_PTR>(notifyCode->wParam));
+        set(FIELD_LPARAM, notifyCode->lParam);
+        set(FIELD_MODIFIERS, notifyCode->modifiers);
+        set(FIELD_TOKEN, notifyCode->token);
+        set(FIELD_X, notifyCode->x);
+        set(FIELD_Y, notifyCode->y);
+		break;
+	}
+}
+
+/** A copy has its own copy of the dict Python changed, if there is one, so the GIL must be held to copy (or delete) args
+ *  that Python has changed.  Until then no Python objects are touched.
+ */
+ScintillaNotificationArgs::ScintillaNotificationArgs(const ScintillaNotificationArgs& other)
+	: m_fields(other.m_fields),
+      m_borrowedText(other.m_borrowedText),
+      m_ownedText(other.m_ownedText),
+      m_textLength(other.m_textLength),
+      m_textOwned(other.m_textOwned),
+      m_textIsNone(other.m_textIsNone),
+      m_changedFields(other.m_changedFields ? PyDict_Copy(other.m_changedFields) : NULL)
+{
+    std::copy(other.m_values, other.m_values + NUMBER_OF_FIELDS, m_values);
+}
+
+ScintillaNotificationArgs& ScintillaNotificationArgs::operator=(const ScintillaNotificationArgs& other)
+{
+    if (this != &other)
+	{
+        PyObject *changedFields = other.m_changedFields ? PyDict_Copy(other.m_changedFields) : NULL;
+        Py_XDECREF(m_changedFields);
+        m_changedFields = changedFields;
+        m_fields = other.m_fields;
+        std::copy(other.m_values, other.m_values + NUMBER_OF_FIELDS, m_values);
+        m_borrowedText = other.m_borrowedText;
+        m_ownedText = other.m_ownedText;
+        m_textLength = other.m_textLength;
+        m_textOwned = other.m_textOwned;
+        m_textIsNone = other.m_textIsNone;
+	}
+    return *this;
+}
+
+ScintillaNotificationArgs::~ScintillaNotificationArgs()
+{
+    Py_XDECREF(m_changedFields);
+}
+
+/** A length of -1 is a null terminated text, which can be NULL.  The text isn't copied until ownText()
+ */
+void ScintillaNotificationArgs::setText(const char *text, int length)
+{
+    m_textIsNone = (NULL == text);
+    m_borrowedText = text;
+    m_ownedText.clear();
+    m_textOwned = false;
+    if (m_textIsNone)
+	{
+        m_textLength = 0;
+	}
+    else if (length < 0)
+	{
+        m_textLength = static_cast<int>(strlen(text));
+	}
+    else
+	{
+        m_textLength = length;
+	}
+    m_fields |= bit(FIELD_TEXT);
+}
+
+void ScintillaNotificationArgs::ownText()
+{
+    if (!m_textOwned && m_borrowedText)
+	{
+        m_ownedText.assign(m_borrowedText, m_textLength);
+        m_textOwned = true;
+        m_borrowedText = NULL;
+	}
+}
+
+int ScintillaNotificationArgs::fieldCount() const
+{
+    int count = 0;
+    for (int field = 0; field < NUMBER_OF_FIELDS; ++field)
+	{
+        if (has(static_cast<Field>(field)))
+		{
+            ++count;
+		}
+	}
+    return count;
+}
+
+bool ScintillaNotificationArgs::findField(const char *name, Field& field)
+{
+    for (int index = 0; index < NUMBER_OF_FIELDS; ++index)
+	{
+        if (0 == strcmp(name, s_fieldNames[index]))
+		{
+            field = static_cast<Field>(index);
+            return true;
+		}
+	}
+    return false;
+}
+
+}
@@ -0,0 +1,127 @@
+#ifndef SCINTILLANOTIFICATIONARGS_20140511_H
+#define SCINTILLANOTIFICATIONARGS_20140511_H
+
+struct SCNotification;
+
+namespace NppPythonScript
+{
+    /** The fields of a Scintilla notification that are passed to a callback, copied out of the SCNotification (which only
+     *  lasts as long as the call to notify()).  The text is the exception: it points into the SCNotification until
+     *  ownText() copies it, which only args kept after notify() returns need (see ScintillaWrapper::notify()).
+     *
+     *  Callbacks used to get a dict with every field for the notification code filled in, which meant a dict, a Python
+     *  object for each field, and a copy of the text for each SCN_MODIFIED, most of which the callback never looked at.
+     *  Python gets this as a mapping instead (see export_notification_args()), with the same keys as the dict had, and the
+     *  Python object for a field is only made when the callback reads it.  The first time a callback changes or deletes a
+     *  key, the fields are copied into a dict, which has the args from then on - so a callback that changes them sees the
+     *  same as it did with the dict, at the cost of the dict.
+     */
+    class ScintillaNotificationArgs
+	{
+	public:
+        enum Field
+		{
+            FIELD_CODE,
+            FIELD_POSITION,
+            FIELD_CH,
+            FIELD_MODIFIERS,
+            FIELD_MODIFICATIONTYPE,
+            FIELD_TEXT,
+            FIELD_LENGTH,
+            FIELD_LINESADDED,
+            FIELD_MESSAGE,
+            FIELD_WPARAM,
+            FIELD_LPARAM,
+            FIELD_LINE,
+            FIELD_FOLDLEVELNOW,
+            FIELD_FOLDLEVELPREV,
+            FIELD_MARGIN,
+            FIELD_LISTTYPE,
+            FIELD_X,
+            FIELD_Y,
+            FIELD_TOKEN,
+            FIELD_ANNOTATIONLINESADDED,
+            FIELD_UPDATED,
+            FIELD_IDFROM,
+            FIELD_HWNDFROM,
+            FIELD_COUNT,                 // The number of notifications merged into a coalesced callback (see CoalescedEvents)
+            NUMBER_OF_FIELDS
+		};
+
+        explicit ScintillaNotificationArgs(const SCNotification *notifyCode);
+        ScintillaNotificationArgs(const ScintillaNotificationArgs& other);
+        ScintillaNotificationArgs& operator=(const ScintillaNotificationArgs& other);
+        ~ScintillaNotificationArgs();
+
+        /** The fields from the notification, and set() - changes made from Python are only in its dict
+         */
+        bool has(Field field) const { return 0 != (m_fields & bit(field)); }
+        INT_PTR value(Field field) const { return m_values[field]; }
+
+        /** The text, for FIELD_TEXT.  textIsNone() is true where the notification had a NULL text, which Python gets as None
+         */
+        std::string text() const { return std::string(textData(), m_textLength); }
+        bool textIsNone() const { return m_textIsNone; }
+
+        /** Copies the text out of the notification, so the args can outlive it.  Until then, a copy of the args points to
+         *  the same notification text.
+         */
+        void ownText();
+        bool ownsText() const { return m_textOwned; }
+
+        void set(Field field, INT_PTR value)
+		{
+            m_values[field] = value;
+            m_fields |= bit(field);
+		}
+
+        void remove(Field field) { m_fields &= ~bit(field); }
+
+        int fieldCount() const;
+
+        /** The key of the field in the dict callbacks used to get
+         */
+        static const char *fieldName(Field field) { return s_fieldNames[field]; }
+        static bool findField(const char *name, Field& field);
+
+        boost::python::object py_getitem(boost::python::object key) const;
+        boost::python::object py_get(boost::python::object key) const;
+        boost::python::object py_get_default(boost::python::object key, boost::python::object defaultValue) const;
+        bool py_contains(boost::python::object key) const;
+        boost::python::list py_keys() const;
+        boost::python::list py_values() const;
+        boost::python::list py_items() const;
+        boost::python::object py_iter() const;
+        boost::python::object py_itervalues() const;
+        boost::python::object py_iteritems() const;
+        int py_len() const;
+        boost::python::dict py_copy() const;
+        boost::python::object py_repr() const;
+        boost::python::object py_eq(boost::python::object other) const;
+        boost::python::object py_ne(boost::python::object other) const;
+        void py_setitem(boost::python::object key, boost::python::object value);
+        void py_delitem(boost::python::object key);
+
+	private:
+        static unsigned long bit(Field field) { return 1UL << field; }
+        bool findPresentField(boost::python::object key, Field& field) const;
+        boost::python::object fieldObject(Field field) const;
+        boost::python::object changedFields() const;
+        void copyOnWrite();
+        void setText(const char *text, int length);
+        const char *textData() const { return m_textOwned ? m_ownedText.data() : (m_borrowedText ? m_borrowedText : ""); }
+
+        static const char *s_fieldNames[NUMBER_OF_FIELDS];
+
+        unsigned long m_fields;                  // A bit for each Field the notification has
+        INT_PTR m_values[NUMBER_OF_FIELDS];
+        const char *m_borrowedText;              // The notification's text, until ownText()
+        std::string m_ownedText;
+        int m_textLength;
+        bool m_textOwned;
+        bool m_textIsNone;
+        PyObject *m_changedFields;               // The dict of the fields once Python has changed one, NULL until then
+	};
+}
+
+#endif // SCINTILLANOTIFICATIONARGS_20140511_H
@@ -0,0 +1,256 @@
+#include "stdafx.h"
+#include "ScintillaNotificationArgsPython.h"
+#include "ScintillaNotificationArgs.h"
+
+namespace NppPythonScript
+{
+
+bool ScintillaNotificationArgs::findPresentField(boost::python::object key, Field& field) const
+{
+    boost::python::extract<const char *> name(key);
+    return name.check() && findField(name(), field) && has(field);
+}
+
+boost::python::object ScintillaNotificationArgs::fieldObject(Field field) const
+{
+    switch (field)
+	{
+	case FIELD_TEXT:
+        if (m_textIsNone)
+		{
+            return boost::python::object();
+		}
+        return boost::python::str(textData(), m_textLength);
+
+	case FIELD_WPARAM:
+	case FIELD_IDFROM:
+        return boost::python::object(static_cast<UINT_PTR>(m_values[field]));
+
+	case FIELD_HWNDFROM:
+        return boost::python::object(reinterpret_cast<HWND>(m_values[field]));
+
+	default:
+        return boost::python::object(m_values[field]);
+	}
+}
+
+boost::python::object ScintillaNotificationArgs::changedFields() const
+{
+    return boost::python::object(boost::python::handle<>(boost::python::borrowed(m_changedFields)));
+}
+
+/** Copies the fields into the dict that has the args from then on, the first time Python changes them
+ */
+void ScintillaNotificationArgs::copyOnWrite()
+{
+    if (NULL == m_changedFields)
+	{
+        m_changedFields = boost::python::incref(py_copy().ptr());
+	}
+}
+
+boost::python::object ScintillaNotificationArgs::py_getitem(boost::python::object key) const
+{
+    if (m_changedFields)
+	{
+        return changedFields()[key];
+	}
+
+    Field field;
+    if (!findPresentField(key, field))
+	{
+        PyErr_SetObject(PyExc_KeyError, key.ptr());
+        boost::python::throw_error_already_set();
+	}
+    return fieldObject(field);
+}
+
+boost::python::object ScintillaNotificationArgs::py_get(boost::python::object key) const
+{
+    return py_get_default(key, boost::python::object());
+}
+
+boost::python::object ScintillaNotificationArgs::py_get_default(boost::python::object key, boost::python::object defaultValue) const
+{
+    if (m_changedFields)
+	{
+        return changedFields().attr("get")(key, defaultValue);
+	}
+
+    Field field;
+    return findPresentField(key, field) ? fieldObject(field) : defaultValue;
+}
+
+bool ScintillaNotificationArgs::py_contains(boost::python::object key) const
+{
+    if (m_changedFields)
+	{
+        int contains = PyDict_Contains(m_changedFields, key.ptr());
+        if (contains < 0)
+		{
+            boost::python::throw_error_already_set();
+		}
+        return 1 == contains;
+	}
+
+    Field field;
+    return findPresentField(key, field);
+}
+
+boost::python::list ScintillaNotificationArgs::py_keys() const
+{
+    if (m_changedFields)
+	{
+        return boost::python::list(changedFields().attr("keys")());
+	}
+
+    boost::python::list keys;
+    for (int field = 0; field < NUMBER_OF_FIELDS; ++field)
+	{
+        if (has(static_cast<Field>(field)))
+		{
+            keys.append(s_fieldNames[field]);
+		}
+	}
+    return keys;
+}
+
+boost::python::list ScintillaNotificationArgs::py_values() const
+{
+    if (m_changedFields)
+	{
+        return boost::python::list(changedFields().attr("values")());
+	}
+
+    boost::python::list values;
+    for (int field = 0; field < NUMBER_OF_FIELDS; ++field)
+	{
+        if (has(static_cast<Field>(field)))
+		{
+            values.append(fieldObject(static_cast<Field>(field)));
+		}
+	}
+    return values;
+}
+
+boost::python::list ScintillaNotificationArgs::py_items() const
+{
+    if (m_changedFields)
+	{
+        return boost::python::list(changedFields().attr("items")());
+	}
+
+    boost::python::list items;
+    for (int field = 0; field < NUMBER_OF_FIELDS; ++field)
+	{
+        if (has(static_cast<Field>(field)))
+		{
+            items.append(boost::python::make_tuple(s_fieldNames[field], fieldObject(static_cast<Field>(field))));
+		}
+	}
+    return items;
+}
+
+boost::python::object ScintillaNotificationArgs::py_iter() const
+{
+    return py_keys().attr("__iter__")();
+}
+
+boost::python::object ScintillaNotificationArgs::py_itervalues() const
+{
+    return py_values().attr("__iter__")();
+}
+
+boost::python::object ScintillaNotificationArgs::py_iteritems() const
+{
+    return py_items().attr("__iter__")();
+}
+
+int ScintillaNotificationArgs::py_len() const
+{
+    return m_changedFields ? static_cast<int>(PyDict_Size(m_changedFields)) : fieldCount();
+}
+
+/** A new dict of the fields, as callbacks used to get
+ */
+boost::python::dict ScintillaNotificationArgs::py_copy() const
+{
+    if (m_changedFields)
+	{
+        return boost::python::dict(changedFields());
+	}
+
+    boost::python::dict fields;
+    for (int field = 0; field < NUMBER_OF_FIELDS; ++field)
+	{
+        if (has(static_cast<Field>(field)))
+		{
+            fields[s_fieldNames[field]] = fieldObject(static_cast<Field>(field));
+		}
+	}
+    return fields;
+}
+
+boost::python::object ScintillaNotificationArgs::py_repr() const
+{
+    return py_copy().attr("__repr__")();
+}
+
+boost::python::object ScintillaNotificationArgs::py_eq(boost::python::object other) const
+{
+    boost::python::extract<const ScintillaNotificationArgs&> otherArgs(other);
+    return py_copy() == (otherArgs.check() ? otherArgs().py_copy() : other);
+}
+
+boost::python::object ScintillaNotificationArgs::py_ne(boost::python::object other) const
+{
+    return boost::python::object(!py_eq(other));
+}
+
+void ScintillaNotificationArgs::py_setitem(boost::python::object key, boost::python::object value)
+{
+    copyOnWrite();
+    if (PyDict_SetItem(m_changedFields, key.ptr(), value.ptr()) < 0)
+	{
+        boost::python::throw_error_already_set();
+	}
+}
+
+void ScintillaNotificationArgs::py_delitem(boost::python::object key)
+{
+    copyOnWrite();
+    if (PyDict_DelItem(m_changedFields, key.ptr()) < 0)
+	{
+        boost::python::throw_error_already_set();
+	}
+}
+
+}
+
+void export_notification_args()
+{
+	//lint -e1793 While calling Symbol: Initializing the implicit object parameter Type (a non-const reference) with a non-lvalue
+	// The class declaration is used as designed, but it messes up Lint.
+	boost::python::class_<NppPythonScript::ScintillaNotificationArgs>("ScintillaNotificationArgs", "The arguments of an editor callback. It can be used as the dict that used to be passed, e.g. args['position']. Changing a key copies the fields into a dict first", boost::python::no_init)
+		.def("__getitem__", &NppPythonScript::ScintillaNotificationArgs::py_getitem)
+		.def("__contains__", &NppPythonScript::ScintillaNotificationArgs::py_contains)
+		.def("__len__", &NppPythonScript::ScintillaNotificationArgs::py_len)
+		.def("__iter__", &NppPythonScript::ScintillaNotificationArgs::py_iter)
+		.def("__setitem__", &NppPythonScript::ScintillaNotificationArgs::py_setitem)
+		.def("__delitem__", &NppPythonScript::ScintillaNotificationArgs::py_delitem)
+		.def("__repr__", &NppPythonScript::ScintillaNotificationArgs::py_repr)
+		.def("__eq__", &NppPythonScript::ScintillaNotificationArgs::py_eq)
+		.def("__ne__", &NppPythonScript::ScintillaNotificationArgs::py_ne)
+		.def("has_key", &NppPythonScript::ScintillaNotificationArgs::py_contains, "Returns True if the notification has the field")
+		.def("get", &NppPythonScript::ScintillaNotificationArgs::py_get, "get(key[, default])\nReturns the field, or default (None if not given) if the notification doesn't have it")
+		.def("get", &NppPythonScript::ScintillaNotificationArgs::py_get_default, "get(key[, default])\nReturns the field, or default (None if not given) if the notification doesn't have it")
+		.def("keys", &NppPythonScript::ScintillaNotificationArgs::py_keys, "Returns a list of the names of the fields the notification has")
+		.def("values", &NppPythonScript::ScintillaNotificationArgs::py_values, "Returns a list of the values of the fields")
+		.def("items", &NppPythonScript::ScintillaNotificationArgs::py_items, "Returns a list of (name, value) tuples for the fields")
+		.def("iterkeys", &NppPythonScript::ScintillaNotificationArgs::py_iter, "Returns an iterator over the names of the fields")
+		.def("itervalues", &NppPythonScript::ScintillaNotificationArgs::py_itervalues, "Returns an iterator over the values of the fields")
+		.def("iteritems", &NppPythonScript::ScintillaNotificationArgs::py_iteritems, "Returns an iterator over (name, value) tuples for the fields")
+		.def("copy", &NppPythonScript::ScintillaNotificationArgs::py_copy, "Returns a new dict of the fields")
+		;
+	//lint +e1793
+}
@@ -0,0 +1,5 @@
+#ifndef SCINTILLANOTIFICATIONARGSPYTHON_20140511_H
+#define SCINTILLANOTIFICATIONARGSPYTHON_20140511_H
+void export_notification_args();
+
+#endif // SCINTILLANOTIFICATIONARGSPYTHON_20140511_H
@@ -6,10 +6,14 @@
 #include "NotepadPython.h"
 #include "PythonConsole.h"
 #include "MatchPython.h"
+#include "ScintillaNotificationArgsPython.h"
 #include "enums.h"
 #include "ArgumentException.h"
 #include "GroupNotFoundException.h"
 #include "NotAllowedInCallbackException.h"
+#include "TextChangedException.h"
+#include "SearchStoppedException.h"
+#include "RegexTooComplexException.h"
 
 namespace NppPythonScript
 {
@@ -26,11 +30,17 @@ BOOST_PYTHON_MODULE(Npp)
 	boost::python::register_exception_translator<ArgumentException>(&translateArgumentException);
 	boost::python::register_exception_translator<GroupNotFoundException>(&translateGroupNotFoundException);
 	boost::python::register_exception_translator<NotAllowedInCallbackException>(&translateNotAllowedInCallbackException);
+	boost::python::register_exception_translator<TextChangedException>(&translateTextChangedException);
+	boost::python::register_exception_translator<SearchStoppedException>(&translateSearchStoppedException);
+	boost::python::register_exception_translator<RegexTooComplexException>(&translateRegexTooComplexException);
 
 	boost::python::class_<ScintillaWrapper, boost::shared_ptr<ScintillaWrapper>, boost::noncopyable >("Editor", boost::python::no_init)
 		.def("write", &ScintillaWrapper::AddText, "Add text to the document at current position (alias for addText).")
 		.def("callbackSync", &ScintillaWrapper::addSyncCallback, "Registers a callback to a Python function when a Scintilla event occurs. See also callback() to register an asynchronous callback. Callbacks are called synchronously with the event, so try not to perform too much work in the event handler.\nCertain operations cannot be performed in a synchronous callback.  setDocPointer, searchInTarget or findText calls are examples.  Scintilla doesn't allow recursively modifying the text, so you can't modify the text in a SCINTILLANOTIFICATION.MODIFIED callback - use a standard Asynchronous callback to do this.\ne.g. editor.callbackSync(my_function, [SCINTILLANOTIFICATION.CHARADDED])")
+		.def("callbackSync", &ScintillaWrapper::addSyncCallbackFilter, boost::python::args("callback", "events", "filter"), "Registers a synchronous callback, as callbackSync(callback, events) does, that is only called for the notifications that match filter. See callback(callback, events, coalesce, filter) for what filter can contain.")
 		.def("callback", &ScintillaWrapper::addAsyncCallback, "Registers a callback to call a Python function synchronously when a Scintilla event occurs. Events are queued up, and run in the order they arrive, one after the other, but asynchronously with the main GUI. See editor.callbackSync() to register a synchronous callback. e.g. editor.callback(my_function, [SCINTILLANOTIFICATION.CHARADDED])")
+		.def("callback", &ScintillaWrapper::addAsyncCallbackCoalesce, boost::python::args("callback", "events", "coalesce"), "Registers an asynchronous callback, as callback(callback, events) does. With coalesce=True, the notifications that arrive while the callback is still waiting to be called are merged into one call: for SCINTILLANOTIFICATION.MODIFIED, position and length cover everything that was changed, linesAdded is the total and modificationType has the flags of all of them; for any other notification, the callback gets the latest one. The count field says how many notifications were merged.")
+		.def("callback", &ScintillaWrapper::addAsyncCallbackFilter, boost::python::args("callback", "events", "coalesce", "filter"), "Registers an asynchronous callback, as callback(callback, events, coalesce) does, that is only called for the notifications that match filter - a dict with any of: modificationType (MODIFICATIONFLAGS, any of which a MODIFIED notification must have), lines ((startLine, endLine), both included, for notifications with a position), minLength (the shortest length a MODIFIED or NEEDSHOWN notification can have) and characters (a string of the characters a CHARADDED notification can be for). The filter is checked before any Python runs, so the notifications it throws away cost almost nothing. e.g. editor.callback(my_function, [SCINTILLANOTIFICATION.MODIFIED], False, {'modificationType': MODIFICATIONFLAGS.INSERTTEXT})")
 		.def("__getitem__", &ScintillaWrapper::GetLine, "Gets a line from the given (zero based) index")
 		.def("__len__", &ScintillaWrapper::GetLength, "Gets the length (number of bytes) in the document")
 		.def("forEachLine", &ScintillaWrapper::forEachLine, "Runs the function passed for each line in the current document.  The function gets passed 3 arguments, the contents of the line, the line number (starting from zero), and the total number of lines.  If the function returns a number, that number is added to the current line number for the next iteration.\nThat way, if you delete the current line, you should return 0, so as to stay on the current physical line.\n\nUnder normal circumstances, you do not need to return anything from the function (i.e. None)\n(Helper function)")
@@ -50,6 +60,10 @@ BOOST_PYTHON_MODULE(Npp)
 		.def("replace", &ScintillaWrapper::replacePlainFlagsStart, boost::python::args("search", "replace", "flags", "startPosition"), "Simple search and replace. Replace 'search' with 'replace' using the given flags.\nFlags are from the re module, and only re.IGNORECASE has an effect. Starts from the given (binary) startPosition")
 		.def("replace", &ScintillaWrapper::replacePlainFlagsStartEnd, boost::python::args("search", "replace", "flags", "startPosition", "endPosition"), "Simple search and replace. Replace 'search' with 'replace' using the given flags.\nFlags are from the re module, and only re.IGNORECASE has an effect. Starts from the given (binary) startPosition, and replaces until the endPosition has been reached.")
 		.def("replace", &ScintillaWrapper::replacePlainFlagsStartEndMaxCount, boost::python::args("search", "replace", "flags", "startPosition", "endPosition", "maxCount"), "Simple search and replace. Replace 'search' with 'replace' using the given flags.\nFlags are from the re module, and only re.IGNORECASE has an effect. Starts from the given (binary) startPosition, replaces until either the endPosition has been reached, or the maxCount of replacements have been performed")
+		.def("replaceMany", &ScintillaWrapper::replaceMany, boost::python::args("mapping"), "Replaces each key of 'mapping' (a dict, or a list of (search, replace) pairs) with its value, in one pass over the document and as one undo action. Where searches overlap, the one that starts first is replaced, and the longest of the ones that start at the same place.")
+		.def("replaceMany", &ScintillaWrapper::replaceManyFlags, boost::python::args("mapping", "flags"), "Replaces each key of 'mapping' (a dict, or a list of (search, replace) pairs) with its value, in one pass over the document and as one undo action.\nFlags are from the re module, and only re.IGNORECASE has an effect. ")
+		.def("replaceMany", &ScintillaWrapper::replaceManyFlagsStart, boost::python::args("mapping", "flags", "startPosition"), "Replaces each key of 'mapping' (a dict, or a list of (search, replace) pairs) with its value, in one pass over the document and as one undo action.\nFlags are from the re module, and only re.IGNORECASE has an effect. Starts from the given (binary) startPosition")
+		.def("replaceMany", &ScintillaWrapper::replaceManyFlagsStartEnd, boost::python::args("mapping", "flags", "startPosition", "endPosition"), "Replaces each key of 'mapping' (a dict, or a list of (search, replace) pairs) with its value, in one pass over the document and as one undo action.\nFlags are from the re module, and only re.IGNORECASE has an effect. Starts from the given (binary) startPosition, and replaces until the endPosition has been reached.")
 		.def("rereplace", &ScintillaWrapper::replaceRegex, boost::python::args("searchRegex", "replace"), "Regular expression search and replace. Replaces 'searchRegex' with 'replace'.  ^ and $ by default match the starts and end of the document.  Use additional flags (re.MULTILINE) to treat ^ and $ per line.\n" 
 		                                                                                                  "The 'replace' parameter can be a python function, that recieves an object similar to a re.Match object.\n"
 																										  "So you can have a function like\n"
@@ -87,8 +101,40 @@ BOOST_PYTHON_MODULE(Npp)
 																										  "   def myIncrement(m):\n"
 																										  "       return int(m.group(1)) + 1\n\n"
 																										  "And call rereplace('([0-9]+)', myIncrement) and it will increment all the integers.")
-        .def("pyreplace", boost::python::raw_function(&deprecated_replace_function), "Deprecated in this version of PythonScript for Notepad++. Use the new rereplace() instead")
-        .def("pymlreplace", boost::python::raw_function(&deprecated_replace_function), "Deprecated in this version of PythonScript for Notepad++. Use the new rereplace() instead")
+        .def("pyreplace", &ScintillaWrapper::pyreplaceNoFlagsNoCount, boost::python::args("search", "replace"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, and replaces the matches. No match runs over a line ending, and ^ and $ match at the start and end of each line. count is the most matches to replace, 0 for all. flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.RE_INCLUDELINEENDINGS to make each line's ending part of the line. editor.RE_PYTHONENGINE runs the re module from Python on each line, as before version 1.0, as do re flags such as re.VERBOSE that only the re module has")
+        .def("pyreplace", &ScintillaWrapper::pyreplaceNoFlags, boost::python::args("search", "replace", "count"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, and replaces the matches. No match runs over a line ending, and ^ and $ match at the start and end of each line. count is the most matches to replace, 0 for all. flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.RE_INCLUDELINEENDINGS to make each line's ending part of the line. editor.RE_PYTHONENGINE runs the re module from Python on each line, as before version 1.0, as do re flags such as re.VERBOSE that only the re module has")
+        .def("pyreplace", &ScintillaWrapper::pyreplaceNoStartEnd, boost::python::args("search", "replace", "count", "flags"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, and replaces the matches. No match runs over a line ending, and ^ and $ match at the start and end of each line. count is the most matches to replace, 0 for all. flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.RE_INCLUDELINEENDINGS to make each line's ending part of the line. editor.RE_PYTHONENGINE runs the re module from Python on each line, as before version 1.0, as do re flags such as re.VERBOSE that only the re module has")
+        .def("pyreplace", &ScintillaWrapper::pyreplaceNoEnd, boost::python::args("search", "replace", "count", "flags", "startLine"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, and replaces the matches. No match runs over a line ending, and ^ and $ match at the start and end of each line. count is the most matches to replace, 0 for all. flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.RE_INCLUDELINEENDINGS to make each line's ending part of the line. editor.RE_PYTHONENGINE runs the re module from Python on each line, as before version 1.0, as do re flags such as re.VERBOSE that only the re module has")
+        .def("pyreplace", &ScintillaWrapper::pyreplace, boost::python::args("search", "replace", "count", "flags", "startLine", "endLine"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, and replaces the matches. No match runs over a line ending, and ^ and $ match at the start and end of each line. count is the most matches to replace, 0 for all. flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.RE_INCLUDELINEENDINGS to make each line's ending part of the line. editor.RE_PYTHONENGINE runs the re module from Python on each line, as before version 1.0, as do re flags such as re.VERBOSE that only the re module has")
+        .def("pysearch", &ScintillaWrapper::pysearchNoFlags, boost::python::args("search", "handlerFunction"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, as pyreplace() does, and calls the handlerFunction with the line number and the match for each match. flags are as for pyreplace()")
+        .def("pysearch", &ScintillaWrapper::pysearchNoStartEnd, boost::python::args("search", "handlerFunction", "flags"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, as pyreplace() does, and calls the handlerFunction with the line number and the match for each match. flags are as for pyreplace()")
+        .def("pysearch", &ScintillaWrapper::pysearchNoEnd, boost::python::args("search", "handlerFunction", "flags", "startLine"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, as pyreplace() does, and calls the handlerFunction with the line number and the match for each match. flags are as for pyreplace()")
+        .def("pysearch", &ScintillaWrapper::pysearch, boost::python::args("search", "handlerFunction", "flags", "startLine", "endLine"), "Searches each line from startLine to endLine (all of them by default) on its own for the regular expression, as pyreplace() does, and calls the handlerFunction with the line number and the match for each match. flags are as for pyreplace()")
+        .setattr("RE_INCLUDELINEENDINGS", static_cast<int>(ScintillaWrapper::RE_INCLUDELINEENDINGS))
+        .setattr("RE_PYTHONENGINE", static_cast<int>(ScintillaWrapper::RE_PYTHONENGINE))
+        .def("pymlreplace", &ScintillaWrapper::pymlreplaceNoFlagsNoCount, boost::python::args("search", "replace"), "Searches the document (or from startPosition to endPosition) as one string for the regular expression, with the re module and re.MULTILINE, and replaces the matches with match.expand(replace). count is the most matches to replace, 0 for all. All the matches are found first, and then replaced together as one undo action.")
+        .def("pymlreplace", &ScintillaWrapper::pymlreplaceNoFlags, boost::python::args("search", "replace", "count"), "Searches the document (or from startPosition to endPosition) as one string for the regular expression, with the re module and re.MULTILINE, and replaces the matches with match.expand(replace). count is the most matches to replace, 0 for all. All the matches are found first, and then replaced together as one undo action.")
+        .def("pymlreplace", &ScintillaWrapper::pymlreplaceNoStartEnd, boost::python::args("search", "replace", "count", "flags"), "Searches the document (or from startPosition to endPosition) as one string for the regular expression, with the re module and re.MULTILINE, and replaces the matches with match.expand(replace). count is the most matches to replace, 0 for all. All the matches are found first, and then replaced together as one undo action.")
+        .def("pymlreplace", &ScintillaWrapper::pymlreplaceNoEnd, boost::python::args("search", "replace", "count", "flags", "startPosition"), "Searches the document (or from startPosition to endPosition) as one string for the regular expression, with the re module and re.MULTILINE, and replaces the matches with match.expand(replace). count is the most matches to replace, 0 for all. All the matches are found first, and then replaced together as one undo action.")
+        .def("pymlreplace", &ScintillaWrapper::pymlreplace, boost::python::args("search", "replace", "count", "flags", "startPosition", "endPosition"), "Searches the document (or from startPosition to endPosition) as one string for the regular expression, with the re module and re.MULTILINE, and replaces the matches with match.expand(replace). count is the most matches to replace, 0 for all. All the matches are found first, and then replaced together as one undo action.")
+		.def("clearRegexCache", &ScintillaWrapper::clearRegexCache, "Clears the cache of compiled regular expressions used by search(), research(), replace() and rereplace(), and resets the cache counters.")
+		.def("getRegexCacheStats", &ScintillaWrapper::getRegexCacheStats, "Returns a dict with the counters of the compiled regular expression cache: hits, misses, evictions, size (number of cached expressions) and capacity.")
+		.def("getLastSearchStats", &ScintillaWrapper::getLastSearchStats, "Returns a dict with the counters of the last search(), research(), replace() or rereplace(): prefilterUsed, prefilterLiteral, literalCandidates, regexRuns, matches, parallelChunks, stopped, stoppedAt and slowestRegexRun.")
+		.def("setBulkReplaceThreshold", &ScintillaWrapper::setBulkReplaceThreshold, boost::python::args("threshold"), "Sets the number of matches from which replace() and rereplace() rebuild the text in one go, rather than replacing each match separately. 0 always replaces each match separately.")
+		.def("getBulkReplaceThreshold", &ScintillaWrapper::getBulkReplaceThreshold, "Returns the number of matches from which replace() and rereplace() rebuild the text in one go. See setBulkReplaceThreshold()")
+		.def("setParallelSearchThreshold", &ScintillaWrapper::setParallelSearchThreshold, boost::python::args("threshold"), "Sets the number of bytes from which research() searches the document on all the processors, if the expression can't match across lines. 0 always searches on one thread.")
+		.def("getParallelSearchThreshold", &ScintillaWrapper::getParallelSearchThreshold, "Returns the number of bytes from which research() searches on all the processors. See setParallelSearchThreshold()")
+		.def("setSearchTimeLimit", &ScintillaWrapper::setSearchTimeLimit, boost::python::args("milliseconds"), "Sets the longest a search or replace can run for, in milliseconds, before it is stopped with a RuntimeError. 0 (the default) is no limit.")
+		.def("getSearchTimeLimit", &ScintillaWrapper::getSearchTimeLimit, "Returns the longest a search or replace can run for, in milliseconds. See setSearchTimeLimit()")
+		.def("setRegexStepLimit", &ScintillaWrapper::setRegexStepLimit, boost::python::args("steps"), "Sets how many steps one run of the regular expression engine can take before it gives up with a RuntimeError naming the expression, e.g. for catastrophic backtracking. The default is 10000000, or the REGEXSTEPLIMIT setting in PythonScriptStartup.cnf.")
+		.def("getRegexStepLimit", &ScintillaWrapper::getRegexStepLimit, "Returns how many steps one run of the regular expression engine can take. See setRegexStepLimit()")
+		.def("getRegexComplexityStats", &ScintillaWrapper::getRegexComplexityStats, "Returns a dict with stepLimit, limitExceeded (the number of runs of the regular expression engine that gave up), lastExceededPattern, slowestRun (the longest one run has taken, in milliseconds) and slowestRunPattern.")
+		.def("setCallbackQueueOverflow", &ScintillaWrapper::setCallbackQueueOverflow, boost::python::args("overflow"), "Sets what happens when the queue of asynchronous callbacks is full: editor.QUEUE_DROPOLDEST (the default) drops the oldest notification, and editor.QUEUE_DROPNEWEST drops the new one.")
+		.def("getCallbackQueueOverflow", &ScintillaWrapper::getCallbackQueueOverflow, "Returns what happens when the queue of asynchronous callbacks is full. See setCallbackQueueOverflow()")
+		.def("getCallbackQueueStats", &ScintillaWrapper::getCallbackQueueStats, "Returns a dict with the counters of the queue of asynchronous callbacks: capacity, pushed, droppedOldest and droppedNewest.")
+		.def("getCallbackStats", &ScintillaWrapper::getCallbackStats, boost::python::args("callback"), "Returns a dict with the number of notifications the callback function was called for (delivered), and the number its filter threw away (filtered), for all the events it is registered for.")
+        .setattr("QUEUE_DROPOLDEST", static_cast<int>(ScintillaWrapper::QUEUE_DROPOLDEST))
+        .setattr("QUEUE_DROPNEWEST", static_cast<int>(ScintillaWrapper::QUEUE_DROPNEWEST))
 		.def("getWord", &ScintillaWrapper::getWord, "getWord([position[, useOnlyWordChars]])\nGets the word at position.  If position is not given or None, the current caret position is used.\nuseOnlyWordChars is a bool that is passed to Scintilla - see Scintilla rules on what is match. If not given or None, it is assumed to be true.")
 		.def("getWord", &ScintillaWrapper::getWordNoFlags, "getWord([position[, useOnlyWordChars]])\nGets the word at position.  If position is not given or None, the current caret position is used.\nuseOnlyWordChars is a bool that is passed to Scintilla - see Scintilla rules on what is match. If not given or None, it is assumed to be true.")
 		.def("getWord", &ScintillaWrapper::getCurrentWord, "getWord([position[, useOnlyWordChars]])\nGets the word at position.  If position is not given or None, the current caret position is used.\nuseOnlyWordChars is a bool that is passed to Scintilla - see Scintilla rules on what is match. If not given or None, it is assumed to be true.")
@@ -105,6 +151,28 @@ BOOST_PYTHON_MODULE(Npp)
 	    .def("research", &ScintillaWrapper::searchRegexFlagsStart, boost::python::args("search", "handlerFunction", "flags", "startPosition"), "Searches the document from the given startPosition for given search regular expression, and calls the handlerFunction with each match. The handler function receives a single match parameter, which is similar to a re.MatchObject object. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
 	    .def("research", &ScintillaWrapper::searchRegexFlagsStartEnd, boost::python::args("search", "handlerFunction", "flags", "startPosition", "endPosition"), "Searches the document from the given startPosition to the given endPosition for given search regular expression, and calls the handlerFunction with each match. The handler function receives a single match parameter, which is similar to a re.MatchObject object. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
 	    .def("research", &ScintillaWrapper::searchRegexFlagsStartEndCount, boost::python::args("search", "handlerFunction", "flags", "startPosition", "endPosition", "maxCount"), "Searches the document from the given startPosition to the given endPosition for given search regular expression, and calls the handlerFunction with each match. The search ends when maxCount matches have been located.  The handler function receives a single match parameter, which is similar to a re.MatchObject object. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
+	    .def("rsearch", &ScintillaWrapper::rsearch, boost::python::args("search", "handlerFunction"), "Searches the document backwards from the end for given search regular expression, and calls the handlerFunction with each match, last first. The matches are the same as research() finds.")
+	    .def("rsearch", &ScintillaWrapper::rsearchFlags, boost::python::args("search", "handlerFunction", "flags"), "Searches the document backwards from the end for given search regular expression, and calls the handlerFunction with each match, last first. The matches are the same as research() finds.")
+	    .def("rsearch", &ScintillaWrapper::rsearchFlagsStart, boost::python::args("search", "handlerFunction", "flags", "startPosition"), "Searches the document backwards from the end to the given startPosition for given search regular expression, and calls the handlerFunction with each match, last first. The matches are the same as research() finds.")
+	    .def("rsearch", &ScintillaWrapper::rsearchFlagsStartEnd, boost::python::args("search", "handlerFunction", "flags", "startPosition", "endPosition"), "Searches the document backwards from the given endPosition to the given startPosition for given search regular expression, and calls the handlerFunction with each match, last first. The matches are the same as research() finds.")
+	    .def("rsearch", &ScintillaWrapper::rsearchFlagsStartEndCount, boost::python::args("search", "handlerFunction", "flags", "startPosition", "endPosition", "maxCount"), "Searches the document backwards from the given endPosition to the given startPosition for given search regular expression, and calls the handlerFunction with each match, last first. The search ends when maxCount matches have been located, so maxCount=1 finds the match before endPosition (e.g. the caret).")
+	    .def("count", &ScintillaWrapper::countPlain, boost::python::args("search"), "Returns the number of times the given search text occurs in the document.")
+	    .def("count", &ScintillaWrapper::countPlainFlags, boost::python::args("search", "flags"), "Returns the number of times the given search text occurs in the document. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
+	    .def("count", &ScintillaWrapper::countPlainFlagsStart, boost::python::args("search", "flags", "startPosition"), "Returns the number of times the given search text occurs in the document from the given startPosition. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
+	    .def("count", &ScintillaWrapper::countPlainFlagsStartEnd, boost::python::args("search", "flags", "startPosition", "endPosition"), "Returns the number of times the given search text occurs in the document between the given startPosition and endPosition. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
+	    .def("recount", &ScintillaWrapper::countRegex, boost::python::args("search"), "Returns the number of matches of the given regular expression in the document, without calling anything for each match.")
+	    .def("recount", &ScintillaWrapper::countRegexFlags, boost::python::args("search", "flags"), "Returns the number of matches of the given regular expression in the document. Flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.WHOLEDOC.")
+	    .def("recount", &ScintillaWrapper::countRegexFlagsStart, boost::python::args("search", "flags", "startPosition"), "Returns the number of matches of the given regular expression in the document from the given startPosition. Flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.WHOLEDOC.")
+	    .def("recount", &ScintillaWrapper::countRegexFlagsStartEnd, boost::python::args("search", "flags", "startPosition", "endPosition"), "Returns the number of matches of the given regular expression in the document between the given startPosition and endPosition. Flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.WHOLEDOC.")
+	    .def("searchMany", &ScintillaWrapper::searchMany, boost::python::args("keywords"), "Searches the document for all the given keywords (plain text) in one pass, and returns a list of (keywordIndex, start, end) for each occurrence.")
+	    .def("searchMany", &ScintillaWrapper::searchManyHandler, boost::python::args("keywords", "handlerFunction"), "Searches the document for all the given keywords (plain text) in one pass, and calls the handlerFunction with the index of the keyword and the match for each occurrence. If handlerFunction is None, returns a list of (keywordIndex, start, end) instead.")
+	    .def("searchMany", &ScintillaWrapper::searchManyHandlerFlags, boost::python::args("keywords", "handlerFunction", "flags"), "Searches the document for all the given keywords (plain text) in one pass, and calls the handlerFunction with the index of the keyword and the match for each occurrence. If handlerFunction is None, returns a list of (keywordIndex, start, end) instead. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
+	    .def("searchMany", &ScintillaWrapper::searchManyHandlerFlagsStart, boost::python::args("keywords", "handlerFunction", "flags", "startPosition"), "Searches the document from the given startPosition for all the given keywords (plain text) in one pass. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
+	    .def("searchMany", &ScintillaWrapper::searchManyHandlerFlagsStartEnd, boost::python::args("keywords", "handlerFunction", "flags", "startPosition", "endPosition"), "Searches the document between the given startPosition and endPosition for all the given keywords (plain text) in one pass. Flags are the flags from the re module, specifically only re.IGNORECASE has an effect here.")
+	    .def("finditer", &ScintillaWrapper::findIter, boost::python::args("search"), "Returns an iterator over the matches of the given regular expression in the document. The matches are found one at a time, as they are needed. The iterator raises a RuntimeError if the document is changed while it is in use.")
+	    .def("finditer", &ScintillaWrapper::findIterFlags, boost::python::args("search", "flags"), "Returns an iterator over the matches of the given regular expression in the document. Flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.WHOLEDOC.")
+	    .def("finditer", &ScintillaWrapper::findIterFlagsStart, boost::python::args("search", "flags", "startPosition"), "Returns an iterator over the matches of the given regular expression in the document from the given startPosition. Flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.WHOLEDOC.")
+	    .def("finditer", &ScintillaWrapper::findIterFlagsStartEnd, boost::python::args("search", "flags", "startPosition", "endPosition"), "Returns an iterator over the matches of the given regular expression in the document between the given startPosition and endPosition. Flags are the flags from the re module (re.IGNORECASE, re.DOTALL), and editor.WHOLEDOC.")
 		/* Between the autogenerated comments is, surprise, autogenerated
 		 * Do not edit the contents between these comments, 
 		 * edit "CreateWrapper.py" instead, which does the generation 
@@ -776,6 +844,7 @@ BOOST_PYTHON_MODULE(Npp)
 	export_notepad();
 	export_console();
     export_match();
+    export_notification_args();
 }
 
 void preinitScintillaModule()
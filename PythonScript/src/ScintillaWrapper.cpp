@@ -4,14 +4,20 @@
 #include "ScintillaCells.h"
 #include "ScintillaWrapper.h"
 #include "Replacer.h"
+#include "ParallelSearch.h"
+#include "ReverseSearch.h"
+#include "RegexCache.h"
 #include "Match.h"
 #include "ReplacementContainer.h"
+#include "ReplacementBatch.h"
 #include "NotSupportedException.h"
 #include "ArgumentException.h"
+#include "SearchStoppedException.h"
 #include "PythonScript/NppPythonScript.h"
 #include "MutexHolder.h"
 #include "GILManager.h"
 #include "CallbackExecArgs.h"
+#include "ScintillaNotificationArgs.h"
 #include "ScintillaCallback.h"
 #include "MainThread.h"
 #include "MutexHolder.h"
@@ -26,8 +32,55 @@ namespace NppPythonScript
 	}
 
 
+volatile LONG ScintillaWrapper::s_modificationCount = 0;
+
+/** The state of a document when a findIter() search started.  Any insertion or deletion since (in either view) counts as a change,
+ *  as does the text moving or changing length, which covers edits made with the modification notifications turned off.
+ */
+class DocumentSnapshot : public TextSnapshot
+{
+public:
+    explicit DocumentSnapshot(HWND handle)
+		: m_handle(handle),
+          m_modificationCount(ScintillaWrapper::getModificationCount())
+	{
+        read(&m_text, &m_length);
+	}
+
+    virtual bool isUnchanged()
+	{
+        if (m_modificationCount != ScintillaWrapper::getModificationCount())
+		{
+            return false;
+		}
+
+        const char *text;
+        int length;
+        read(&text, &length);
+        return m_text == text && m_length == length;
+	}
+
+    const char *text() const { return m_text; }
+    int length() const { return m_length; }
+
+private:
+    void read(const char **text, int *length)
+	{
+        // As in callScintilla(), the GIL is released in case Scintilla needs to run a callback before it answers
+        GILRelease release;
+        *text = reinterpret_cast<const char *>(::SendMessage(m_handle, SCI_GETCHARACTERPOINTER, 0, 0));
+        *length = static_cast<int>(::SendMessage(m_handle, SCI_GETLENGTH, 0, 0));
+	}
+
+    const HWND m_handle;
+    const LONG m_modificationCount;
+    const char *m_text;
+    int m_length;
+};
+
+
 ScintillaWrapper::ScintillaWrapper(const HWND handle, const HWND notepadHandle)
-	: PyProducerConsumer<CallbackExecArgs>(),
+	: PyProducerConsumer<CallbackExecArgs>(DEFAULT_QUEUE_CAPACITY, NppPythonScript::QUEUE_DROP_OLDEST),
 	  m_handle(handle),
       m_hNotepad(notepadHandle),
 	  m_notificationsEnabled(false),
@@ -41,15 +94,6 @@ ScintillaWrapper::~ScintillaWrapper()
 	m_handle = NULL;
 }
 
-
-boost::python::object deprecated_replace_function(boost::python::tuple /* args */, boost::python::dict /* kwargs */)
-{
-    throw NppPythonScript::NotSupportedException("The pyreplace(), pymlreplace(), pysearch() and pymlsearch() functions have been deprecated.\n"
-		"The new replace(), rereplace(), search(), and research() functions have all the same functionality, but are faster, more reliable and have better support for unicode.");
-}
-
-
-
 std::string ScintillaWrapper::getStringFromObject(boost::python::object o)
 {
     std::string raw;
@@ -69,233 +113,110 @@ std::string ScintillaWrapper::getStringFromObject(boost::python::object o)
 
 void ScintillaWrapper::notify(SCNotification *notifyCode)
 {
+    // Counted whether there are callbacks or not, and without the GIL, so that a findIter() notices every edit
+    if (SCN_MODIFIED == notifyCode->nmhdr.code && (notifyCode->modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT)))
+	{
+        InterlockedIncrement(&s_modificationCount);
+	}
+
 	if (!m_notificationsEnabled)
 		return;
-    
-	{
-		NppPythonScript::GILLock gilLock;
 
+    // Most notifications (SCN_UPDATEUI, SCN_PAINTED...) have no callbacks, so don't claim the GIL and the mutex just to find that out
+    if (!m_subscriptions.isSubscribed(notifyCode->nmhdr.code))
+		return;
+
+    // The callbacks' filters are checked before the GIL is taken, so a notification they all throw away costs no Python at all
+    std::vector<boost::shared_ptr<NppPythonScript::ScintillaCallback> > callbacks;
+	{
         NppPythonScript::MutexHolder hold(m_callbackMutex);
-        
 
+        int line = -1;
+        bool lineKnown = false;
 		std::pair<callbackT::iterator, callbackT::iterator> callbackIter 
 			= m_callbacks.equal_range(notifyCode->nmhdr.code);
-
-		if (callbackIter.first != callbackIter.second)
+        for (; callbackIter.first != callbackIter.second; ++callbackIter.first)
 		{
-			std::shared_ptr<CallbackExecArgs> callbackExec(new CallbackExecArgs());
-            std::shared_ptr<CallbackExecArgs> asyncCallbackExec(new CallbackExecArgs());
-            boost::python::dict params;
+            NppPythonScript::ScintillaCallback& callback = *callbackIter.first->second;
+            if (!lineKnown && callback.filter().needsLine(notifyCode))
+			{
+                line = static_cast<int>(callScintilla(SCI_LINEFROMPOSITION, notifyCode->position));
+                lineKnown = true;
+			}
 
-			// Create the parameters for the callback
-			params["code"] = notifyCode->nmhdr.code;
+            if (callback.filter().matches(notifyCode, line))
+			{
+                callback.countDelivered();
+                callbacks.push_back(callbackIter.first->second);
+			}
+            else
+			{
+                callback.countFiltered();
+			}
+		}
+	}
 
+    if (callbacks.empty())
+		return;
+    
+	{
+		NppPythonScript::GILLock gilLock;
 
-			switch(notifyCode->nmhdr.code)
-			{
+        NppPythonScript::MutexHolder hold(m_callbackMutex);
 
-			case SCN_STYLENEEDED:
-				params["position"] = notifyCode->position;
-				break;
-
-			case SCN_CHARADDED:
-				params["ch"] = notifyCode->ch;
-				break;
-
-			case SCN_SAVEPOINTREACHED:
-				break;
-
-			case SCN_SAVEPOINTLEFT:
-				break;
-
-			case SCN_MODIFYATTEMPTRO:
-				break;
-
-			case SCN_KEY:
-				params["ch"] = notifyCode->ch;
-				params["modifiers"] = notifyCode->modifiers;
-				break;
-
-			case SCN_DOUBLECLICK:
-				params["position"] = notifyCode->position;
-				params["modifiers"] = notifyCode->modifiers;
-				params["line"] = notifyCode->line;
-				break;
-
-			case SCN_UPDATEUI:
-				params["updated"] = notifyCode->updated;
-				break;
-
-			case SCN_MODIFIED:
-				params["position"] = notifyCode->position;
-				params["modificationType"] = notifyCode->modificationType;
-                if (notifyCode->text)
-                {
-					// notifyCode->text is not null terminated
-				    std::string text(notifyCode->text, notifyCode->length);
-				    params["text"] = text.c_str();
-				}
-				else
-				{
-					params["text"] = "";
-				}
+		std::shared_ptr<CallbackExecArgs> callbackExec(new CallbackExecArgs());
+        std::shared_ptr<CallbackExecArgs> asyncCallbackExec(new CallbackExecArgs());
+        // The same args are passed to all the callbacks, and only make Python objects for the fields that are read
+        NppPythonScript::ScintillaNotificationArgs notification(notifyCode);
+        boost::python::object params(notification);
+        NppPythonScript::ScintillaNotificationArgs& heldArgs = boost::python::extract<NppPythonScript::ScintillaNotificationArgs&>(params);
 
-				params["length"] = notifyCode->length;
-				params["linesAdded"] = notifyCode->linesAdded;
-				params["line"] = notifyCode->line;
-				params["foldLevelNow"] = notifyCode->foldLevelNow;
-				params["foldLevelPrev"] = notifyCode->foldLevelPrev;
-				if (notifyCode->modificationType & SC_MOD_CHANGEANNOTATION)
-				{
-					params["annotationLinesAdded"] = notifyCode->annotationLinesAdded;
-				}
-				if (notifyCode->modificationType & SC_MOD_CONTAINER)
-				{
-					params["token"] = notifyCode->token;
-				}
-                params["token"] = notifyCode->token;
-                params["annotationLinesAdded"] = notifyCode->annotationLinesAdded;
-				break;
-
-			case SCN_MACRORECORD:
-				params["message"] = notifyCode->message;
-				params["wParam"] = notifyCode->wParam;
-				params["lParam"] = notifyCode->lParam;
-				break;
-
-			case SCN_MARGINCLICK:
-				params["margin"] = notifyCode->margin;
-                params["position"] = notifyCode->position;
-                params["modifiers"] = notifyCode->modifiers;
-   				break;
-
-			case SCN_NEEDSHOWN:
-                params["position"] = notifyCode->position;
-                params["length"] = notifyCode->length;
-				break;
-
-			case SCN_PAINTED:
-				break;
-
-			case SCN_USERLISTSELECTION:
-				params["text"] = notifyCode->text;
-				params["listType"] = notifyCode->listType;
-                params["position"] = notifyCode->position;
-				break;
-
-			case SCN_URIDROPPED:
-                params["text"] = notifyCode->text;
-				break;
-
-			case SCN_DWELLSTART:
-				params["position"] = notifyCode->position;
-				params["x"] = notifyCode->x;
-				params["y"] = notifyCode->y;
-				break;
-
-			case SCN_DWELLEND:
-				params["position"] = notifyCode->position;
-				params["x"] = notifyCode->x;
-				params["y"] = notifyCode->y;
-				break;
-
-			case SCN_ZOOM:
-				break;
-
-			case SCN_HOTSPOTCLICK:
-			case SCN_HOTSPOTDOUBLECLICK:
-			case SCN_HOTSPOTRELEASECLICK:
-				params["position"] = notifyCode->position;
-				params["modifiers"] = notifyCode->modifiers;
-				break;
-
-			case SCN_INDICATORCLICK:
-			case SCN_INDICATORRELEASE:
-				params["position"] = notifyCode->position;
-				params["modifiers"] = notifyCode->modifiers;
-				break;
-
-			case SCN_CALLTIPCLICK:
-				params["position"] = notifyCode->position;
-				break;
-
-			case SCN_AUTOCSELECTION:
-				params["text"] = notifyCode->text;
-                params["position"] = notifyCode->position;
-				break;
-
-			case SCN_AUTOCCANCELLED:
-				break;
-
-			case SCN_AUTOCCHARDELETED:
-				break;
-
-			case SCN_FOCUSIN:
-			case SCN_FOCUSOUT:
-                break;
-
-			default:
-				// Unknown notification, so just fill in all the parameters.
-				params["idFrom"] = notifyCode->nmhdr.idFrom;
-				params["hwndFrom"] = notifyCode->nmhdr.hwndFrom;
-				params["position"] = notifyCode->position;
-				params["modificationType"] = notifyCode->modificationType;
-				if (notifyCode->text) 
-				{
-					// notifyCode->text is not null terminated
-				    std::string text(notifyCode->text, notifyCode->length);
-				    params["text"] = text.c_str();
-				}
-				params["length"] = notifyCode->length;
-				params["linesAdded"] = notifyCode->linesAdded;
-				params["line"] = notifyCode->line;
-				params["foldLevelNow"] = notifyCode->foldLevelNow;
-				params["foldLevelPrev"] = notifyCode->foldLevelPrev;
-				params["annotationLinesAdded"] = notifyCode->annotationLinesAdded;
-				params["listType"] = notifyCode->listType;
-				params["message"] = notifyCode->message;
-				params["wParam"] = notifyCode->wParam;
-				params["lParam"] = notifyCode->lParam;
-				params["modifiers"] = notifyCode->modifiers;
-				params["token"] = notifyCode->token;
-				params["x"] = notifyCode->x;
-				params["y"] = notifyCode->y;
-				break;
+        bool hasSyncCallbacks = false;
+        bool hasAsyncCallbacks = false;
+        for (size_t index = 0; index < callbacks.size(); ++index)
+		{
+            NppPythonScript::ScintillaCallback& callback = *callbacks[index];
+            if (callback.coalesce())
+			{
+                coalesceCallback(callback, notification);
 			}
-			
-            bool hasSyncCallbacks = false;
-            bool hasAsyncCallbacks = false;
-			while (callbackIter.first != callbackIter.second)
+            else if (callback.isAsync())
 			{
-                if (callbackIter.first->second->isAsync())
-				{
-				    asyncCallbackExec->addCallback(callbackIter.first->second->getCallback());
-                    hasAsyncCallbacks = true;
-				}
-				else
-				{
-                    callbackExec->addCallback(callbackIter.first->second->getCallback());
-                    hasSyncCallbacks = true;
-				}
-                ++callbackIter.first;
+                asyncCallbackExec->addCallback(callback.getCallback());
+                hasAsyncCallbacks = true;
 			}
-            
-            if (hasAsyncCallbacks)
+            else
 			{
-                asyncCallbackExec->setParams(params);
-		        DEBUG_TRACE(L"Scintilla async callback\n");
-			    produce(asyncCallbackExec);
+                callbackExec->addCallback(callback.getCallback());
+                hasSyncCallbacks = true;
 			}
+		}
+
+        if (hasAsyncCallbacks)
+		{
+            // The queued call runs after notifyCode has gone
+            heldArgs.ownText();
+            asyncCallbackExec->setParams(params);
+            DEBUG_TRACE(L"Scintilla async callback\n");
+            produce(asyncCallbackExec);
+		}
+
+        if (hasSyncCallbacks)
+		{
+            callbackExec->setParams(params);
+            DEBUG_TRACE(L"Scintilla Sync callback\n");
+            runCallbacks(callbackExec);
+            callbackExec.reset();
 
-            if (hasSyncCallbacks)
+            // Only a callback that kept the args (or an exception that refers to them) leaves another reference
+            if (Py_REFCNT(params.ptr()) > 1)
 			{
-                callbackExec->setParams(params);
-                DEBUG_TRACE(L"Scintilla Sync callback\n");
-                runCallbacks(callbackExec);
+                heldArgs.ownText();
 			}
-
 		}
-       
+
+        // A callback that was cleared since the filters were checked is deleted here, while the GIL is held
+        callbacks.clear();
 	}
 }
 
@@ -304,6 +225,7 @@ void ScintillaWrapper::consume(std::shared_ptr<CallbackExecArgs> args)
 {
 	NppPythonScript::GILLock gilLock;
    
+    args->setDispatched();
     runCallbacks(args);
     // Clear the callbackExecArgs and delete all objects whilst we still have the GIL
     args.reset();
@@ -350,12 +272,183 @@ bool ScintillaWrapper::addAsyncCallback(PyObject* callback, boost::python::list
     return addCallbackImpl(callback, events, true);
 }
 
+bool ScintillaWrapper::addAsyncCallbackCoalesce(PyObject* callback, boost::python::list events, bool coalesce)
+{
+    return addCallbackImpl(callback, events, true, coalesce);
+}
+
+bool ScintillaWrapper::addSyncCallbackFilter(PyObject* callback, boost::python::list events, boost::python::object filter)
+{
+    return addCallbackImpl(callback, events, false, false, filter);
+}
+
+bool ScintillaWrapper::addAsyncCallbackFilter(PyObject* callback, boost::python::list events, bool coalesce, boost::python::object filter)
+{
+    return addCallbackImpl(callback, events, true, coalesce, filter);
+}
+
+/** Makes the filter from a dict of its parts (None for no filter):
+ *   - modificationType: the SC_MOD_* flags, any of which an SCN_MODIFIED must have
+ *   - lines: (startLine, endLine), both included
+ *   - minLength: the shortest length an SCN_MODIFIED or SCN_NEEDSHOWN can have
+ *   - characters: a string (or list of character codes) of the characters an SCN_CHARADDED can be for
+ */
+NppPythonScript::NotificationFilter ScintillaWrapper::makeNotificationFilter(boost::python::object filter)
+{
+    NppPythonScript::NotificationFilter notificationFilter;
+    if (filter.is_none())
+	{
+        return notificationFilter;
+	}
+
+    boost::python::extract<boost::python::dict> filterDict(filter);
+    if (!filterDict.check())
+	{
+        throw NppPythonScript::ArgumentException("filter must be a dict (or None)");
+	}
+
+    boost::python::list items = filterDict().items();
+    size_t itemCount = _len(items);
+    for (idx_t index = 0; index < itemCount; ++index)
+	{
+        std::string name = boost::python::extract<std::string>(items[index][0]);
+        boost::python::object value = items[index][1];
+        if ("modificationType" == name)
+		{
+            notificationFilter.setModificationTypes(boost::python::extract<int>(value));
+		}
+        else if ("lines" == name)
+		{
+            if (_len(value) != 2)
+			{
+                throw NppPythonScript::ArgumentException("lines must be (startLine, endLine)");
+			}
+            int startLine = boost::python::extract<int>(value[0]);
+            int endLine = boost::python::extract<int>(value[1]);
+            if (startLine < 0 || endLine < startLine)
+			{
+                throw NppPythonScript::ArgumentException("lines must be (startLine, endLine), with 0 <= startLine <= endLine");
+			}
+            notificationFilter.setLines(startLine, endLine);
+		}
+        else if ("minLength" == name)
+		{
+            int minLength = boost::python::extract<int>(value);
+            if (minLength < 0)
+			{
+                throw NppPythonScript::ArgumentException("minLength cannot be negative");
+			}
+            notificationFilter.setMinLength(minLength);
+		}
+        else if ("characters" == name)
+		{
+            std::vector<int> characters;
+            if (PyUnicode_Check(value.ptr()))
+			{
+                // SCN_CHARADDED has the code point of the character in a UTF-8 document.  Py_UNICODE is UTF-16 on Windows.
+                const Py_UNICODE *unicode = PyUnicode_AS_UNICODE(value.ptr());
+                const Py_ssize_t unicodeLength = PyUnicode_GET_SIZE(value.ptr());
+                for (Py_ssize_t character = 0; character < unicodeLength; ++character)
+				{
+                    int codePoint = static_cast<int>(unicode[character]);
+                    if (codePoint >= 0xD800 && codePoint < 0xDC00 && character + 1 < unicodeLength 
+                        && unicode[character + 1] >= 0xDC00 && unicode[character + 1] < 0xE000)
+					{
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (unicode[character + 1] - 0xDC00);
+                        ++character;
+					}
+                    characters.push_back(codePoint);
+				}
+			}
+            else if (PyString_Check(value.ptr()))
+			{
+                std::string bytes(boost::python::extract<const char *>(value), _len(value));
+                for (size_t character = 0; character < bytes.size(); ++character)
+				{
+                    characters.push_back(static_cast<unsigned char>(bytes[character]));
+				}
+			}
+            else
+			{
+                size_t characterCount = _len(value);
+                for (idx_t character = 0; character < characterCount; ++character)
+				{
+                    characters.push_back(boost::python::extract<int>(value[character]));
+				}
+			}
+
+            if (characters.empty())
+			{
+                throw NppPythonScript::ArgumentException("characters cannot be empty");
+			}
+            notificationFilter.setCharacters(characters);
+		}
+        else
+		{
+            throw NppPythonScript::ArgumentException(("unknown filter field '" + name + "' - use modificationType, lines, minLength or characters").c_str());
+		}
+	}
+    return notificationFilter;
+}
+
+/** Merges the notification into the coalescing callback's call that is waiting in the queue, or queues a new call
+ *  if there isn't one.  The GIL must be held, so the consumer can't take the call while it is changed.
+ */
+void ScintillaWrapper::coalesceCallback(NppPythonScript::ScintillaCallback& callback, const NppPythonScript::ScintillaNotificationArgs& notification)
+{
+    typedef NppPythonScript::ScintillaNotificationArgs Args;
+
+    std::shared_ptr<CallbackExecArgs> callbackExec = callback.pending().lock();
+    if (!callbackExec || callbackExec->isDispatched())
+	{
+        callbackExec.reset(new CallbackExecArgs());
+        callbackExec->addCallback(callback.getCallback());
+        callback.pending() = callbackExec;
+	}
+
+    NppPythonScript::CoalescedEvents& events = callbackExec->getCoalescedEvents();
+    const bool isModified = (SCN_MODIFIED == notification.value(Args::FIELD_CODE));
+    if (isModified)
+	{
+        events.addModification(static_cast<int>(notification.value(Args::FIELD_MODIFICATIONTYPE)), static_cast<int>(notification.value(Args::FIELD_POSITION)), 
+            static_cast<int>(notification.value(Args::FIELD_LENGTH)), static_cast<int>(notification.value(Args::FIELD_LINESADDED)));
+	}
+    else
+	{
+        events.add();
+	}
+
+    if (!isModified || 1 == events.count())
+	{
+        // Each callback has its own copy, as the args of a coalesced call change
+        callbackExec->setParams(boost::python::object(notification));
+	}
+
+    Args& merged = boost::python::extract<Args&>(*callbackExec->getParams());
+    merged.ownText();
+    if (isModified && events.count() > 1)
+	{
+        // The rest of the fields are from the first modification, apart from the text, which can't be merged
+        merged.set(Args::FIELD_POSITION, events.start());
+        merged.set(Args::FIELD_LENGTH, events.length());
+        merged.set(Args::FIELD_LINESADDED, events.linesAdded());
+        merged.set(Args::FIELD_MODIFICATIONTYPE, events.modificationType());
+        merged.remove(Args::FIELD_TEXT);
+	}
+    merged.set(Args::FIELD_COUNT, events.count());
+
+    if (1 == events.count())
+	{
+        produce(callbackExec);
+	}
+}
+
 
-bool ScintillaWrapper::addCallbackImpl(PyObject* callback, boost::python::list events, bool isAsync)
+bool ScintillaWrapper::addCallbackImpl(PyObject* callback, boost::python::list events, bool isAsync, bool coalesce /* = false */, boost::python::object filter /* = None */)
 {
 	if (PyCallable_Check(callback))
 	{
-		
+        NppPythonScript::NotificationFilter notificationFilter(makeNotificationFilter(filter));
 		{
             NppPythonScript::MutexHolder hold(m_callbackMutex);
 
@@ -364,8 +457,9 @@ bool ScintillaWrapper::addCallbackImpl(PyObject* callback, boost::python::list e
 			{
                 Py_INCREF(callback);
 				m_callbacks.insert(std::pair<int, boost::shared_ptr<ScintillaCallback> >(boost::python::extract<int>(events[i]), 
-					boost::shared_ptr<ScintillaCallback>(new ScintillaCallback(boost::python::object(boost::python::handle<>(callback)), isAsync))));
+					boost::shared_ptr<ScintillaCallback>(new ScintillaCallback(boost::python::object(boost::python::handle<>(callback)), isAsync, coalesce, notificationFilter))));
 			}
+            m_subscriptions.update(m_callbacks.begin(), m_callbacks.end());
 			m_notificationsEnabled = true;
 		}
 		startConsumer();
@@ -377,6 +471,28 @@ bool ScintillaWrapper::addCallbackImpl(PyObject* callback, boost::python::list e
 	}
 }
 
+boost::python::dict ScintillaWrapper::getCallbackStats(PyObject* callback)
+{
+    int delivered = 0;
+    int filtered = 0;
+	{
+        NppPythonScript::MutexHolder hold(m_callbackMutex);
+        for (callbackT::iterator it = m_callbacks.begin(); it != m_callbacks.end(); ++it)
+		{
+            if (callback == it->second->getCallback().ptr())
+			{
+                delivered += it->second->delivered();
+                filtered += it->second->filtered();
+			}
+		}
+	}
+
+    boost::python::dict stats;
+    stats["delivered"] = delivered;
+    stats["filtered"] = filtered;
+    return stats;
+}
+
 void ScintillaWrapper::clearCallbackFunction(PyObject* callback)
 {
 	NppPythonScript::MutexHolder hold(m_callbackMutex);
@@ -392,6 +508,7 @@ void ScintillaWrapper::clearCallbackFunction(PyObject* callback)
 		}
 	}
 
+    m_subscriptions.update(m_callbacks.begin(), m_callbacks.end());
 	if (m_callbacks.empty())
 	{
 		m_notificationsEnabled = false;
@@ -414,6 +531,7 @@ void ScintillaWrapper::clearCallbackEvents(boost::python::list events)
 		}
 	}
 
+    m_subscriptions.update(m_callbacks.begin(), m_callbacks.end());
 	if (m_callbacks.empty())
 	{
 		m_notificationsEnabled = false;
@@ -436,6 +554,7 @@ void ScintillaWrapper::clearCallback(PyObject* callback, boost::python::list eve
 			++it;
 		}
 	}
+    m_subscriptions.update(m_callbacks.begin(), m_callbacks.end());
 	if (m_callbacks.empty())
 	{
 		m_notificationsEnabled = false;
@@ -452,6 +571,7 @@ void ScintillaWrapper::clearAllCallbacks()
 	}
 
 
+    m_subscriptions.clear();
 	if (m_callbacks.empty())
 	{
 		m_notificationsEnabled = false;
@@ -596,12 +716,6 @@ void ScintillaWrapper::setTarget(int start, int end)
 }
 
 
-void deleteReplaceEntry(NppPythonScript::ReplaceEntry* entry)
-{
-    delete entry;
-}
-
-
 const char *ScintillaWrapper::getCurrentAnsiCodePageName()
 {
     UINT currentAcp = ::GetACP();
@@ -697,14 +811,14 @@ std::string ScintillaWrapper::extractEncodedString(boost::python::object str, in
     return resultStr;
 }
 
-NppPythonScript::ReplaceEntry *ScintillaWrapper::convertWithPython(const char * /* text */, NppPythonScript::Match *match, void *state)
+void ScintillaWrapper::convertWithPython(const char * /* text */, NppPythonScript::Match *match, void *state, NppPythonScript::ReplacementBatch& replacements)
 {
     ScintillaWrapper* instance = reinterpret_cast<ScintillaWrapper*>(state);
-    NppPythonScript::GroupDetail *wholeGroup = match->group(0);
+    NppPythonScript::GroupDetail wholeGroup;
+    match->group(0, wholeGroup);
     boost::python::str replacement(instance->m_pythonReplaceFunction(boost::ref(match)));
 
-    NppPythonScript::ReplaceEntry *entry = new NppPythonScript::ReplaceEntry(wholeGroup->start(), wholeGroup->end(), boost::python::extract<const char *>(replacement), boost::python::extract<int>(replacement.attr("__len__")()));
-    return entry;
+    replacements.add(wholeGroup.start(), wholeGroup.end(), boost::python::extract<const char *>(replacement), boost::python::extract<int>(replacement.attr("__len__")()));
 }
 
 bool ScintillaWrapper::searchPythonHandler(const char * /* text */, NppPythonScript::Match *match, void *state)
@@ -722,6 +836,34 @@ bool ScintillaWrapper::searchPythonHandler(const char * /* text */, NppPythonScr
 }
 
 
+bool ScintillaWrapper::searchManyPythonHandler(const char * /* text */, int keyword, NppPythonScript::Match *match, void *state)
+{
+    ScintillaWrapper* instance = reinterpret_cast<ScintillaWrapper*>(state);
+    boost::python::object result = instance->m_pythonMatchHandler(keyword, boost::ref(match));
+
+    // As for searchPythonHandler, only stop if the result was === False
+    if (!result.is_none() && PyBool_Check(result.ptr()) && false == boost::python::extract<bool>(result))
+	{
+        return false;
+	}
+
+    return true;
+}
+
+/** Adds the keyword, start and end of the match to the std::vector<int> in state, without touching Python
+ */
+bool ScintillaWrapper::collectKeywordMatch(const char * /* text */, int keyword, NppPythonScript::Match *match, void *state)
+{
+    std::vector<int> *found = reinterpret_cast<std::vector<int> *>(state);
+    NppPythonScript::GroupDetail fullMatch;
+    match->group(0, fullMatch);
+    found->push_back(keyword);
+    found->push_back(fullMatch.start());
+    found->push_back(fullMatch.end());
+    return true;
+}
+
+
 void ScintillaWrapper::replacePlain(boost::python::object searchStr, boost::python::object replaceStr)
 {
     replacePlainFlags(searchStr, replaceStr, NppPythonScript::python_re_flag_literal);
@@ -796,6 +938,29 @@ void ScintillaWrapper::replaceImpl(boost::python::object searchStr, boost::pytho
 			NppPythonScript::python_re_flags flags, 
 			int startPosition, 
 			int endPosition)
+{
+    int length = callScintilla(SCI_GETLENGTH);
+
+    if (startPosition < 0) 
+	{
+        startPosition = 0;
+	}
+
+    if (endPosition > 0 && endPosition < length)
+	{
+        length = endPosition;
+	}
+
+    replaceRange(searchStr, replaceStr, maxCount, flags, startPosition, length);
+}
+
+/** Replaces the matches in [startPosition, length) of the document
+ */
+void ScintillaWrapper::replaceRange(boost::python::object searchStr, boost::python::object replaceStr, 
+            int maxCount,
+			NppPythonScript::python_re_flags flags, 
+			int startPosition, 
+			int length)
 {
     int currentDocumentCodePage = this->GetCodePage();
 
@@ -809,21 +974,10 @@ void ScintillaWrapper::replaceImpl(boost::python::object searchStr, boost::pytho
         replaceChars = extractEncodedString(replaceStr, currentDocumentCodePage);
 	}
 
-    std::list<NppPythonScript::ReplaceEntry*> replacements;
+    NppPythonScript::ReplacementBatch replacements;
 
     const char *text = reinterpret_cast<const char *>(callScintilla(SCI_GETCHARACTERPOINTER));
-    int length = callScintilla(SCI_GETLENGTH);
-
-    if (startPosition < 0) 
-	{
-        startPosition = 0;
-	}
-
-    if (endPosition > 0 && endPosition < length)
-	{
-        length = endPosition;
-	}
-
+    flags = withoutLineMode(text, startPosition, length, searchChars.c_str(), flags);
 
     if (CP_UTF8 == currentDocumentCodePage)
 	{
@@ -838,6 +992,7 @@ void ScintillaWrapper::replaceImpl(boost::python::object searchStr, boost::pytho
 		{
             replacer.startReplace(text, length, startPosition, maxCount, searchChars.c_str(), replaceChars.c_str(), flags, replacements);
 		}
+        m_lastSearchStats = replacer.getStats();
 	}
 	else
 	{
@@ -852,8 +1007,41 @@ void ScintillaWrapper::replaceImpl(boost::python::object searchStr, boost::pytho
 		{
             replacer.startReplace(text, length, startPosition, maxCount, searchChars.c_str(), replaceChars.c_str(), flags, replacements);
 		}
+        m_lastSearchStats = replacer.getStats();
 	}
 
+    // Nothing is replaced if the search was stopped
+    checkSearchStopped();
+    applyReplacements(replacements);
+}
+
+/** Raises a SearchStoppedException if the SearchBudget stopped the last search (in m_lastSearchStats) part way through
+ */
+void ScintillaWrapper::checkSearchStopped()
+{
+    if (NppPythonScript::SEARCH_NOT_STOPPED == m_lastSearchStats.stopReason)
+	{
+        return;
+	}
+
+    const bool cancelled = (NppPythonScript::SEARCH_CANCELLED == m_lastSearchStats.stopReason);
+    std::ostringstream message;
+    if (cancelled)
+	{
+        message << "search stopped by Stop script";
+	}
+    else
+	{
+        message << "search stopped by the time limit of " << NppPythonScript::SearchBudget::getTimeLimit() << "ms";
+	}
+    message << " after " << m_lastSearchStats.matches << " matches, at position " << m_lastSearchStats.stoppedAt;
+    throw NppPythonScript::SearchStoppedException(message.str().c_str(), cancelled);
+}
+
+/** Runs the replacements on the UI thread (through PYSCR_RUNREPLACE), as one undo action
+ */
+void ScintillaWrapper::applyReplacements(NppPythonScript::ReplacementBatch& replacements)
+{
     NppPythonScript::ReplacementContainer replacementContainer(&replacements, this);
 
     BeginUndoAction();
@@ -868,53 +1056,138 @@ void ScintillaWrapper::replaceImpl(boost::python::object searchStr, boost::pytho
 	::SendMessage(m_hNotepad, NPPM_MSGTOPLUGIN, reinterpret_cast<WPARAM>(pluginName), reinterpret_cast<LPARAM>(&commInfo));
 
     EndUndoAction();
-
-    for_each(replacements.begin(), replacements.end(), deleteReplaceEntry);
-
 }
 
-void ScintillaWrapper::searchPlain(boost::python::object searchStr, boost::python::object matchFunction)
+void ScintillaWrapper::replaceMany(boost::python::object mapping)
 {
-    searchPlainImpl(searchStr, matchFunction, 0, 0, -1, -1);
+    replaceManyImpl(mapping, 0, -1, -1);
 }
 
-void ScintillaWrapper::searchRegex(boost::python::object searchStr, boost::python::object matchFunction)
+void ScintillaWrapper::replaceManyFlags(boost::python::object mapping, int flags)
 {
-	searchImpl(searchStr, matchFunction, 0, NppPythonScript::python_re_flag_normal, -1, -1);
+    replaceManyImpl(mapping, flags, -1, -1);
 }
 
-void ScintillaWrapper::searchRegexFlags(boost::python::object searchStr, boost::python::object matchFunction, int flags)
+void ScintillaWrapper::replaceManyFlagsStart(boost::python::object mapping, int flags, int startPosition)
 {
-    searchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, -1, -1);
+    replaceManyImpl(mapping, flags, startPosition, -1);
 }
 
-void ScintillaWrapper::searchRegexFlagsStart(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition)
+void ScintillaWrapper::replaceManyFlagsStartEnd(boost::python::object mapping, int flags, int startPosition, int endPosition)
 {
-    searchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, -1);
+    replaceManyImpl(mapping, flags, startPosition, endPosition);
 }
 
-void ScintillaWrapper::searchRegexFlagsStartEnd(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition)
+void ScintillaWrapper::replaceManyImpl(boost::python::object mapping, int flags, int startPosition, int endPosition)
 {
-    searchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
-}
+    int currentDocumentCodePage = this->GetCodePage();
 
-void ScintillaWrapper::searchRegexFlagsStartEndCount(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition, int maxCount)
-{
-    searchImpl(searchStr, matchFunction, maxCount, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
-}
+    // A dict is taken as its (search, replace) pairs
+    boost::python::object pairs = mapping;
+    if (PyDict_Check(mapping.ptr()))
+	{
+        pairs = boost::python::dict(mapping).items();
+	}
 
+    std::vector<std::string> keywordChars;
+    std::vector<std::string> replacementChars;
+    boost::python::stl_input_iterator<boost::python::object> pairsEnd;
+    for (boost::python::stl_input_iterator<boost::python::object> it(pairs); it != pairsEnd; ++it)
+	{
+        boost::python::object pair = *it;
+        if (2 != boost::python::len(pair))
+		{
+            throw NppPythonScript::ArgumentException("replaceMany needs a dict, or a list of (search, replace) pairs");
+		}
+        keywordChars.push_back(extractEncodedString(pair[0], currentDocumentCodePage));
+        if (keywordChars.back().empty())
+		{
+            throw NppPythonScript::ArgumentException("search strings cannot be empty");
+		}
+        replacementChars.push_back(extractEncodedString(pair[1], currentDocumentCodePage));
+	}
 
-void ScintillaWrapper::searchPlainFlags(boost::python::object searchStr, boost::python::object matchFunction, int flags)
-{
-	searchPlainImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, -1, -1);
-}
+    // As for replacePlain, only ignorecase is taken from the user flags
+    NppPythonScript::python_re_flags resultFlags = (NppPythonScript::python_re_flags)(flags & NppPythonScript::python_re_flag_ignorecase);
 
-void ScintillaWrapper::searchPlainFlagsStart(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition)
-{
-    searchPlainImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, -1);
-}
+    NppPythonScript::ReplacementBatch replacements;
 
-void ScintillaWrapper::searchPlainFlagsStartEnd(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition)
+    const char *text = reinterpret_cast<const char *>(callScintilla(SCI_GETCHARACTERPOINTER));
+    int length = callScintilla(SCI_GETLENGTH);
+
+    if (startPosition < 0) 
+	{
+        startPosition = 0;
+	}
+
+    if (endPosition > 0 && endPosition < length)
+	{
+        length = endPosition;
+	}
+
+	{
+        // Nothing calls back into Python while the document is searched
+        GILRelease release;
+        if (CP_UTF8 == currentDocumentCodePage)
+		{
+            NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
+            replacer.startReplaceMany(text, length, startPosition, keywordChars, replacementChars, resultFlags, replacements);
+            m_lastSearchStats = replacer.getStats();
+		}
+        else
+		{
+            NppPythonScript::Replacer<NppPythonScript::AnsiCharTraits> replacer;
+            replacer.startReplaceMany(text, length, startPosition, keywordChars, replacementChars, resultFlags, replacements);
+            m_lastSearchStats = replacer.getStats();
+		}
+	}
+
+    checkSearchStopped();
+    applyReplacements(replacements);
+}
+
+void ScintillaWrapper::searchPlain(boost::python::object searchStr, boost::python::object matchFunction)
+{
+    searchPlainImpl(searchStr, matchFunction, 0, 0, -1, -1);
+}
+
+void ScintillaWrapper::searchRegex(boost::python::object searchStr, boost::python::object matchFunction)
+{
+	searchImpl(searchStr, matchFunction, 0, NppPythonScript::python_re_flag_normal, -1, -1);
+}
+
+void ScintillaWrapper::searchRegexFlags(boost::python::object searchStr, boost::python::object matchFunction, int flags)
+{
+    searchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, -1, -1);
+}
+
+void ScintillaWrapper::searchRegexFlagsStart(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition)
+{
+    searchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, -1);
+}
+
+void ScintillaWrapper::searchRegexFlagsStartEnd(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition)
+{
+    searchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
+}
+
+void ScintillaWrapper::searchRegexFlagsStartEndCount(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition, int maxCount)
+{
+    searchImpl(searchStr, matchFunction, maxCount, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
+}
+
+
+void ScintillaWrapper::searchPlainFlags(boost::python::object searchStr, boost::python::object matchFunction, int flags)
+{
+	searchPlainImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, -1, -1);
+}
+
+void ScintillaWrapper::searchPlainFlagsStart(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition)
+{
+    searchPlainImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, -1);
+}
+
+void ScintillaWrapper::searchPlainFlagsStartEnd(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition)
 {
     searchPlainImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
 }
@@ -942,6 +1215,31 @@ void ScintillaWrapper::searchImpl(boost::python::object searchStr,
 			NppPythonScript::python_re_flags flags, 
 			int startPosition, 
 			int endPosition)
+{
+    int length = callScintilla(SCI_GETLENGTH);
+
+    if (startPosition < 0) 
+	{
+        startPosition = 0;
+	}
+
+    if (endPosition > 0 && endPosition < length)
+	{
+        length = endPosition;
+	}
+
+    searchRange(searchStr, matchFunction, maxCount, flags, startPosition, length, &ScintillaWrapper::searchPythonHandler);
+}
+
+/** Searches [startPosition, length) of the document, and calls handler (with this instance as the state) for each match
+ */
+void ScintillaWrapper::searchRange(boost::python::object searchStr, 
+            boost::python::object matchFunction,
+            int maxCount,
+			NppPythonScript::python_re_flags flags, 
+			int startPosition, 
+			int length,
+            NppPythonScript::searchResultHandler handler)
 {
     int currentDocumentCodePage = this->GetCodePage();
 
@@ -953,6 +1251,106 @@ void ScintillaWrapper::searchImpl(boost::python::object searchStr,
 	}
 
 
+    const char *text = reinterpret_cast<const char *>(callScintilla(SCI_GETCHARACTERPOINTER));
+    flags = withoutLineMode(text, startPosition, length, searchChars.c_str(), flags);
+
+    m_pythonMatchHandler = matchFunction;
+
+    if (CP_UTF8 == currentDocumentCodePage)
+	{
+        m_lastSearchStats = runSearch<NppPythonScript::Utf8CharTraits>(text, length, startPosition, maxCount, searchChars.c_str(), flags, handler);
+	}
+	else
+	{
+        m_lastSearchStats = runSearch<NppPythonScript::AnsiCharTraits>(text, length, startPosition, maxCount, searchChars.c_str(), flags, handler);
+	}
+
+    checkSearchStopped();
+}
+
+/** Drops python_re_flag_lines from flags if searching all the lines at once finds the same matches (see
+ *  ParallelSearchBase::canSearchLinesTogether()), so that the regex isn't set up again for every line
+ */
+NppPythonScript::python_re_flags ScintillaWrapper::withoutLineMode(const char *text, int startPosition, int length, const char *search, NppPythonScript::python_re_flags flags)
+{
+    if ((flags & NppPythonScript::python_re_flag_lines)
+        && NppPythonScript::ParallelSearchBase::canSearchLinesTogether(text, startPosition, length, search, flags))
+	{
+        return (NppPythonScript::python_re_flags)(flags & ~NppPythonScript::python_re_flag_lines);
+	}
+    return flags;
+}
+
+/** Large searches for patterns that stay within a line are split over the processors (without the GIL), and the 
+ *  matches are then given to the Python handler in order on this thread.  Everything else is searched here with a Replacer.
+ */
+template <class CharTraitsT>
+NppPythonScript::SearchStats ScintillaWrapper::runSearch(const char *text, int length, int startPosition, int maxCount, const char *search, NppPythonScript::python_re_flags flags,
+    NppPythonScript::searchResultHandler handler)
+{
+    if (NppPythonScript::ParallelSearchBase::canSearch(length - startPosition, search, flags))
+	{
+        NppPythonScript::ParallelSearch<CharTraitsT> parallelSearch(text, length, startPosition, maxCount, search, flags);
+        bool searched;
+		{
+            GILRelease release;
+            searched = parallelSearch.run();
+		}
+
+        // If it failed, the search below fails in the same way, with the usual exception
+        if (searched)
+		{
+            parallelSearch.reportMatches(handler, reinterpret_cast<void*>(this));
+            return parallelSearch.getStats();
+		}
+	}
+
+    NppPythonScript::Replacer<CharTraitsT> replacer;
+    replacer.search(text, length, startPosition,  maxCount, search, handler, reinterpret_cast<void*>(this), flags); 
+    return replacer.getStats();
+}
+
+void ScintillaWrapper::rsearch(boost::python::object searchStr, boost::python::object matchFunction)
+{
+    rsearchImpl(searchStr, matchFunction, 0, NppPythonScript::python_re_flag_normal, -1, -1);
+}
+
+void ScintillaWrapper::rsearchFlags(boost::python::object searchStr, boost::python::object matchFunction, int flags)
+{
+    rsearchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, -1, -1);
+}
+
+void ScintillaWrapper::rsearchFlagsStart(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition)
+{
+    rsearchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, -1);
+}
+
+void ScintillaWrapper::rsearchFlagsStartEnd(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition)
+{
+    rsearchImpl(searchStr, matchFunction, 0, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
+}
+
+void ScintillaWrapper::rsearchFlagsStartEndCount(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition, int maxCount)
+{
+    rsearchImpl(searchStr, matchFunction, maxCount, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
+}
+
+void ScintillaWrapper::rsearchImpl(boost::python::object searchStr, 
+            boost::python::object matchFunction,
+            int maxCount,
+			NppPythonScript::python_re_flags flags, 
+			int startPosition, 
+			int endPosition)
+{
+    int currentDocumentCodePage = this->GetCodePage();
+
+    std::string searchChars = extractEncodedString(searchStr, currentDocumentCodePage);
+    
+    if (!PyCallable_Check(matchFunction.ptr()))
+	{
+        throw NppPythonScript::ArgumentException("match parameter must be callable, i.e. either a function or a lambda expression");
+	}
+
     const char *text = reinterpret_cast<const char *>(callScintilla(SCI_GETCHARACTERPOINTER));
     int length = callScintilla(SCI_GETLENGTH);
 
@@ -966,250 +1364,566 @@ void ScintillaWrapper::searchImpl(boost::python::object searchStr,
         length = endPosition;
 	}
 
+    if (startPosition > length)
+	{
+        startPosition = length;
+	}
+
     m_pythonMatchHandler = matchFunction;
 
     if (CP_UTF8 == currentDocumentCodePage)
 	{
-        NppPythonScript::Replacer<NppPythonScript::Utf8CharTraits> replacer;
-
-        replacer.search(text, length, startPosition,  maxCount, searchChars.c_str(), &ScintillaWrapper::searchPythonHandler, reinterpret_cast<void*>(this), flags); 
+        m_lastSearchStats = runReverseSearch<NppPythonScript::Utf8CharTraits>(text, length, startPosition, maxCount, searchChars.c_str(), flags);
 	}
 	else
 	{
-        NppPythonScript::Replacer<NppPythonScript::AnsiCharTraits> replacer;
-
-        replacer.search(text, length, startPosition,  maxCount, searchChars.c_str(), &ScintillaWrapper::searchPythonHandler, reinterpret_cast<void*>(this), flags); 
+        m_lastSearchStats = runReverseSearch<NppPythonScript::AnsiCharTraits>(text, length, startPosition, maxCount, searchChars.c_str(), flags);
 	}
 
+    checkSearchStopped();
+}
 
+template <class CharTraitsT>
+NppPythonScript::SearchStats ScintillaWrapper::runReverseSearch(const char *text, int length, int startPosition, int maxCount, const char *search, NppPythonScript::python_re_flags flags)
+{
+    NppPythonScript::ReverseSearch<CharTraitsT> reverseSearch(text, length, startPosition, search, flags);
+    reverseSearch.search(maxCount, &ScintillaWrapper::searchPythonHandler, reinterpret_cast<void*>(this));
+    return reverseSearch.getStats();
 }
 
+int ScintillaWrapper::countPlain(boost::python::object searchStr)
+{
+    return countPlainFlags(searchStr, 0);
+}
 
-/*
-void ScintillaWrapper::replace(boost::python::object searchStr, boost::python::object replaceStr, boost::python::object flags)
+int ScintillaWrapper::countPlainFlags(boost::python::object searchStr, int flags)
 {
-	int start = 0;
-	int end = GetLength();
-	int iFlags = 0;
+    return countPlainFlagsStartEnd(searchStr, flags, -1, -1);
+}
 
+int ScintillaWrapper::countPlainFlagsStart(boost::python::object searchStr, int flags, int startPosition)
+{
+    return countPlainFlagsStartEnd(searchStr, flags, startPosition, -1);
+}
 
-	if (!flags.is_none())
+int ScintillaWrapper::countPlainFlagsStartEnd(boost::python::object searchStr, int flags, int startPosition, int endPosition)
+{
+    // As for searchPlain, only ignorecase is taken from the user flags
+    NppPythonScript::python_re_flags resultFlags = (NppPythonScript::python_re_flags)
+		    (NppPythonScript::python_re_flag_literal 
+			 | (flags & NppPythonScript::python_re_flag_ignorecase)
+			 );
+    return countImpl(searchStr, resultFlags, startPosition, endPosition);
+}
+
+int ScintillaWrapper::countRegex(boost::python::object searchStr)
+{
+    return countImpl(searchStr, NppPythonScript::python_re_flag_normal, -1, -1);
+}
+
+int ScintillaWrapper::countRegexFlags(boost::python::object searchStr, int flags)
+{
+    return countImpl(searchStr, (NppPythonScript::python_re_flags)flags, -1, -1);
+}
+
+int ScintillaWrapper::countRegexFlagsStart(boost::python::object searchStr, int flags, int startPosition)
+{
+    return countImpl(searchStr, (NppPythonScript::python_re_flags)flags, startPosition, -1);
+}
+
+int ScintillaWrapper::countRegexFlagsStartEnd(boost::python::object searchStr, int flags, int startPosition, int endPosition)
+{
+    return countImpl(searchStr, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
+}
+
+int ScintillaWrapper::countImpl(boost::python::object searchStr, NppPythonScript::python_re_flags flags, int startPosition, int endPosition)
+{
+    int currentDocumentCodePage = this->GetCodePage();
+
+    std::string searchChars = extractEncodedString(searchStr, currentDocumentCodePage);
+
+    const char *text = reinterpret_cast<const char *>(callScintilla(SCI_GETCHARACTERPOINTER));
+    int length = callScintilla(SCI_GETLENGTH);
+
+    if (startPosition < 0) 
 	{
-		iFlags |= boost::python::extract<int>(flags);
+        startPosition = 0;
 	}
 
+    if (endPosition > 0 && endPosition < length)
+	{
+        length = endPosition;
+	}
 
-	const char *replaceChars = boost::python::extract<const char*>(replaceStr.attr("__str__")());
-	
-	size_t replaceLength = strlen(replaceChars);
-
-	Sci_TextToFind src;
+    // Nothing from here on touches Python
+    GILRelease release;
 
-	src.lpstrText = const_cast<char*>((const char *)boost::python::extract<const char *>(searchStr.attr("__str__")()));
-	int originalEventMask = callScintilla(SCI_GETMODEVENTMASK);
-	callScintilla(SCI_SETMODEVENTMASK, 0);
-	BeginUndoAction();
-	int result = 0;
-	std::wstringstream debug;
-	while(result != -1)
+    if (CP_UTF8 == currentDocumentCodePage)
 	{
-		src.chrg.cpMin = start;
-		src.chrg.cpMax = end;
-		debug.str(std::wstring());
-		debug << L"Searching ";
-		debug << start << L" " << end;
+        m_lastSearchStats = runCount<NppPythonScript::Utf8CharTraits>(text, length, startPosition, searchChars.c_str(), flags);
+	}
+	else
+	{
+        m_lastSearchStats = runCount<NppPythonScript::AnsiCharTraits>(text, length, startPosition, searchChars.c_str(), flags);
+	}
 
+    checkSearchStopped();
+    return static_cast<int>(m_lastSearchStats.matches);
+}
 
-		OutputDebugString(debug.str().c_str());
-		result = callScintilla(SCI_FINDTEXT, iFlags, reinterpret_cast<LPARAM>(&src));
-		
-		// If nothing found, then just finish
-		if (-1 == result)
-		{
-			OutputDebugString(L"Got -1, no more matches");
-			break;
-		}
-		else
+/** As runSearch(), but the matches are only counted
+ */
+template <class CharTraitsT>
+NppPythonScript::SearchStats ScintillaWrapper::runCount(const char *text, int length, int startPosition, const char *search, NppPythonScript::python_re_flags flags)
+{
+    if (NppPythonScript::ParallelSearchBase::canSearch(length - startPosition, search, flags))
+	{
+        NppPythonScript::ParallelSearch<CharTraitsT> parallelSearch(text, length, startPosition, 0, search, flags, false);
+        if (parallelSearch.run())
 		{
-			// Replace the location found with the replacement text
-			SetTargetStart(src.chrgText.cpMin);
-			SetTargetEnd(src.chrgText.cpMax);
-			debug.str(std::wstring());
-			debug << L"Got result ";
-			debug << src.chrgText.cpMin << L" " << src.chrgText.cpMax;
-			OutputDebugString(debug.str().c_str());
-			callScintilla(SCI_REPLACETARGET, replaceLength, reinterpret_cast<LPARAM>(replaceChars));
-			start = src.chrgText.cpMin + (int)replaceLength;
-			end = end + ((int)replaceLength - (src.chrgText.cpMax - src.chrgText.cpMin));
+            return parallelSearch.getStats();
 		}
+	}
+
+    NppPythonScript::Replacer<CharTraitsT> replacer;
+    replacer.count(text, length, startPosition, search, flags);
+    return replacer.getStats();
+}
+
+boost::shared_ptr<NppPythonScript::MatchIterator> ScintillaWrapper::findIter(boost::python::object searchStr)
+{
+    return findIterImpl(searchStr, NppPythonScript::python_re_flag_normal, -1, -1);
+}
+
+boost::shared_ptr<NppPythonScript::MatchIterator> ScintillaWrapper::findIterFlags(boost::python::object searchStr, int flags)
+{
+    return findIterImpl(searchStr, (NppPythonScript::python_re_flags)flags, -1, -1);
+}
+
+boost::shared_ptr<NppPythonScript::MatchIterator> ScintillaWrapper::findIterFlagsStart(boost::python::object searchStr, int flags, int startPosition)
+{
+    return findIterImpl(searchStr, (NppPythonScript::python_re_flags)flags, startPosition, -1);
+}
+
+boost::shared_ptr<NppPythonScript::MatchIterator> ScintillaWrapper::findIterFlagsStartEnd(boost::python::object searchStr, int flags, int startPosition, int endPosition)
+{
+    return findIterImpl(searchStr, (NppPythonScript::python_re_flags)flags, startPosition, endPosition);
+}
+
+boost::shared_ptr<NppPythonScript::MatchIterator> ScintillaWrapper::findIterImpl(boost::python::object searchStr, NppPythonScript::python_re_flags flags, int startPosition, int endPosition)
+{
+    int currentDocumentCodePage = this->GetCodePage();
+
+    std::string searchChars = extractEncodedString(searchStr, currentDocumentCodePage);
+
+    boost::shared_ptr<DocumentSnapshot> snapshot(new DocumentSnapshot(m_handle));
+    int length = snapshot->length();
+
+    if (startPosition < 0) 
+	{
+        startPosition = 0;
+	}
 
+    if (endPosition > 0 && endPosition < length)
+	{
+        length = endPosition;
+	}
+
+    // The pattern is compiled here, so a bad one is reported by finditer() rather than the first next()
+    if (CP_UTF8 == currentDocumentCodePage)
+	{
+        return boost::shared_ptr<NppPythonScript::MatchIterator>(
+            new NppPythonScript::RegexMatchIterator<NppPythonScript::Utf8CharTraits>(snapshot->text(), length, startPosition, searchChars.c_str(), flags, snapshot));
+	}
+	else
+	{
+        return boost::shared_ptr<NppPythonScript::MatchIterator>(
+            new NppPythonScript::RegexMatchIterator<NppPythonScript::AnsiCharTraits>(snapshot->text(), length, startPosition, searchChars.c_str(), flags, snapshot));
 	}
-	callScintilla(SCI_SETMODEVENTMASK, originalEventMask);
-	EndUndoAction();
 }
 
-void ScintillaWrapper::rereplace(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object flags)
+boost::python::object ScintillaWrapper::searchMany(boost::python::object keywords)
 {
-	int start = 0;
-	int end = GetLength();
-	int iFlags = SCFIND_REGEXP | SCFIND_POSIX;
-	if (!flags.is_none())
+    return searchManyImpl(keywords, boost::python::object(), 0, -1, -1);
+}
+
+boost::python::object ScintillaWrapper::searchManyHandler(boost::python::object keywords, boost::python::object matchFunction)
+{
+    return searchManyImpl(keywords, matchFunction, 0, -1, -1);
+}
+
+boost::python::object ScintillaWrapper::searchManyHandlerFlags(boost::python::object keywords, boost::python::object matchFunction, int flags)
+{
+    return searchManyImpl(keywords, matchFunction, flags, -1, -1);
+}
+
+boost::python::object ScintillaWrapper::searchManyHandlerFlagsStart(boost::python::object keywords, boost::python::object matchFunction, int flags, int startPosition)
+{
+    return searchManyImpl(keywords, matchFunction, flags, startPosition, -1);
+}
+
+boost::python::object ScintillaWrapper::searchManyHandlerFlagsStartEnd(boost::python::object keywords, boost::python::object matchFunction, int flags, int startPosition, int endPosition)
+{
+    return searchManyImpl(keywords, matchFunction, flags, startPosition, endPosition);
+}
+
+boost::python::object ScintillaWrapper::searchManyImpl(boost::python::object keywords, boost::python::object matchFunction, int flags, int startPosition, int endPosition)
+{
+    int currentDocumentCodePage = this->GetCodePage();
+
+    std::vector<std::string> keywordChars;
+    boost::python::stl_input_iterator<boost::python::object> keywordsEnd;
+    for (boost::python::stl_input_iterator<boost::python::object> it(keywords); it != keywordsEnd; ++it)
 	{
-		iFlags |= boost::python::extract<int>(flags);
+        keywordChars.push_back(extractEncodedString(*it, currentDocumentCodePage));
+        if (keywordChars.back().empty())
+		{
+            throw NppPythonScript::ArgumentException("keywords cannot be empty");
+		}
 	}
 
-	const char *replaceChars = boost::python::extract<const char*>(replaceStr.attr("__str__")());
+    if (!matchFunction.is_none() && !PyCallable_Check(matchFunction.ptr()))
+	{
+        throw NppPythonScript::ArgumentException("match parameter must be callable, i.e. either a function or a lambda expression");
+	}
 
-	size_t replaceLength = strlen(replaceChars);
+    // As for searchPlain, only ignorecase is taken from the user flags
+    NppPythonScript::python_re_flags resultFlags = (NppPythonScript::python_re_flags)(flags & NppPythonScript::python_re_flag_ignorecase);
 
-	Sci_TextToFind src;
+    const char *text = reinterpret_cast<const char *>(callScintilla(SCI_GETCHARACTERPOINTER));
+    int length = callScintilla(SCI_GETLENGTH);
 
-	src.lpstrText = const_cast<char*>((const char *)boost::python::extract<const char *>(searchExp.attr("__str__")()));
-	
-	BeginUndoAction();
-	int result = 0;
-	while(result != -1)
+    if (startPosition < 0) 
 	{
-		src.chrg.cpMin = start;
-		src.chrg.cpMax = end;
-		result = callScintilla(SCI_FINDTEXT, iFlags, reinterpret_cast<LPARAM>(&src));
-		
-		// If nothing found, then just finish
-		if (-1 == result)
+        startPosition = 0;
+	}
+
+    if (endPosition > 0 && endPosition < length)
+	{
+        length = endPosition;
+	}
+
+    if (!matchFunction.is_none())
+	{
+        m_pythonMatchHandler = matchFunction;
+        if (CP_UTF8 == currentDocumentCodePage)
 		{
-			break;
+            m_lastSearchStats = runSearchMany<NppPythonScript::Utf8CharTraits>(text, length, startPosition, keywordChars, &ScintillaWrapper::searchManyPythonHandler, this, resultFlags);
 		}
-		else
+        else
 		{
-			// Replace the location found with the replacement text
-			SetTargetStart(src.chrgText.cpMin);
-			SetTargetEnd(src.chrgText.cpMax);
-			int replacementLength = callScintilla(SCI_REPLACETARGETRE, replaceLength, reinterpret_cast<LPARAM>(replaceChars));
-			start = src.chrgText.cpMin + replacementLength;
-			end = end + ((int)replaceLength - (src.chrgText.cpMax - src.chrgText.cpMin));
+            m_lastSearchStats = runSearchMany<NppPythonScript::AnsiCharTraits>(text, length, startPosition, keywordChars, &ScintillaWrapper::searchManyPythonHandler, this, resultFlags);
 		}
+        checkSearchStopped();
+        return boost::python::object();
+	}
 
+    // Without a function, the matches are collected without the GIL, and handed back all at once
+    std::vector<int> found;
+	{
+        GILRelease release;
+        if (CP_UTF8 == currentDocumentCodePage)
+		{
+            m_lastSearchStats = runSearchMany<NppPythonScript::Utf8CharTraits>(text, length, startPosition, keywordChars, &ScintillaWrapper::collectKeywordMatch, &found, resultFlags);
+		}
+        else
+		{
+            m_lastSearchStats = runSearchMany<NppPythonScript::AnsiCharTraits>(text, length, startPosition, keywordChars, &ScintillaWrapper::collectKeywordMatch, &found, resultFlags);
+		}
 	}
+    checkSearchStopped();
+
+    boost::python::list result;
+    for (size_t index = 0; index < found.size(); index += 3)
+	{
+        result.append(boost::python::make_tuple(found[index], found[index + 1], found[index + 2]));
+	}
+    return result;
+}
+
+template <class CharTraitsT>
+NppPythonScript::SearchStats ScintillaWrapper::runSearchMany(const char *text, int length, int startPosition, const std::vector<std::string>& keywords, 
+    NppPythonScript::keywordResultHandler handler, void *handlerState, NppPythonScript::python_re_flags flags)
+{
+    NppPythonScript::Replacer<CharTraitsT> replacer;
+    replacer.searchMany(text, length, startPosition, keywords, handler, handlerState, flags);
+    return replacer.getStats();
+}
 
-	EndUndoAction();
+void ScintillaWrapper::clearRegexCache()
+{
+    NppPythonScript::RegexCache<NppPythonScript::Utf8CharTraits>::getInstance().clear();
+    NppPythonScript::RegexCache<NppPythonScript::AnsiCharTraits>::getInstance().clear();
 }
 
+boost::python::dict ScintillaWrapper::getRegexCacheStats()
+{
+    NppPythonScript::RegexCacheStats utf8Stats = NppPythonScript::RegexCache<NppPythonScript::Utf8CharTraits>::getInstance().getStats();
+    NppPythonScript::RegexCacheStats ansiStats = NppPythonScript::RegexCache<NppPythonScript::AnsiCharTraits>::getInstance().getStats();
+
+    // The two caches (UTF-8 and ANSI documents) are reported as one.  The capacity applies to each cache separately.
+    boost::python::dict stats;
+    stats["hits"] = utf8Stats.hits + ansiStats.hits;
+    stats["misses"] = utf8Stats.misses + ansiStats.misses;
+    stats["evictions"] = utf8Stats.evictions + ansiStats.evictions;
+    stats["size"] = utf8Stats.size + ansiStats.size;
+    stats["capacity"] = utf8Stats.capacity;
+    return stats;
+}
 
+boost::python::dict ScintillaWrapper::getLastSearchStats()
+{
+    boost::python::dict stats;
+    stats["prefilterUsed"] = m_lastSearchStats.prefilterUsed;
+    stats["prefilterLiteral"] = m_lastSearchStats.prefilterLiteral;
+    stats["literalCandidates"] = m_lastSearchStats.literalCandidates;
+    stats["regexRuns"] = m_lastSearchStats.regexRuns;
+    stats["matches"] = m_lastSearchStats.matches;
+    stats["parallelChunks"] = m_lastSearchStats.parallelChunks;
+
+    switch (m_lastSearchStats.stopReason)
+	{
+        case NppPythonScript::SEARCH_CANCELLED:
+            stats["stopped"] = "cancelled";
+            break;
+        case NppPythonScript::SEARCH_TIME_LIMIT:
+            stats["stopped"] = "timeLimit";
+            break;
+        default:
+            stats["stopped"] = boost::python::object();
+            break;
+	}
+    stats["stoppedAt"] = m_lastSearchStats.stoppedAt;
+    stats["slowestRegexRun"] = m_lastSearchStats.slowestRegexRun;
+    return stats;
+}
 
-void ScintillaWrapper::pymlreplace(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startPosition, boost::python::object endPosition)
+void ScintillaWrapper::setBulkReplaceThreshold(int threshold)
 {
-	boost::python::str contents;
-	offset_t currentOffset = 0;
+    if (threshold < 0)
+	{
+        throw NppPythonScript::ArgumentException("threshold cannot be negative");
+	}
+    NppPythonScript::ReplacementContainer::setBulkThreshold(threshold);
+}
 
-	if (startPosition.is_none() && endPosition.is_none())
+void ScintillaWrapper::setSearchTimeLimit(int milliseconds)
+{
+    if (milliseconds < 0)
 	{
-		contents = GetCharacterPointer();
+        throw NppPythonScript::ArgumentException("time limit cannot be negative");
 	}
+    NppPythonScript::SearchBudget::setTimeLimit(static_cast<DWORD>(milliseconds));
+}
 
-	else
+int ScintillaWrapper::getSearchTimeLimit()
+{
+    return static_cast<int>(NppPythonScript::SearchBudget::getTimeLimit());
+}
+
+void ScintillaWrapper::setRegexStepLimit(long steps)
+{
+    if (steps <= 0)
 	{
-		Sci_TextRange range;
-		if (!startPosition.is_none())
-		{
-			range.chrg.cpMin = boost::python::extract<int>(startPosition);
-		}
-		else
-		{
-			range.chrg.cpMin = 0;
-		}
+        throw NppPythonScript::ArgumentException("step limit must be positive");
+	}
+    NppPythonScript::RegexComplexity::setStepLimit(steps);
+}
 
-		if (!endPosition.is_none())
-		{
-			range.chrg.cpMax = boost::python::extract<int>(endPosition);
-		}
-		else
-		{
-			range.chrg.cpMax = GetLength();
-		}
-		
-		currentOffset = (offset_t)range.chrg.cpMin;
+long ScintillaWrapper::getRegexStepLimit()
+{
+    return NppPythonScript::RegexComplexity::getStepLimit();
+}
+
+boost::python::dict ScintillaWrapper::getRegexComplexityStats()
+{
+    NppPythonScript::RegexComplexityStats complexityStats = NppPythonScript::RegexComplexity::getStats();
+
+    boost::python::dict stats;
+    stats["stepLimit"] = NppPythonScript::RegexComplexity::getStepLimit();
+    stats["limitExceeded"] = complexityStats.limitExceeded;
+    stats["lastExceededPattern"] = complexityStats.lastExceededPattern;
+    stats["slowestRun"] = complexityStats.slowestRun;
+    stats["slowestRunPattern"] = complexityStats.slowestRunPattern;
+    return stats;
+}
+
+/** QUEUE_BLOCK isn't allowed, as notify() runs on the GUI thread, and would wait for room while holding the GIL and the
+ *  callback mutex - which the callback making the room can need, and which would still hang if it sent a message to
+ *  Scintilla, as most callbacks do.
+ */
+void ScintillaWrapper::setCallbackQueueOverflow(int overflow)
+{
+    switch (overflow)
+	{
+	case NppPythonScript::QUEUE_DROP_OLDEST:
+	case NppPythonScript::QUEUE_DROP_NEWEST:
+        setQueueOverflow(static_cast<NppPythonScript::QueueOverflow>(overflow));
+        break;
 
-		range.lpstrText = new char[size_t((range.chrg.cpMax - range.chrg.cpMin) + 1)];
-		callScintilla(SCI_GETTEXTRANGE, 0, reinterpret_cast<LPARAM>(&range));
-		contents = boost::python::str(const_cast<const char *>(range.lpstrText));
-		delete[] range.lpstrText;
+	default:
+        throw NppPythonScript::ArgumentException("overflow must be editor.QUEUE_DROPOLDEST or editor.QUEUE_DROPNEWEST");
 	}
+}
 
+int ScintillaWrapper::getCallbackQueueOverflow()
+{
+    return getQueueOverflow();
+}
 
+boost::python::dict ScintillaWrapper::getCallbackQueueStats()
+{
+    NppPythonScript::QueueStats queueStats = getQueueStats();
+
+    boost::python::dict stats;
+    stats["capacity"] = queueStats.capacity;
+    stats["pushed"] = queueStats.pushed;
+    stats["droppedOldest"] = queueStats.droppedOldest;
+    stats["droppedNewest"] = queueStats.droppedNewest;
+    return stats;
+}
 
-	boost::python::object re_module( (boost::python::handle<>(PyImport_ImportModule("re"))) );
+int ScintillaWrapper::getBulkReplaceThreshold()
+{
+    return NppPythonScript::ReplacementContainer::getBulkThreshold();
+}
 
-	int iFlags = 0;
-	int iCount = 0;
-	if (!flags.is_none())
+void ScintillaWrapper::setParallelSearchThreshold(int threshold)
+{
+    if (threshold < 0)
 	{
-		iFlags = boost::python::extract<int>(flags);
+        throw NppPythonScript::ArgumentException("threshold cannot be negative");
 	}
-	if (!count.is_none())
+    NppPythonScript::ParallelSearchBase::setThreshold(threshold);
+}
+
+int ScintillaWrapper::getParallelSearchThreshold()
+{
+    return NppPythonScript::ParallelSearchBase::getThreshold();
+}
+
+
+void ScintillaWrapper::pyreplace(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startLine, boost::python::object endLine)
+{
+    int iFlags = 0;
+    if (!flags.is_none())
 	{
-		iCount = boost::python::extract<int>(count);
+        iFlags = boost::python::extract<int>(flags);
 	}
 
-	if (0 == iCount)
-		iCount = -1;
-	
-	
+    if (needsPythonEngine(iFlags))
+	{
+        pythonReplaceLines(searchExp, replaceStr, count, boost::python::object(iFlags & ~RE_PYTHONENGINE), startLine, endLine);
+        return;
+	}
 
-	boost::python::object re = re_module.attr("compile")(searchExp, iFlags | boost::python::extract<int>(re_module.attr("MULTILINE")));
-	if (!re_module.is_none())
+    int maxCount = 0;
+    if (!count.is_none())
 	{
-		boost::python::object match;
-		BeginUndoAction();
-		boost::python::object oreplacement;
-		size_t replacementLength;
-		idx_t matchStart, matchEnd;
-		idx_t startPos = 0;
-		
+        maxCount = boost::python::extract<int>(count);
+	}
 
-		do
-		{
-			match = re.attr("search")(contents, startPos);
-			if (!match.is_none())
-			{
-				// Get expanded replacement string
-				oreplacement = match.attr("expand")(replaceStr);
-				
-				
-				// Calculate offsets
-				matchStart = (idx_t)boost::python::extract<int>(match.attr("start")());
-				matchEnd   = (idx_t)boost::python::extract<int>(match.attr("end")());
+    NppPythonScript::python_re_flags lineFlags = lineModeFlags(iFlags);
+    int startPosition, endPosition;
+    lineRange(startLine, endLine, lineFlags, startPosition, endPosition);
 
+    replaceRange(searchExp, replaceStr, maxCount, lineFlags, startPosition, endPosition);
+}
 
-				// Extract text replacement
-				const char *replacement = boost::python::extract<const char *>(oreplacement);
-				replacementLength = _len(oreplacement);
+void ScintillaWrapper::pysearch(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startLine, boost::python::object endLine)
+{
+    int iFlags = 0;
+    if (!flags.is_none())
+	{
+        iFlags = boost::python::extract<int>(flags);
+	}
 
-				// Replace text in Scintilla
-				callScintilla(SCI_SETTARGETSTART, static_cast<offset_t>(matchStart) + currentOffset);
-				callScintilla(SCI_SETTARGETEND, static_cast<offset_t>(matchEnd) + currentOffset);
-				callScintilla(SCI_REPLACETARGET, replacementLength, reinterpret_cast<LPARAM>(replacement));
-				
+    if (needsPythonEngine(iFlags))
+	{
+        pythonSearchLines(searchExp, callback, boost::python::object(iFlags & ~RE_PYTHONENGINE), startLine, endLine);
+        return;
+	}
 
-				// Calculate the difference between the old string, 
-				// and the new replacement, and add it to the currentOffset
-				currentOffset += static_cast<offset_t>(replacementLength - (matchEnd - matchStart));
+    NppPythonScript::python_re_flags lineFlags = lineModeFlags(iFlags);
+    int startPosition, endPosition;
+    lineRange(startLine, endLine, lineFlags, startPosition, endPosition);
 
+    searchRange(searchExp, callback, 0, lineFlags, startPosition, endPosition, &ScintillaWrapper::searchLinesPythonHandler);
+}
 
-				// Set startPos to the end of the last match - startPos is with the original document
-				startPos = matchEnd; 
+/** True if pyreplace() or pysearch() has to run the re module from Python: for RE_PYTHONENGINE, and for any re flag the line
+ *  mode search can't match the same way (re.VERBOSE, re.UNICODE, re.LOCALE...).  re.MULTILINE makes no difference when each
+ *  line is searched on its own.
+ */
+bool ScintillaWrapper::needsPythonEngine(int flags)
+{
+    const int nativeFlags = NppPythonScript::python_re_flag_ignorecase | NppPythonScript::python_re_flag_multiline 
+        | NppPythonScript::python_re_flag_dotall | NppPythonScript::python_re_flag_includelineendings;
+    return (0 != (flags & RE_PYTHONENGINE)) || (0 != (flags & ~nativeFlags));
+}
 
+/** The flags for a line mode search from the flags given to pyreplace() or pysearch(): the re module's ignorecase and
+ *  dotall, and RE_INCLUDELINEENDINGS.  Only called where needsPythonEngine() is false.
+ */
+NppPythonScript::python_re_flags ScintillaWrapper::lineModeFlags(int flags)
+{
+    return (NppPythonScript::python_re_flags)(NppPythonScript::python_re_flag_lines 
+        | (flags & (NppPythonScript::python_re_flag_ignorecase | NppPythonScript::python_re_flag_dotall | NppPythonScript::python_re_flag_includelineendings)));
+}
 
-			}
-		} while(!match.is_none() && (iCount == -1 || --iCount > 0));
-		
-		EndUndoAction();
+/** Returns the positions of the lines from startLine to endLine (both included, and the document start or end if they're None)
+ *  for pyreplace() and pysearch().  The range ends before the line ending of endLine, unless the line endings are included.
+ */
+void ScintillaWrapper::lineRange(boost::python::object startLine, boost::python::object endLine, NppPythonScript::python_re_flags flags, int& startPosition, int& endPosition)
+{
+    const int length = GetLength();
+    const int lineCount = GetLineCount();
+
+    startPosition = 0;
+    if (!startLine.is_none())
+	{
+        int line = boost::python::extract<int>(startLine);
+        startPosition = (line >= lineCount) ? length : PositionFromLine((std::max)(line, 0));
+	}
+
+    endPosition = length;
+    if (!endLine.is_none())
+	{
+        int line = boost::python::extract<int>(endLine);
+        if (line < lineCount - 1)
+		{
+            line = (std::max)(line, 0);
+            endPosition = (flags & NppPythonScript::python_re_flag_includelineendings) ? PositionFromLine(line + 1) : GetLineEndPosition(line);
+		}
 	}
 
+    if (endPosition < startPosition)
+	{
+        endPosition = startPosition;
+	}
 }
 
+/** Calls the Python handler with the line number of the match as well as the match, for pysearch()
+ */
+bool ScintillaWrapper::searchLinesPythonHandler(const char * /* text */, NppPythonScript::Match *match, void *state)
+{
+    ScintillaWrapper* instance = reinterpret_cast<ScintillaWrapper*>(state);
+    NppPythonScript::GroupDetail fullMatch;
+    match->group(0, fullMatch);
+    boost::python::object result = instance->m_pythonMatchHandler(instance->LineFromPosition(fullMatch.start()), boost::ref(match));
 
+    // As for searchPythonHandler, only stop if the result was === False
+    if (!result.is_none() && PyBool_Check(result.ptr()) && false == boost::python::extract<bool>(result))
+	{
+        return false;
+	}
 
-void ScintillaWrapper::pyreplace(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startLine, boost::python::object endLine)
+    return true;
+}
+
+/** The pyreplace() of version 0.9, which runs re.subn() from Python on each line in turn, for RE_PYTHONENGINE
+ */
+void ScintillaWrapper::pythonReplaceLines(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startLine, boost::python::object endLine)
 {
 	
 	boost::python::object re_module( (boost::python::handle<>(PyImport_ImportModule("re"))) );
@@ -1232,7 +1946,7 @@ void ScintillaWrapper::pyreplace(boost::python::object searchExp, boost::python:
 		}
 
 		int end = -1;
-		if (!startLine.is_none())
+		if (!endLine.is_none())
 		{
 			 end = boost::python::extract<int>(endLine);
 		}
@@ -1328,9 +2042,9 @@ void ScintillaWrapper::pyreplace(boost::python::object searchExp, boost::python:
 
 }
 
-
-
-void ScintillaWrapper::pysearch(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startLine, boost::python::object endLine)
+/** The pysearch() of version 0.9, which runs re.search() from Python on each line in turn, for RE_PYTHONENGINE
+ */
+void ScintillaWrapper::pythonSearchLines(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startLine, boost::python::object endLine)
 {
 	
 	boost::python::object re_module( (boost::python::handle<>(PyImport_ImportModule("re"))) );
@@ -1405,6 +2119,171 @@ void ScintillaWrapper::pysearch(boost::python::object searchExp, boost::python::
 }
 
 
+void ScintillaWrapper::pymlreplace(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startPosition, boost::python::object endPosition)
+{
+    const int length = GetLength();
+    int start = 0;
+    if (!startPosition.is_none())
+	{
+        start = (std::min)((std::max)(static_cast<int>(boost::python::extract<int>(startPosition)), 0), length);
+	}
+
+    int end = length;
+    if (!endPosition.is_none())
+	{
+        end = (std::min)((std::max)(static_cast<int>(boost::python::extract<int>(endPosition)), start), length);
+	}
+
+    int iFlags = 0;
+    if (!flags.is_none())
+	{
+        iFlags = boost::python::extract<int>(flags);
+	}
+
+    int maxCount = 0;
+    if (!count.is_none())
+	{
+        maxCount = boost::python::extract<int>(count);
+	}
+
+    boost::python::object re_module( (boost::python::handle<>(PyImport_ImportModule("re"))) );
+    boost::python::object re = re_module.attr("compile")(searchExp, iFlags | boost::python::extract<int>(re_module.attr("MULTILINE")));
+
+    // One copy of the range, which finditer() goes through in one pass.  Nothing touches the document until all the 
+    // replacements are known, so the positions of the matches in the copy are the positions in the document.
+    const char *text = reinterpret_cast<const char *>(callScintilla(SCI_GETCHARACTERPOINTER));
+    boost::python::str contents(text + start, text + end);
+
+    NppPythonScript::ReplacementBatch replacements;
+    boost::python::stl_input_iterator<boost::python::object> matchesEnd;
+    for (boost::python::stl_input_iterator<boost::python::object> it(re.attr("finditer")(contents)); it != matchesEnd; ++it)
+	{
+        boost::python::object match = *it;
+        boost::python::object replacement = match.attr("expand")(replaceStr);
+        const int matchStart = boost::python::extract<int>(match.attr("start")());
+        const int matchEnd = boost::python::extract<int>(match.attr("end")());
+
+        replacements.add(start + matchStart, start + matchEnd, boost::python::extract<const char *>(replacement), static_cast<int>(_len(replacement)));
+        if (maxCount > 0 && static_cast<int>(replacements.size()) >= maxCount)
+		{
+            break;
+		}
+	}
+
+    applyReplacements(replacements);
+}
+
+
+
+/*
+void ScintillaWrapper::replace(boost::python::object searchStr, boost::python::object replaceStr, boost::python::object flags)
+{
+	int start = 0;
+	int end = GetLength();
+	int iFlags = 0;
+
+
+	if (!flags.is_none())
+	{
+		iFlags |= boost::python::extract<int>(flags);
+	}
+
+
+	const char *replaceChars = boost::python::extract<const char*>(replaceStr.attr("__str__")());
+	
+	size_t replaceLength = strlen(replaceChars);
+
+	Sci_TextToFind src;
+
+	src.lpstrText = const_cast<char*>((const char *)boost::python::extract<const char *>(searchStr.attr("__str__")()));
+	int originalEventMask = callScintilla(SCI_GETMODEVENTMASK);
+	callScintilla(SCI_SETMODEVENTMASK, 0);
+	BeginUndoAction();
+	int result = 0;
+	std::wstringstream debug;
+	while(result != -1)
+	{
+		src.chrg.cpMin = start;
+		src.chrg.cpMax = end;
+		debug.str(std::wstring());
+		debug << L"Searching ";
+		debug << start << L" " << end;
+
+
+		OutputDebugString(debug.str().c_str());
+		result = callScintilla(SCI_FINDTEXT, iFlags, reinterpret_cast<LPARAM>(&src));
+		
+		// If nothing found, then just finish
+		if (-1 == result)
+		{
+			OutputDebugString(L"Got -1, no more matches");
+			break;
+		}
+		else
+		{
+			// Replace the location found with the replacement text
+			SetTargetStart(src.chrgText.cpMin);
+			SetTargetEnd(src.chrgText.cpMax);
+			debug.str(std::wstring());
+			debug << L"Got result ";
+			debug << src.chrgText.cpMin << L" " << src.chrgText.cpMax;
+			OutputDebugString(debug.str().c_str());
+			callScintilla(SCI_REPLACETARGET, replaceLength, reinterpret_cast<LPARAM>(replaceChars));
+			start = src.chrgText.cpMin + (int)replaceLength;
+			end = end + ((int)replaceLength - (src.chrgText.cpMax - src.chrgText.cpMin));
+		}
+
+	}
+	callScintilla(SCI_SETMODEVENTMASK, originalEventMask);
+	EndUndoAction();
+}
+
+void ScintillaWrapper::rereplace(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object flags)
+{
+	int start = 0;
+	int end = GetLength();
+	int iFlags = SCFIND_REGEXP | SCFIND_POSIX;
+	if (!flags.is_none())
+	{
+		iFlags |= boost::python::extract<int>(flags);
+	}
+
+	const char *replaceChars = boost::python::extract<const char*>(replaceStr.attr("__str__")());
+
+	size_t replaceLength = strlen(replaceChars);
+
+	Sci_TextToFind src;
+
+	src.lpstrText = const_cast<char*>((const char *)boost::python::extract<const char *>(searchExp.attr("__str__")()));
+	
+	BeginUndoAction();
+	int result = 0;
+	while(result != -1)
+	{
+		src.chrg.cpMin = start;
+		src.chrg.cpMax = end;
+		result = callScintilla(SCI_FINDTEXT, iFlags, reinterpret_cast<LPARAM>(&src));
+		
+		// If nothing found, then just finish
+		if (-1 == result)
+		{
+			break;
+		}
+		else
+		{
+			// Replace the location found with the replacement text
+			SetTargetStart(src.chrgText.cpMin);
+			SetTargetEnd(src.chrgText.cpMax);
+			int replacementLength = callScintilla(SCI_REPLACETARGETRE, replaceLength, reinterpret_cast<LPARAM>(replaceChars));
+			start = src.chrgText.cpMin + replacementLength;
+			end = end + ((int)replaceLength - (src.chrgText.cpMax - src.chrgText.cpMin));
+		}
+
+	}
+
+	EndUndoAction();
+}
+
 
 
 void ScintillaWrapper::pymlsearch(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startPosition, boost::python::object endPosition)
@@ -17,7 +17,12 @@
 #include "CallbackExecArgs.h"
 #endif
 
+#ifndef MATCHITERATOR_20140510_H
+#include "MatchIterator.h"
+#endif
+
 #include "MutexHolder.h"
+#include "NotificationSubscriptions.h"
 #include "GILManager.h"
 
 struct SCNotification;
@@ -39,13 +44,11 @@ namespace NppPythonScript
 
 
     class Match;
-    class ReplaceEntry;
+    class ReplacementBatch;
 
     class ScintillaCallback;
-
-
-// Function that throws a notsupported exception, with the message about the method being deprecated
-boost::python::object deprecated_replace_function(boost::python::tuple args, boost::python::dict kwargs);
+    class ScintillaNotificationArgs;
+    class NotificationFilter;
 
 
 class ScintillaWrapper : public PyProducerConsumer<CallbackExecArgs>
@@ -61,7 +64,23 @@ public:
 	void notify(SCNotification *notifyCode);
 	bool addSyncCallback(PyObject* callback, boost::python::list events);
     bool addAsyncCallback(PyObject *callback, boost::python::list events);
-    bool addCallbackImpl(PyObject *callback, boost::python::list events, bool isAsync);
+
+    /** With coalesce, the notifications that arrive while the callback's last call is still waiting in the queue are
+     *  merged into that call (see CoalescedEvents), rather than each one being queued.
+     */
+    bool addAsyncCallbackCoalesce(PyObject *callback, boost::python::list events, bool coalesce);
+
+    /** With a filter (a dict - see makeNotificationFilter()), notify() only calls the callback for the notifications that
+     *  match it, and checks that before it takes the GIL.
+     */
+    bool addSyncCallbackFilter(PyObject* callback, boost::python::list events, boost::python::object filter);
+    bool addAsyncCallbackFilter(PyObject *callback, boost::python::list events, bool coalesce, boost::python::object filter);
+    bool addCallbackImpl(PyObject *callback, boost::python::list events, bool isAsync, bool coalesce = false, boost::python::object filter = boost::python::object());
+
+    /** Returns the number of notifications the callback function was called for (delivered), and the number its filters
+     *  threw away (filtered), for all the events it is registered for
+     */
+    boost::python::dict getCallbackStats(PyObject* callback);
 
 	void clearAllCallbacks();
 	void clearCallbackFunction(PyObject* callback);
@@ -98,6 +117,17 @@ public:
     void replaceRegexFlagsStartEndMaxCount(boost::python::object searchStr, boost::python::object replaceStr, int flags, int start, int end, int maxCount);
 
 	void replaceImpl(boost::python::object searchStr, boost::python::object replaceStr, int count, python_re_flags flags, int startPosition, int endPosition);
+    void replaceRange(boost::python::object searchStr, boost::python::object replaceStr, int count, python_re_flags flags, int startPosition, int length);
+
+    void replaceMany(boost::python::object mapping);
+    void replaceManyFlags(boost::python::object mapping, int flags);
+    void replaceManyFlagsStart(boost::python::object mapping, int flags, int startPosition);
+    void replaceManyFlagsStartEnd(boost::python::object mapping, int flags, int startPosition, int endPosition);
+
+    /** Replaces the keys of mapping (a dict, or a sequence of (search, replace) pairs) with their values in one pass over the document,
+     *  as one undo action.
+     */
+    void replaceManyImpl(boost::python::object mapping, int flags, int startPosition, int endPosition);
 	
     void searchPlain(boost::python::object searchStr, boost::python::object matchFunction);
     void searchPlainFlags(boost::python::object searchStr, boost::python::object matchFunction, int flags);
@@ -112,11 +142,118 @@ public:
     void searchRegexFlagsStartEnd(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition);
     void searchRegexFlagsStartEndCount(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition, int maxCount);
 
+    /** As research(), but the matches are given to matchFunction last first (see ReverseSearch), so maxCount counts from the end
+     */
+    void rsearch(boost::python::object searchStr, boost::python::object matchFunction);
+    void rsearchFlags(boost::python::object searchStr, boost::python::object matchFunction, int flags);
+    void rsearchFlagsStart(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition);
+    void rsearchFlagsStartEnd(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition);
+    void rsearchFlagsStartEndCount(boost::python::object searchStr, boost::python::object matchFunction, int flags, int startPosition, int endPosition, int maxCount);
+    void rsearchImpl(boost::python::object searchStr, boost::python::object matchFunction, int maxCount, python_re_flags flags, int startPosition, int endPosition);
+
     void searchPlainImpl(boost::python::object searchStr, boost::python::object matchFunction, int maxCount, int flags, int startPosition, int endPosition);
     void searchImpl(boost::python::object searchStr, boost::python::object matchFunction, int maxCount, python_re_flags flags, int startPosition, int endPosition);
+    void searchRange(boost::python::object searchStr, boost::python::object matchFunction, int maxCount, python_re_flags flags, int startPosition, int length, searchResultHandler handler);
 
-	//static const int RE_INCLUDELINEENDINGS = 65536;
-	/*
+    int countPlain(boost::python::object searchStr);
+    int countPlainFlags(boost::python::object searchStr, int flags);
+    int countPlainFlagsStart(boost::python::object searchStr, int flags, int startPosition);
+    int countPlainFlagsStartEnd(boost::python::object searchStr, int flags, int startPosition, int endPosition);
+
+    int countRegex(boost::python::object searchStr);
+    int countRegexFlags(boost::python::object searchStr, int flags);
+    int countRegexFlagsStart(boost::python::object searchStr, int flags, int startPosition);
+    int countRegexFlagsStartEnd(boost::python::object searchStr, int flags, int startPosition, int endPosition);
+
+    /** Counts the matches without calling into Python for each one, and with the GIL released for the whole search
+     */
+    int countImpl(boost::python::object searchStr, python_re_flags flags, int startPosition, int endPosition);
+
+    boost::shared_ptr<MatchIterator> findIter(boost::python::object searchStr);
+    boost::shared_ptr<MatchIterator> findIterFlags(boost::python::object searchStr, int flags);
+    boost::shared_ptr<MatchIterator> findIterFlagsStart(boost::python::object searchStr, int flags, int startPosition);
+    boost::shared_ptr<MatchIterator> findIterFlagsStartEnd(boost::python::object searchStr, int flags, int startPosition, int endPosition);
+
+    /** Returns an iterator that finds the matches one at a time, as Python asks for them.  The iterator (and the matches) raise
+     *  an exception if the document is edited while they are in use (see DocumentSnapshot).
+     */
+    boost::shared_ptr<MatchIterator> findIterImpl(boost::python::object searchStr, python_re_flags flags, int startPosition, int endPosition);
+
+    boost::python::object searchMany(boost::python::object keywords);
+    boost::python::object searchManyHandler(boost::python::object keywords, boost::python::object matchFunction);
+    boost::python::object searchManyHandlerFlags(boost::python::object keywords, boost::python::object matchFunction, int flags);
+    boost::python::object searchManyHandlerFlagsStart(boost::python::object keywords, boost::python::object matchFunction, int flags, int startPosition);
+    boost::python::object searchManyHandlerFlagsStartEnd(boost::python::object keywords, boost::python::object matchFunction, int flags, int startPosition, int endPosition);
+
+    /** Finds all the occurrences of all the keywords in one pass over the document.  With a matchFunction, it is called with
+     *  the index of the keyword and the match for each one, otherwise a list of (keyword index, start, end) is returned.
+     */
+    boost::python::object searchManyImpl(boost::python::object keywords, boost::python::object matchFunction, int flags, int startPosition, int endPosition);
+
+    /** The number of insertions and deletions in the documents of either view, for DocumentSnapshot to notice edits
+     */
+    static LONG getModificationCount() { return s_modificationCount; }
+
+    /** Clears the cache of compiled regular expressions used by search/replace, and resets its counters.
+     */
+    void clearRegexCache();
+
+    /** Returns a dict with the hits, misses, evictions, size and capacity of the compiled regular expression cache.
+     */
+    boost::python::dict getRegexCacheStats();
+
+    /** Returns a dict with the counters of the last search or replace (whether the required literal prefilter was used etc).
+     */
+    boost::python::dict getLastSearchStats();
+
+    /** Sets the number of replacements from which replace() and rereplace() rebuild the replaced span in one go, 
+     *  rather than replacing each match separately.  Zero always replaces each match separately.
+     */
+    void setBulkReplaceThreshold(int threshold);
+    int getBulkReplaceThreshold();
+
+    /** Sets the number of bytes from which research() splits the search over the processors (see ParallelSearch).
+     *  Zero always searches on one thread.
+     */
+    void setParallelSearchThreshold(int threshold);
+    int getParallelSearchThreshold();
+
+    /** Sets the longest (in milliseconds) any search or replace can run for before it is stopped (see SearchBudget).
+     *  Zero is no limit.
+     */
+    void setSearchTimeLimit(int milliseconds);
+    int getSearchTimeLimit();
+
+    /** Sets how many steps one run of the regex engine can take before it gives up with a RuntimeError (see RegexComplexity).
+     */
+    void setRegexStepLimit(long steps);
+    long getRegexStepLimit();
+
+    /** Returns the RegexComplexity counters: how often the step limit was hit, and the slowest run of the regex engine so far
+     */
+    boost::python::dict getRegexComplexityStats();
+
+    /** Sets what happens when the queue of async callbacks is full: QUEUE_DROPOLDEST (the default) throws away the oldest
+     *  notification, and QUEUE_DROPNEWEST the new one.  QUEUE_BLOCK isn't allowed, as notify() would wait on the GUI thread
+     */
+    void setCallbackQueueOverflow(int overflow);
+    int getCallbackQueueOverflow();
+
+    /** Returns the counters of the async callback queue: how many notifications were queued or dropped
+     */
+    boost::python::dict getCallbackQueueStats();
+
+    static const int QUEUE_DROPOLDEST = NppPythonScript::QUEUE_DROP_OLDEST;
+    static const int QUEUE_DROPNEWEST = NppPythonScript::QUEUE_DROP_NEWEST;
+
+    /** Flags for pyreplace() and pysearch(), as well as the re module's.  RE_INCLUDELINEENDINGS makes each line's ending part
+     *  of the line, and RE_PYTHONENGINE runs the re module on each line in turn from Python, as version 0.9 did.
+     */
+	static const int RE_INCLUDELINEENDINGS = python_re_flag_includelineendings;
+    static const int RE_PYTHONENGINE = 0x20000;
+
+    /** Replaces the matches on each line from startLine to endLine, with each line searched on its own (python_re_flag_lines)
+     */
 	void pyreplace(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startLine, boost::python::object endLine);
 	void pyreplaceNoFlagsNoCount(boost::python::object searchExp, boost::python::object replaceStr)
 					{	pyreplace(searchExp, replaceStr, boost::python::object(0), boost::python::object(0), boost::python::object(), boost::python::object()); };
@@ -127,7 +264,19 @@ public:
 	void pyreplaceNoEnd(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startLine)
 					{	pyreplace(searchExp, replaceStr, count, flags, startLine, boost::python::object()); };
 
-	
+    /** Calls callback(lineNumber, match) for the matches on each line from startLine to endLine, as pyreplace() finds them
+     */
+	void pysearch(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startLine, boost::python::object endLine);
+	void pysearchNoFlags(boost::python::object searchExp, boost::python::object callback)
+					{	pysearch(searchExp, callback, boost::python::object(0), boost::python::object(), boost::python::object()); };
+	void pysearchNoStartEnd(boost::python::object searchExp, boost::python::object callback, boost::python::object flags)
+					{	pysearch(searchExp, callback, flags, boost::python::object(), boost::python::object()); };
+	void pysearchNoEnd(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startLine)
+					{	pysearch(searchExp, callback, flags, startLine, boost::python::object()); };
+
+    /** Replaces the matches of the re module's expression in the document (as one string, with re.MULTILINE), 
+     *  found in one pass with finditer(), and applied together as rereplace() does
+     */
 	void pymlreplace(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startPosition, boost::python::object endPosition);
 	void pymlreplaceNoFlagsNoCount(boost::python::object searchExp, boost::python::object replaceStr)
 					{	pymlreplace(searchExp, replaceStr, boost::python::object(0), boost::python::object(0), boost::python::object(), boost::python::object()); };
@@ -138,14 +287,7 @@ public:
 	void pymlreplaceNoEnd(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startPosition)
 					{	pymlreplace(searchExp, replaceStr, count, flags, startPosition, boost::python::object()); };
 
-	void pysearch(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startLine, boost::python::object endLine);
-	void pysearchNoFlags(boost::python::object searchExp, boost::python::object callback)
-					{	pysearch(searchExp, callback, boost::python::object(0), boost::python::object(), boost::python::object()); };
-	void pysearchNoStartEnd(boost::python::object searchExp, boost::python::object callback, boost::python::object flags)
-					{	pysearch(searchExp, callback, flags, boost::python::object(), boost::python::object()); };
-	void pysearchNoEnd(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startLine)
-					{	pysearch(searchExp, callback, flags, startLine, boost::python::object()); };
-
+	/*
 	void pymlsearch(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startPosition, boost::python::object endPosition);
 	void pymlsearchNoFlags(boost::python::object searchExp, boost::python::object callback)
 					{	pymlsearch(searchExp, callback, boost::python::object(0), boost::python::object(), boost::python::object()); };
@@ -2956,17 +3098,43 @@ private:
 	// Callbacks
 	HANDLE m_callbackMutex;
 	callbackT m_callbacks;
+    NotificationSubscriptions m_subscriptions;   // The codes in m_callbacks, for notify() to check without the GIL
 	
 	bool m_notificationsEnabled;
+
+    static volatile LONG s_modificationCount;
 	
 	static void runCallbacks(CallbackExecArgs *args);
 
     void runCallbacks(std::shared_ptr<CallbackExecArgs> args);
+    void coalesceCallback(NppPythonScript::ScintillaCallback& callback, const NppPythonScript::ScintillaNotificationArgs& notification);
+    static NotificationFilter makeNotificationFilter(boost::python::object filter);
     std::string extractEncodedString(boost::python::object str, int toCodePage);
-    static ReplaceEntry *convertWithPython(const char *text, Match *match, void *state);
+    static void convertWithPython(const char *text, Match *match, void *state, ReplacementBatch& replacements);
+    void applyReplacements(ReplacementBatch& replacements);
+    void checkSearchStopped();
     static bool searchPythonHandler(const char * /* text */, Match *match, void *state);
+    static bool searchLinesPythonHandler(const char * /* text */, Match *match, void *state);
+    static bool needsPythonEngine(int flags);
+    static python_re_flags lineModeFlags(int flags);
+    void lineRange(boost::python::object startLine, boost::python::object endLine, python_re_flags flags, int& startPosition, int& endPosition);
+    void pythonReplaceLines(boost::python::object searchExp, boost::python::object replaceStr, boost::python::object count, boost::python::object flags, boost::python::object startLine, boost::python::object endLine);
+    void pythonSearchLines(boost::python::object searchExp, boost::python::object callback, boost::python::object flags, boost::python::object startLine, boost::python::object endLine);
+    static bool searchManyPythonHandler(const char * /* text */, int keyword, Match *match, void *state);
+    static bool collectKeywordMatch(const char * /* text */, int keyword, Match *match, void *state);
+    template <class CharTraitsT>
+    NppPythonScript::SearchStats runSearch(const char *text, int length, int startPosition, int maxCount, const char *search, python_re_flags flags, searchResultHandler handler);
+    static python_re_flags withoutLineMode(const char *text, int startPosition, int length, const char *search, python_re_flags flags);
+    template <class CharTraitsT>
+    static NppPythonScript::SearchStats runSearchMany(const char *text, int length, int startPosition, const std::vector<std::string>& keywords, 
+                                                      keywordResultHandler handler, void *handlerState, python_re_flags flags);
+    template <class CharTraitsT>
+    NppPythonScript::SearchStats runReverseSearch(const char *text, int length, int startPosition, int maxCount, const char *search, python_re_flags flags);
+    template <class CharTraitsT>
+    static NppPythonScript::SearchStats runCount(const char *text, int length, int startPosition, const char *search, python_re_flags flags);
     boost::python::object m_pythonReplaceFunction;
     boost::python::object m_pythonMatchHandler;
+    NppPythonScript::SearchStats m_lastSearchStats;
 
     const char *getCurrentAnsiCodePageName();
     
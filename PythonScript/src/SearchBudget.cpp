@@ -0,0 +1,71 @@
+#include "stdafx.h"
+
+#include "SearchBudget.h"
+
+namespace NppPythonScript
+{
+
+volatile LONG SearchBudget::s_cancelledThread = 0;
+volatile LONG SearchBudget::s_cancelReported = 0;
+volatile LONG SearchBudget::s_timeLimit = 0;
+
+SearchBudget::SearchBudget()
+	: m_threadID(::GetCurrentThreadId()),
+      m_startTicks(::GetTickCount()),
+      m_timeLimit(static_cast<DWORD>(s_timeLimit)),
+      m_calls(0),
+      m_stopReason(SEARCH_NOT_STOPPED)
+{
+}
+
+bool SearchBudget::check()
+{
+    if (static_cast<DWORD>(s_cancelledThread) == m_threadID)
+	{
+        m_stopReason = SEARCH_CANCELLED;
+        return true;
+	}
+
+    // The subtraction is still right when the tick count wraps
+    if (0 != m_timeLimit && ::GetTickCount() - m_startTicks > m_timeLimit)
+	{
+        m_stopReason = SEARCH_TIME_LIMIT;
+        return true;
+	}
+
+    return false;
+}
+
+void SearchBudget::cancelThread(DWORD threadID)
+{
+    ::InterlockedExchange(&s_cancelReported, 0);
+    ::InterlockedExchange(&s_cancelledThread, static_cast<LONG>(threadID));
+}
+
+void SearchBudget::clearCancel()
+{
+    ::InterlockedExchange(&s_cancelledThread, 0);
+    ::InterlockedExchange(&s_cancelReported, 0);
+}
+
+void SearchBudget::markCancelReported()
+{
+    ::InterlockedExchange(&s_cancelReported, 1);
+}
+
+bool SearchBudget::isCancelReported()
+{
+    return 0 != s_cancelReported;
+}
+
+void SearchBudget::setTimeLimit(DWORD milliseconds)
+{
+    ::InterlockedExchange(&s_timeLimit, static_cast<LONG>(milliseconds));
+}
+
+DWORD SearchBudget::getTimeLimit()
+{
+    return static_cast<DWORD>(s_timeLimit);
+}
+
+}
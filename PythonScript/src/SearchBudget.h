@@ -0,0 +1,78 @@
+#ifndef SEARCHBUDGET_20140511_H
+#define SEARCHBUDGET_20140511_H
+
+namespace NppPythonScript
+{
+    enum SearchStopReason
+	{
+        SEARCH_NOT_STOPPED = 0,
+        SEARCH_CANCELLED,          // "Stop script" was used on the thread that started the search
+        SEARCH_TIME_LIMIT          // The search ran for longer than SearchBudget::getTimeLimit()
+	};
+
+    /** Lets a search or replace be stopped part way through, rather than only when it gets back to Python (which is when the
+     *  KeyboardInterrupt from "Stop script" is noticed).  The Replacer (and so each chunk of a ParallelSearch) calls isExhausted()
+     *  for each match and each run of the regex engine, and stops when it returns true.
+     *
+     *  A search is stopped when "Stop script" is used on the thread that started it (see cancelThread()), or when it has run 
+     *  for longer than the time limit, if there is one.  isExhausted() only looks at either every CHECK_INTERVAL calls, 
+     *  so it costs next to nothing.  A single run of the regex engine can't be stopped.
+     *
+     *  The budget can be copied, e.g. to the worker threads of a ParallelSearch, which then share the start time and the thread.
+     */
+    class SearchBudget
+	{
+	public:
+        /** Starts the budget now, for a search on the current thread
+         */
+        SearchBudget();
+
+        bool isExhausted()
+		{
+            if (SEARCH_NOT_STOPPED != m_stopReason)
+			{
+                return true;
+			}
+            if (0 != (++m_calls & (CHECK_INTERVAL - 1)))
+			{
+                return false;
+			}
+            return check();
+		}
+
+        SearchStopReason stopReason() const { return m_stopReason; }
+
+        static const unsigned int CHECK_INTERVAL = 16;   // A power of 2
+
+        /** Stops the searches started on the given thread, from now until clearCancel()
+         */
+        static void cancelThread(DWORD threadID);
+        static void clearCancel();
+
+        /** Records that a search stopped by cancelThread() has been reported to Python (as a KeyboardInterrupt), so that 
+         *  "Stop script" doesn't need to raise another one.  Both this and isCancelReported() are only called with the GIL.
+         */
+        static void markCancelReported();
+        static bool isCancelReported();
+
+        /** The longest each search can run for, in milliseconds, 0 (the default) for no limit.  This is read when each search starts.
+         */
+        static void setTimeLimit(DWORD milliseconds);
+        static DWORD getTimeLimit();
+
+	private:
+        bool check();
+
+        DWORD m_threadID;
+        DWORD m_startTicks;
+        DWORD m_timeLimit;
+        unsigned int m_calls;
+        SearchStopReason m_stopReason;
+
+        static volatile LONG s_cancelledThread;    // 0 if nothing is cancelled
+        static volatile LONG s_cancelReported;
+        static volatile LONG s_timeLimit;
+	};
+}
+
+#endif // SEARCHBUDGET_20140511_H
@@ -0,0 +1,27 @@
+#include "stdafx.h"
+
+#include "SearchStoppedException.h"
+#include "SearchBudget.h"
+
+
+namespace NppPythonScript
+{
+
+
+void translateSearchStoppedException(const SearchStoppedException &e)
+{
+    if (e.isCancelled())
+	{
+        // "Stop script" raises a KeyboardInterrupt in the script too, unless this one was raised first.  If "Stop script" 
+        // got there first, its one is dropped, so the script only gets the one with the details of the search.
+        PyThreadState_SetAsyncExc(PyThreadState_Get()->thread_id, NULL);
+        SearchBudget::markCancelReported();
+        PyErr_SetString(PyExc_KeyboardInterrupt, e.what());
+	}
+    else
+	{
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+	}
+}
+
+}
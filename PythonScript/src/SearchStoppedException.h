@@ -0,0 +1,35 @@
+#ifndef SEARCHSTOPPEDEXCEPTION_20140511_H
+#define SEARCHSTOPPEDEXCEPTION_20140511_H
+
+namespace NppPythonScript
+{
+
+/** Thrown when the SearchBudget stopped a search or replace part way through, either by "Stop script" (cancelled) or the time limit
+ */
+class SearchStoppedException
+{
+public:
+	SearchStoppedException(const char *desc, bool cancelled)
+		: m_desc(desc),
+		  m_cancelled(cancelled)
+		{};
+
+	const char *what() const
+	{ return m_desc.c_str();
+	}
+
+	bool isCancelled() const { return m_cancelled; }
+
+private:
+	SearchStoppedException(); // default constructor disabled
+
+	std::string m_desc;
+	bool m_cancelled;
+};
+
+
+void translateSearchStoppedException(const SearchStoppedException &e);
+
+}
+
+#endif // SEARCHSTOPPEDEXCEPTION_20140511_H
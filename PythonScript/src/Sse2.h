@@ -0,0 +1,41 @@
+#ifndef SSE2_20140422_H
+#define SSE2_20140422_H
+
+// SSE2 is available on every x86/x64 CPU that Notepad++ runs on.  On 32 bit builds it is still checked at runtime.
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#define PYTHONSCRIPT_SSE2
+
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace NppPythonScript
+{
+    inline bool sse2Available()
+	{
+#if defined(_M_IX86)
+        static const bool available = (FALSE != ::IsProcessorFeaturePresent(PF_XMMI64_INSTRUCTIONS_AVAILABLE));
+        return available;
+#else
+        return true;
+#endif
+	}
+
+    /** Index of the lowest set bit of a (non-zero) _mm_movemask_epi8 result
+     */
+    inline int lowestSetBit(unsigned int mask)
+	{
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(mask);
+#endif
+	}
+}
+
+#endif
+
+#endif // SSE2_20140422_H
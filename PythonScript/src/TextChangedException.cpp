@@ -0,0 +1,15 @@
+#include "stdafx.h"
+
+#include "TextChangedException.h"
+
+
+namespace NppPythonScript
+{
+
+
+void translateTextChangedException(const TextChangedException &e)
+{
+    PyErr_SetString(PyExc_RuntimeError, e.what());
+}
+
+}
@@ -0,0 +1,31 @@
+#ifndef TEXTCHANGEDEXCEPTION_20140510_H
+#define TEXTCHANGEDEXCEPTION_20140510_H
+
+namespace NppPythonScript
+{
+
+/** Thrown when the text a search is running over has changed (e.g. the document was edited between two steps of editor.finditer())
+ */
+class TextChangedException
+{
+public:
+	explicit TextChangedException(const char *desc)
+		: m_desc(desc)
+		{};
+
+	const char *what() const
+	{ return m_desc.c_str();
+	}
+
+private:
+	TextChangedException(); // default constructor disabled
+
+	std::string m_desc;
+};
+
+
+void translateTextChangedException(const TextChangedException &e);
+
+}
+
+#endif // TEXTCHANGEDEXCEPTION_20140510_H
@@ -1,12 +1,129 @@
 #include "stdafx.h"
 
 #include "UTF8Iterator.h"
+#include "Sse2.h"
+
+// Most documents are almost all ASCII, so when the iterator reaches an ASCII character, it looks ahead for the end of 
+// the run of ASCII (up to this many bytes), and then steps through the run without decoding.
+static const int ASCII_RUN_LOOKAHEAD = 4096;
+
+// Multibyte characters are decoded with a DFA.  Each byte is mapped to a class, and the class and the current state 
+// give the next state.  Any invalid sequence (including one cut short by the end of the text) decodes the first byte
+// to invalid_utf8_base + byte, exactly as the Utf8Decoder does.
+enum Utf8ByteClass {
+	BYTE_ASCII,           // 00..7F
+	BYTE_CONTINUATION_8,  // 80..8F
+	BYTE_CONTINUATION_9,  // 90..9F
+	BYTE_CONTINUATION_AB, // A0..BF
+	BYTE_INVALID,         // C0, C1, F5..FF
+	BYTE_LEAD_2,          // C2..DF
+	BYTE_LEAD_E0,         // E0 (second byte must be A0..BF, or it's an overlong form)
+	BYTE_LEAD_3,          // E1..EF
+	BYTE_LEAD_F0,         // F0 (second byte must be 90..BF, or it's an overlong form)
+	BYTE_LEAD_4,          // F1..F4
+	BYTE_CLASS_COUNT
+};
+
+enum Utf8DecodeState {
+	STATE_ACCEPT,         // A complete character
+	STATE_REJECT,         // An invalid sequence
+	// All the states after STATE_REJECT are waiting for more bytes
+	STATE_NEED_1,         // Waiting for 1, 2 or 3 more continuation bytes
+	STATE_NEED_2,
+	STATE_NEED_3,
+	STATE_AFTER_E0,
+	STATE_AFTER_F0,
+	STATE_COUNT
+};
+
+static const unsigned char s_byteClass[256] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // 00..1F
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // 20..3F
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // 40..5F
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  // 60..7F
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,  // 80..9F
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, 3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,  // A0..BF
+	4,4,5,5,5,5,5,5,5,5,5,5,5,5,5,5, 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,  // C0..DF
+	6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7, 8,9,9,9,9,4,4,4,4,4,4,4,4,4,4,4   // E0..FF
+};
+
+// Bits of the first byte that are part of the code point, for each class of first byte
+static const unsigned char s_leadMask[BYTE_CLASS_COUNT] = { 0x7F, 0, 0, 0, 0, 0x1F, 0x0F, 0x0F, 0x07, 0x07 };
+
+static const unsigned char s_transition[STATE_COUNT][BYTE_CLASS_COUNT] = {
+	//  ASCII         CONT_8        CONT_9        CONT_AB       INVALID       LEAD_2        LEAD_E0         LEAD_3        LEAD_F0         LEAD_4
+	{ STATE_ACCEPT, STATE_REJECT, STATE_REJECT, STATE_REJECT, STATE_REJECT, STATE_NEED_1, STATE_AFTER_E0, STATE_NEED_2, STATE_AFTER_F0, STATE_NEED_3 }, // ACCEPT (start)
+	{ STATE_REJECT, STATE_REJECT, STATE_REJECT, STATE_REJECT, STATE_REJECT, STATE_REJECT, STATE_REJECT,   STATE_REJECT, STATE_REJECT,   STATE_REJECT }, // REJECT
+	{ STATE_REJECT, STATE_ACCEPT, STATE_ACCEPT, STATE_ACCEPT, STATE_REJECT, STATE_REJECT, STATE_REJECT,   STATE_REJECT, STATE_REJECT,   STATE_REJECT }, // NEED_1
+	{ STATE_REJECT, STATE_NEED_1, STATE_NEED_1, STATE_NEED_1, STATE_REJECT, STATE_REJECT, STATE_REJECT,   STATE_REJECT, STATE_REJECT,   STATE_REJECT }, // NEED_2
+	{ STATE_REJECT, STATE_NEED_2, STATE_NEED_2, STATE_NEED_2, STATE_REJECT, STATE_REJECT, STATE_REJECT,   STATE_REJECT, STATE_REJECT,   STATE_REJECT }, // NEED_3
+	{ STATE_REJECT, STATE_REJECT, STATE_REJECT, STATE_NEED_1, STATE_REJECT, STATE_REJECT, STATE_REJECT,   STATE_REJECT, STATE_REJECT,   STATE_REJECT }, // AFTER_E0
+	{ STATE_REJECT, STATE_REJECT, STATE_NEED_2, STATE_NEED_2, STATE_REJECT, STATE_REJECT, STATE_REJECT,   STATE_REJECT, STATE_REJECT,   STATE_REJECT }  // AFTER_F0
+};
 
 void UTF8Iterator::readCharacter()
 {
-	UtfConversion::Utf8Decoder decoder(_doc + _pos, bytesLeft());
-	_character = decoder.decodedChar();
-	_utf8Length = decoder.decodedLength();
+	const UCHAR first_byte = _doc[_pos];
+	if (Utf8::isSingleByte(first_byte))
+	{
+		_character = first_byte;
+		_utf8Length = 1;
+		_asciiEnd = findAsciiRunEnd(_doc, _pos, std::min(_end, _pos + ASCII_RUN_LOOKAHEAD));
+		return;
+	}
+	readMultiByteCharacter(first_byte);
+}
+
+void UTF8Iterator::readMultiByteCharacter(UCHAR first_byte)
+{
+	const unsigned char first_class = s_byteClass[first_byte];
+	unsigned char state = s_transition[STATE_ACCEPT][first_class];
+	U32 character = first_byte & s_leadMask[first_class];
+	const int bytes_left = bytesLeft();
+	int length = 1;
+	while (state > STATE_REJECT)
+	{
+		if (length == bytes_left)
+		{
+			state = STATE_REJECT;
+			break;
+		}
+		const UCHAR current_byte = _doc[_pos + length];
+		state = s_transition[state][s_byteClass[current_byte]];
+		character = (character << 6) | (current_byte & 0x3F);
+		++length;
+	}
+
+	if (STATE_ACCEPT == state)
+	{
+		_character = character;
+		_utf8Length = length;
+	}
+	else
+	{
+		_character = UtfConversion::invalid_utf8_base + first_byte;
+		_utf8Length = 1;
+	}
+}
+
+/// Returns the position of the first non-ASCII byte in [pos, end), or end if they are all ASCII.
+int UTF8Iterator::findAsciiRunEnd(const char* doc, int pos, int end)
+{
+#ifdef PYTHONSCRIPT_SSE2
+	if (NppPythonScript::sse2Available())
+	{
+		// The top bit of each byte is collected by movemask, so a block is all ASCII if the mask is zero
+		for (; pos + 16 <= end; pos += 16)
+		{
+			const int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(doc + pos)));
+			if (mask != 0)
+				return pos + NppPythonScript::lowestSetBit(static_cast<unsigned int>(mask));
+		}
+	}
+#endif
+	while (pos < end && Utf8::isSingleByte(doc[pos]))
+		++pos;
+	return pos;
 }
 
 typedef u32_regex_traits::charT charT;
@@ -59,13 +176,6 @@ string_type u32_regex_traits::lookup_collatename(const charT* p1, const charT* p
 	return UtfConversion::toUtf32(result);
 }
 
-charT u32_regex_traits::mapChar(charT c, DWORD mapFlags) {
-	U16_char u16 = UtfConversion::toUtf16(c);
-	U16_char u16mapped;
-	u16mapped.length(::LCMapStringW(LOCALE_USER_DEFAULT, mapFlags, u16, u16.length(), u16mapped, 2));
-	return UtfConversion::toUtf32(u16mapped);
-}
-
 string_type u32_regex_traits::genSortkey(const charT* p1, const charT* p2, bool onlyPrimaryLevel) {
 	std::wstring str = UtfConversion::toUtf16(ConstString<charT>(p1, p2-p1));
 	std::basic_string<UCHAR> sortkey = genSortkey(str, onlyPrimaryLevel);
@@ -3,6 +3,7 @@
 
 
 #include "UtfConversion.h"
+#include "UnicodeTables.h"
 
 
 #ifndef ARRAY_LENGTH
@@ -70,16 +71,14 @@ public:
 		if (!UtfConversion::isValidCodepoint(c))
 			return (class_mask & mask_invalid) != 0;
 		
-		U16_char u16c = UtfConversion::toUtf16(c);
-
-		WORD char_class[2];
-		if (::GetStringTypeExW(LOCALE_USER_DEFAULT, CT_CTYPE1, u16c, u16c.length(), &char_class[0])
-			&& (char_class[0] & class_mask & mask_CT_CTYPE1))
+		// Precomputed, rather than calling GetStringTypeExW for every character (see UnicodeTables.h)
+		const unsigned short char_class = UnicodeTables::characterType(c);
+		if (char_class & class_mask & mask_CT_CTYPE1)
 			return true;
 		return
 			(class_mask & mask_word) && (c == '_')
 			|| (class_mask & mask_unicode) && (c > 0xFF)
-			|| (class_mask & mask_horizontal) &&  (char_class[0] & C1_SPACE) && !(is_separator(c) || c == '\v')
+			|| (class_mask & mask_horizontal) &&  (char_class & C1_SPACE) && !(is_separator(c) || c == '\v')
 			|| (class_mask & mask_vertical) && (is_separator(c) || c == '\v')
 			;
 	}
@@ -119,14 +118,15 @@ public:
 	static std::string error_string(boost::regex_constants::error_type n) {
 		return boost::re_detail::get_default_error_string(n);
 	}
+	/// The same simple case mapping as the ignore case literal search (IgnoreCaseLiteralSearcher), so both agree on what matches.
 	static charT tolower(charT c) {
 		if (UtfConversion::isValidCodepoint(c))
-			c = mapChar(c, LCMAP_LOWERCASE);
+			c = UnicodeTables::foldCase(c);
 		return c;
 	}
 	static charT toupper(charT c) {
 		if (UtfConversion::isValidCodepoint(c))
-			c = mapChar(c, LCMAP_UPPERCASE);
+			c = UnicodeTables::toUpper(c);
 		return c;
 	}
 private:
@@ -148,7 +148,6 @@ private:
 			|| (c == 0x2029) 
 			|| (c == 0x85);
 	}
-	static charT mapChar(charT c, DWORD mapFlags);
 	
 	static string_type genSortkey(const charT* p1, const charT* p2, bool onlyPrimaryLevel = false);
 	static std::basic_string<UCHAR> genSortkey(const std::wstring& wstr, bool onlyPrimaryLevel);
@@ -163,7 +162,8 @@ public:
 		_pos(pos),
 		_end(end),
 		_character(0),
-		_utf8Length(0)
+		_utf8Length(0),
+		_asciiEnd(0)
 	{
 		// Check for debug builds
 		assert(_pos <= _end);
@@ -180,7 +180,8 @@ public:
 		_pos(copy._pos),
 		_end(copy._end),
 		_character(copy._character),
-		_utf8Length(copy._utf8Length)
+		_utf8Length(copy._utf8Length),
+		_asciiEnd(copy._asciiEnd)
 	{
 	}
 
@@ -202,6 +203,7 @@ public:
 	UTF8Iterator& operator = (int pos)
 	{
 		_pos = pos;
+		_asciiEnd = 0;
 		return *this;
 	}
 
@@ -209,6 +211,13 @@ public:
 	{
 		assert(_pos < _end);
 		_pos += _utf8Length;
+		if (_pos < _asciiEnd)
+		{
+			// Still in the run of ASCII found by readCharacter(), so there's nothing to decode
+			_character = static_cast<UCHAR>(_doc[_pos]);
+			_utf8Length = 1;
+			return *this;
+		}
 		if (!ended())
 			readCharacter();
 		else
@@ -229,6 +238,7 @@ public:
 			_character = current_byte;
 			return *this;
 		}
+		_asciiEnd = 0;
 		const int mininum_character_start_position = std::max(original_pos-4, 0);
 		while (_pos > mininum_character_start_position
 			&& Utf8::isContinuation(_doc[_pos]))
@@ -251,6 +261,8 @@ public:
 
 private:
 	void readCharacter();
+	void readMultiByteCharacter(UCHAR first_byte);
+	static int findAsciiRunEnd(const char* doc, int pos, int end);
 
 	bool ended() const
 	{
@@ -267,6 +279,7 @@ private:
 	int _end;
 	U32 _character;
 	int _utf8Length;
+	int _asciiEnd;  // The bytes from _pos up to here are all known to be ASCII
 };
 
 #endif // UTF8ITERATOR_H_3452843291318441149
@@ -0,0 +1,27 @@
+#pragma once
+/**
+* Precomputed Unicode character data, so that the hot paths of searching don't need to ask the OS about every character.
+* The tables are in UnicodeTables.cpp, which is generated by CreateUnicodeTables.py.
+* @file
+*/
+
+#include "UtfConversion.h"
+
+namespace UnicodeTables {
+
+/// Returns the simple (one to one) lowercase mapping of c, which is how characters are compared when ignoring case.
+/// Code points that are not valid characters (e.g. invalid UTF-8 bytes) are returned unchanged.
+U32 foldCase(U32 c);
+
+/// Returns true if the ASCII character c is the foldCase() of some non-ASCII character (e.g. 'k' for KELVIN SIGN).
+bool isFoldedFromNonAscii(U32 c);
+
+/// Returns the simple (one to one) uppercase mapping of c, or c if it doesn't have one.
+U32 toUpper(U32 c);
+
+/// Returns the CT_CTYPE1 classes of c (C1_ALPHA, C1_SPACE etc), as GetStringTypeEx gives them for the first
+/// UTF-16 unit of c - so a character outside the BMP has the classes of its lead surrogate.  Returns 0 for
+/// values that are not code points.
+unsigned short characterType(U32 c);
+
+} // namespace UnicodeTables
@@ -55,6 +55,10 @@
 #include <algorithm>
 #include <iomanip>
 
+// Boost's regex engine gives up after this many steps, which can be changed while running (see RegexComplexity.h)
+namespace NppPythonScript { long regexStepLimit(); }
+#define BOOST_REGEX_MAX_STATE_COUNT NppPythonScript::regexStepLimit()
+
 #include <boost/regex.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -72,6 +76,7 @@
 #pragma warning( disable : 4244 4512 4100)
 #include <boost/python.hpp>
 #include <boost/python/raw_function.hpp>
+#include <boost/python/stl_iterator.hpp>
 #pragma warning( pop )
 
 typedef  std::basic_string<TCHAR>	tstring;